@@ -70,6 +70,8 @@
 							dFactor,
 							blendingEquation,
 							depthTestingFunction;
+					std::string	computeDomain;
+					int		numInstances;
 
 					// Friends
 					friend class FilterLayout;
@@ -87,6 +89,7 @@
 
 					bool isStandardVertexSource(void) const;
 					bool isStandardGeometryModel(void) const;
+					bool isComputeFilter(void) const;
 					int getNumUniformVars(void) const;
 					bool isClearingEnabled(void) const;
 					void enableClearing(void);
@@ -101,6 +104,10 @@
 					const GLenum& getDepthTestingFunction(void) const;
 					void enableDepthTesting(const GLenum& _depthTestingFunction = GL_LESS);
 					void disableDepthTesting(void);
+					const std::string& getComputeDomain(void) const;
+					void setComputeDomain(const std::string& inputPortName = "");
+					int getNumInstances(void) const;
+					void setNumInstances(int n);
 			};
 
 			/**
@@ -120,24 +127,34 @@
 			/**
 			\class Filter
 			\brief Filter object.
+
+			When the output format is layered (array or 3D texture, see HdlAbstractTextureFormat::isLayered()), all the layers are rendered by a single draw call : the geometry is drawn once per layer (instancing) and the index of the instance selects the layer (gl_Layer). Without a custom vertex shader, the fragment shader can read this index in "flat in int layer".
 			**/
 			class GLIP_API Filter : virtual public Component, virtual public AbstractFilterLayout
 			{
 				private :
 					// Data
-					HdlShader  			*shaders[HandleOpenGL::numShaderTypes];
 					HdlProgram 			*prgm;
 					GeometryInstance		*geometry;
 					bool				firstRun,
 									broken;
 					std::vector<HdlTexture*>	arguments;
 
+					static bool isImageFormat(GLenum mode);
+					static bool isVertexLayerAvailable(void);
+					static std::string getLayeredVertexSource(bool vertexLayer);
+					static std::string getLayeredGeometrySource(GLenum primitive);
+
 				protected :
 					// Tools
 					Filter(const AbstractFilterLayout&, const std::string& name);
+					Filter(const AbstractFilterLayout&, const std::string& name, Filter& host, const std::string& uniformsPrefix);
 
 					void setInputForNextRendering(int id, HdlTexture* ptr);
+					void changeFormat(const HdlAbstractTextureFormat& fmt);
 					void process(HdlFBO& renderer);
+					void processCompute(HdlFBO& renderer);
+					void processBatch(const std::vector<HdlFBO*>& renderers, const std::vector< std::vector<HdlTexture*> >& batchArguments);
 
 					// Friends
 					friend class Pipeline;
@@ -149,6 +166,9 @@
 					HdlProgram& program(void);
 					bool wentThroughFirstRun(void) const;
 					bool isBroken(void) const;
+
+					static bool isComputeAvailable(void);
+					static bool isLayeredRenderingAvailable(void);
 			};
 		}
 	}
@@ -63,6 +63,8 @@
 						PointsGrid2D,
 						/// 3D grid of dots.
 						PointsGrid3D,
+						/// Grid of dots generated in the vertex shader, without vertex data.
+						ProceduralGrid,
 						/// Unknown geometry type.
 						Unknown
 					};
@@ -72,6 +74,11 @@
 								normals,
 								texCoords;
 					std::vector<GLuint>	elements;
+					int			proceduralSize[3];
+					mutable unsigned long long	hash;
+					mutable bool		hashValid;
+
+					static void hashBytes(unsigned long long& h, const void* data, size_t size);
 
 				protected :
 					// Tools :
@@ -107,6 +114,7 @@
 					GLuint& c(GLuint i);
 					GLuint& d(GLuint i);
 					void generateNormals(void);
+					void setProceduralSize(int w, int h, int d);
 
 				public :
 								/// Geometry Type.
@@ -128,6 +136,8 @@
 					virtual ~GeometryModel(void);
 
 					unsigned int getNumVertices(void) const;
+					bool isProcedural(void) const;
+					void getProceduralSize(int& w, int& h, int& d) const;
 					unsigned int getNumElements(void) const;
 					const GLenum& getGLPrimitive(void) const;
 					const GLfloat& x(GLuint i) const;
@@ -143,6 +153,8 @@
 					const GLuint& c(GLuint i) const;
 					const GLuint& d(GLuint i) const;
 					bool testIndices(void) const;
+					unsigned long long getHash(void) const;
+					size_t getDataSize(void) const;
 					bool operator==(const GeometryModel& mdl) const;
 
 					HdlVBO* getVBO(GLenum freq) const;
@@ -154,6 +166,8 @@
 			/**
 			\class GeometryInstance
 			\brief Instance of the GeometryModel. Stored on GPU (VBO).
+
+			The instances of identical models share the same VBO. The models are indexed by their hash (see GeometryModel::getHash) and only compared entirely with the models having the same hash.
 			**/
 			class GLIP_API GeometryInstance
 			{
@@ -163,6 +177,7 @@
 					static std::map<int, HdlVBO*> 		vbos;
 					static std::map<int, GeometryModel*>	models;
 					static std::map<int, int>		counters;
+					static std::multimap<unsigned long long, int>	hashes;
 
 					// Current :
 					int id;
@@ -175,6 +190,10 @@
 					const GeometryModel& model(void) const;
 					const HdlVBO& vbo(void) const;
 					void draw(void);
+					void drawInstanced(int numInstances);
+
+					static int getNumSharedVBOs(void);
+					static size_t getSavedBytes(void);
 			};
 
 			// Geometries :
@@ -233,6 +252,34 @@
 						PointsGrid3D(const PointsGrid3D& mdl);
 				};
 
+				/**
+				\class ProceduralGrid
+				\brief Geometry : a 2D or 3D grid of points, without vertex data. 
+
+				Nothing is generated nor uploaded, the grid is drawn as width x height x depth points whose coordinates must be derived from gl_VertexID in the vertex shader :
+				\code
+				#version 130
+				uniform sampler2D inputTexture;
+
+				void main()
+				{
+					const ivec2 size = textureSize(inputTexture, 0);
+					const ivec3 point = ivec3(gl_VertexID % size.x, (gl_VertexID / size.x) % size.y, gl_VertexID / (size.x*size.y));
+					...
+				}
+				\endcode
+				**/
+				class GLIP_API ProceduralGrid : public GeometryModel
+				{
+					public :
+						const int width,
+							  height,
+							  depth;
+
+						ProceduralGrid(int w, int h, int d=1);
+						ProceduralGrid(const ProceduralGrid& mdl);
+				};
+
 				/**
 				\class CustomModel
 				\brief Geometry : build a model.
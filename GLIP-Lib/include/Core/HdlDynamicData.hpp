@@ -275,11 +275,33 @@ delete data;
 					return (*this);
 				}
 
+/**
+\class HalfFloat
+\brief Half precision floating point value (16 bits, as stored with the GL_HALF_FLOAT depth).
+
+The value converts implicitly to and from float (rounding to the nearest, ties to even; infinities and denormalized values are preserved, NaN are made quiet). The bulk conversions HalfFloat::toFloat(float*, const HalfFloat*, size_t) and HalfFloat::toHalf(HalfFloat*, const float*, size_t) use the F16C instructions when the library is compiled for them (CMake option GLIP_USE_F16C).
+**/
+			class GLIP_API HalfFloat
+			{
+				public :
+					/// Raw bits of the value (1 sign bit, 5 exponent bits and 10 mantissa bits).
+					unsigned short bits;
+
+					HalfFloat(void);
+					HalfFloat(const float& value);
+					operator float(void) const;
+
+					static unsigned short toHalf(const float& value);
+					static float toFloat(const unsigned short& h);
+					static void toHalf(HalfFloat* dst, const float* src, size_t count);
+					static void toFloat(float* dst, const HalfFloat* src, size_t count);
+			};
+
 /**
 \class HdlDynamicTable
 \brief Dynamic table allocator for GL types (run-time resolution of type).
 
-Supported types : <i>GL_BOOL, GL_BYTE, GL_UNSIGNED_BYTE, GL_SHORT, GL_UNSIGNED_SHORT, GL_INT, GL_UNSIGNED_INT, GL_FLOAT, GL_DOUBLE</i>.
+Supported types : <i>GL_BOOL, GL_BYTE, GL_UNSIGNED_BYTE, GL_SHORT, GL_UNSIGNED_SHORT, GL_INT, GL_UNSIGNED_INT, GL_HALF_FLOAT (see HalfFloat), GL_FLOAT, GL_DOUBLE</i>.
 The indexing is <b>row major</b> and the slices are interleaved ("RGBRGBRGB..." image-like). Most of the accessors do NOT perform tests on coordinate validity.
 
 Example :  
@@ -706,6 +728,12 @@ delete data;
 				template<>
 				double HdlDynamicTableSpecial<double>::denormalize(const float& t);
 
+				template<>
+				float HdlDynamicTableSpecial<HalfFloat>::normalize(const HalfFloat& t);
+
+				template<>
+				HalfFloat HdlDynamicTableSpecial<HalfFloat>::denormalize(const float& t);
+
 			// Template implementation :
 				template<typename T>
 				HdlDynamicTableSpecial<T>::HdlDynamicTableSpecial(const GLenum& _type, int _columns, int _rows, int _slices, bool _normalized, int _alignment)
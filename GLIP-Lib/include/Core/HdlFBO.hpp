@@ -82,6 +82,7 @@
 					bool				firstRendering;
 					HdlRenderBuffer*		depthBuffer;
 					bool				depthBufferAttached;
+					GLuint				mipmapsQueries[2];	// Timestamp queries issued around the next mipmaps generation (0 if unused).
 
 					// Tools
 					void bindTextureToFBO(int i);
@@ -105,6 +106,7 @@
 
 					void		beginRendering(int usedTarget=0, bool useExistingDepthBuffer=false);
 					void		endRendering(void);
+					void		setMipmapsQueries(GLuint beforeQuery, GLuint afterQuery);
 					void		bind(void);
 					HdlTexture* 	operator[](int i);
 					size_t		getSize(bool askDriver = false);
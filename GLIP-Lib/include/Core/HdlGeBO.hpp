@@ -45,8 +45,9 @@
 					GLenum		buildTarget,
 							buildUsage;
 					GLsizeiptr 	size;
-					static bool 	binding[4];
-					static bool 	mapping[4];	// VS/CL will complain if these two are not splitted.
+					void*		persistentPointer;
+					static bool 	binding[5];
+					static bool 	mapping[5];	// VS/CL will complain if these two are not splitted.
 
 					// No copy constructor
 					HdlGeBO(const HdlGeBO&);
@@ -68,12 +69,16 @@
 					void* map(GLenum access = GL_NONE, GLenum target = GL_NONE);
 					void write(const void* data);
 					void subWrite(const void* data, GLsizeiptr size, GLintptr offset);
+					void orphan(void);
+					void* mapPersistent(GLenum access = GL_NONE);
+					bool isPersistentlyMapped(void) const;
 
 					// Static tools
 					static void unbind(GLenum target);
 					static void unmap(GLenum target);
 					static bool isBound(GLenum target);
 					static bool isMapped(GLenum target);
+					static bool isPersistentMappingAvailable(void);
 			};
 
 			/*
@@ -82,6 +87,7 @@
 			GL_ELEMENT_ARRAY_BUFFER_ARB
 			GL_PIXEL_UNPACK_BUFFER_ARB
 			GL_PIXEL_PACK_BUFFER_ARB
+			GL_UNIFORM_BUFFER
 
 			USAGE List
 			GL_STATIC_DRAW_ARB
@@ -32,6 +32,7 @@
 #define __HDLPBO_INCLUDE__
 
 	// GL include
+	#include <vector>
 	#include "Core/LibTools.hpp"
         #include "Core/OglInclude.hpp"
 	#include "Core/HdlGeBO.hpp"
@@ -66,7 +67,7 @@ How to use a PBO to upload data to a texture :
 	pbo.copyToTexture(someTexture);
 \endcode
 
-For reading operations, use Glip::Modules::PBOTextureReader.
+For reading operations, use Glip::Modules::AsyncTextureReader.
 **/
 			class GLIP_API HdlPBO : public HdlGeBO
 			{
@@ -96,6 +97,74 @@ For reading operations, use Glip::Modules::PBOTextureReader.
 					static void unbind(GLenum target=0);
 					static void unmap(GLenum target=0);
 			};
+
+/**
+\class HdlPBORing
+\brief Ring of Pixel Buffer Objects streaming data to textures (e.g. video frames).
+
+Each upload is written into the next slot of the ring while the GPU may still be copying the previous ones to their textures :
+\code
+	HdlTextureFormat fmt(1920, 1080, GL_RGB, GL_UNSIGNED_BYTE);
+	HdlTexture frame(fmt);
+	HdlPBORing ring(fmt, 3);
+
+	while(...)
+	{
+		void* ptr = ring.map();
+		decodeNextFrame(ptr);		// Write fmt.getSize() bytes.
+		ring.copyToTexture(frame);	// Returns without waiting for the transfer.
+
+		myPipeline << frame << Pipeline::Process;
+	}
+
+	std::cout << ring.getBandwidth()/1e6 << " MB/s, " << ring.getNumStalls() << " stalls." << std::endl;
+\endcode
+
+When available (see HdlGeBO::isPersistentMappingAvailable), the slots are persistently mapped once and for all, and a fence is placed after each copy. A slot is only written again once its fence is signaled, the waits are counted as stalls. Otherwise, the storage of the slot is orphaned before each mapping and the driver takes care of the synchronization.
+**/
+			class GLIP_API HdlPBORing
+			{
+				private :
+					// Data
+					std::vector<HdlPBO*>	slots;
+					std::vector<GLsync>	fences;
+					bool			persistent;
+					int			currentSlot,
+								nextSlot,
+								numUploads,
+								numStalls;
+					unsigned long long	uploadedBytes;
+					double			startTime,
+								lastTime,
+								stallTime;
+
+					// No copy :
+					HdlPBORing(const HdlPBORing&);
+					const HdlPBORing& operator=(const HdlPBORing&);
+
+					void waitSlot(int slot, bool count);
+					static double getTime(void);
+
+				public :
+					// Tools
+					HdlPBORing(const HdlAbstractTextureFormat& fmt, int numSlots=3, bool usePersistentMapping=true);
+					~HdlPBORing(void);
+
+					int getNumSlots(void) const;
+					GLsizeiptr getSlotSize(void) const;
+					bool isPersistent(void) const;
+					void* map(void);
+					void copyToTexture(HdlTexture& texture, int oX=0, int oY=0, int w=-1, int h=-1, GLenum mode=GL_NONE, GLenum depth=GL_NONE);
+					void write(HdlTexture& texture, const void* data);
+					void finish(void);
+
+					int getNumUploads(void) const;
+					int getNumStalls(void) const;
+					double getStallTime(void) const;
+					unsigned long long getUploadedBytes(void) const;
+					double getBandwidth(void) const;
+					void resetStatistics(void);
+			};
 		}
 	}
 
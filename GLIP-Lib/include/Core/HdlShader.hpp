@@ -29,8 +29,11 @@
         #include "Core/OglInclude.hpp"
         #include "Core/ShaderSource.hpp"
 	#include "Core/HdlDynamicData.hpp"
+	#include "Core/HdlGeBO.hpp"
 	#include <string>
         #include <fstream>
+	#include <map>
+	#include <vector>
 
 namespace Glip
 {
@@ -61,6 +64,37 @@ namespace Glip
 		/**
 		\class HdlProgram
 		\brief Object handle for OpenGL Program (A vertex and a fragment program).
+
+		The programs built from a list of sources are shared : the shaders are compiled and linked once for all the programs having identical sources and fragment locations (in the same process). Each of these objects keeps its own values of the uniform variables, which are uploaded again when it starts using the program after another one :
+		\code
+		std::map<GLenum, const ShaderSource*> sources;
+		sources[GL_FRAGMENT_SHADER] = &fragmentSource;
+
+		HdlProgram a(sources, std::vector<std::string>(1, "outputTexture")),
+			   b(sources, std::vector<std::string>(1, "outputTexture")); // Not compiled again.
+
+		a.setVar("gain", GL_FLOAT, 2.0f);
+		b.setVar("gain", GL_FLOAT, 0.5f);
+		a.use(); // gain is 2.0 again.
+		\endcode
+
+		The linked programs can also be kept on disk between runs (see HdlProgram::setBinaryCacheDirectory) :
+		\code
+		HdlProgram::setBinaryCacheDirectory("/tmp/glipCache");
+		// ... build the pipelines ...
+		std::cout << HdlProgram::getNumBinaryCacheHits() << " hit(s), " << HdlProgram::getNumBinaryCacheMisses() << " miss(es)." << std::endl;
+		\endcode
+
+		The members of the uniform blocks are accessed as the other variables (HdlProgram::setVar, HdlProgram::getVar). Each block is backed by a buffer, which is updated with a single call when the program is used. A buffer can also be shared by several programs, which then share the values of the block :
+		\code
+		// layout(std140) uniform Kernel { float weights[9]; };
+		HdlGeBO& kernel = a.getUniformBlockBuffer("Kernel");
+		b.setUniformBlockBuffer("Kernel", kernel);
+
+		// Update both programs (and mark both as modified, see HdlProgram::getModificationCount) :
+		HdlProgram::writeUniformBlockBuffer(kernel, weights, a.getUniformBlockSize("Kernel"));
+		\endcode
+		Writing directly to the buffer (HdlGeBO::subWrite) is not seen by the programs.
 		**/
 		class GLIP_API HdlProgram
 		{
@@ -68,6 +102,71 @@ namespace Glip
 				static const int numShaderTypes = 6; 
 
 			private :
+				// Active uniform variable :
+				struct UniformInfo
+				{
+					GLint	location;
+					GLenum	type;
+					GLint	size,
+						block,			// Index of the uniform block, -1 for the default block.
+						offset,			// Layout in the block, in bytes.
+						arrayStride,
+						matrixStride,
+						rowMajor;
+				};
+
+				// Copy of the data of a buffer backing uniform blocks, shared by all the programs using this buffer :
+				struct SharedBlock
+				{
+					std::vector<unsigned char>	data;
+					std::vector<HdlProgram*>	programs;
+				};
+
+				// Uniform block, with the copy of its data :
+				struct UniformBlock
+				{
+					std::string			name;
+					GLint				size;
+					HdlGeBO*			buffer;
+					bool				ownBuffer,
+									deferred,		// The writes are uploaded by HdlProgram::use (private buffer).
+									modified;
+					std::vector<unsigned char>	data;			// Private data, replaced by store->data when the buffer is shared.
+					SharedBlock*			store;
+				};
+
+				// Uniform value, saved for the shared programs :
+				struct UniformValue
+				{
+					GLenum	type;
+					GLint	location;
+					GLuint	words[16];
+				};
+
+				// Compiled program, shared by all the objects built from the same sources :
+				struct SharedProgram
+				{
+					unsigned long long			hash;
+					std::string				key;
+					GLuint					program;
+					HdlShader*				shaders[HandleOpenGL::numShaderTypes];
+					int					references;
+					HdlProgram*				owner;		// Object whose uniform values are currently loaded.
+					std::vector<std::string>		activeUniforms;
+					std::vector<GLenum>			activeTypes;
+					std::map<std::string, UniformInfo>	uniformsTable;
+					std::vector<UniformBlock>		uniformBlocks;
+					std::vector<std::string>		uniformBlocksNames;
+					std::map<GLint, UniformValue>		defaultValues;		// Indexed by location ("arr" and "arr[0]" share the same value).
+				};
+
+				static std::map<unsigned long long, SharedProgram*> sharedPrograms;
+				static std::map<const HdlGeBO*, SharedBlock*> sharedBlocks;
+				static std::string binaryCacheDirectory;
+				static int binaryCacheHits, binaryCacheMisses;
+				static const char binarySignature[8];
+				static bool errorChecking;
+
 				// Data
 				bool 				valid;
 				GLuint 				program;
@@ -75,10 +174,99 @@ namespace Glip
 								attachedFragmentShader;
 				std::vector<std::string>	activeUniforms;
 				std::vector<GLenum>		activeTypes;
+				std::map<std::string, UniformInfo>	uniformsTable;
+				std::vector<UniformBlock>	uniformBlocks;
+				std::vector<std::string>	uniformBlocksNames;
+				unsigned int			modificationCount,
+								linkCount;		// Incremented when the uniform variables are listed again (link).
+				HdlProgram*			master;			// Program owning the uniform variables, for views.
+				std::string			uniformsPrefix;
+				SharedProgram*			shared;
+				std::map<GLint, UniformValue>	uniformsValues;		// Indexed by location.
+
+				void notifyModification(void);
+				void acquire(void);
+				const UniformInfo* findUniform(const std::string& varName) const;
+				void setUniform(const std::string& varName, GLenum t, GLenum scalarType, const void* values, int maxNumWords);
+				void writeUniform(const std::string& varName, const UniformInfo& info, GLenum type, const void* values);
+				void writeUniform(const std::string& varName, const UniformInfo& info, const HdlDynamicData& data);
+				void writeBlockUniform(const std::string& varName, const UniformInfo& info, GLenum type, const void* values);
+				void readBlockUniform(const UniformInfo& info, void* values) const;
+				UniformBlock& findUniformBlock(const std::string& blockName, const std::string& caller);
+				void bindUniformBlocks(void);
+				void releaseUniformBlocks(void);
+				void attachBlockBuffer(UniformBlock& b);
+				void detachBlockBuffer(UniformBlock& b);
+				void uploadBlockData(UniformBlock& b, int offset, int size);
+				static std::vector<unsigned char>& getBlockData(UniformBlock& b);
+				static const std::vector<unsigned char>& getBlockData(const UniformBlock& b);
+				static bool isCompatibleUniformType(GLenum uniformType, GLenum type);
+				static int getNumWords(GLenum type);
+				static int getNumColumns(GLenum type);
+				static char getTypeCategory(GLenum type);
+				static bool isUniformBufferAvailable(void);
+				static bool isDirectAccessAvailable(void);
+				static void loadUniform(GLuint program, GLint location, GLenum type, const void* values);
+				static void releaseSharedProgram(SharedProgram* s);
+				void listActiveUniforms(void);
+				bool loadBinary(const std::string& filename, const std::string& binaryKey);
+				void saveBinary(const std::string& filename, const std::string& binaryKey);
+				static unsigned long long getHash(const std::string& key);
+				static bool isBinaryCacheAvailable(void);
 
 			public :
+				/**
+				\class Uniform
+				\brief Handle on a uniform variable of a program, for repeated writes without looking up the variable by its name.
+
+				The handle is typed : the values must match the type of the variable (integers for GL_INT*, GL_BOOL* and the samplers, unsigned integers for GL_UNSIGNED_INT* and floats for GL_FLOAT*). The variable is looked up once, when the handle is created, and again only if the program was linked since. The handle stays valid as long as the program is not destroyed. For the arrays, get a handle on each element (<i>name[i]</i>).
+				\code
+				HdlProgram::Uniform gain = filter.program().getUniform("gain");
+				for(int k=0; k<numFrames; k++)
+				{
+					gain.set(k * 0.01f);
+					(*pipeline) << input << Pipeline::Process;
+				}
+				\endcode
+				**/
+				class GLIP_API Uniform
+				{
+					private :
+						HdlProgram*	prgm;
+						std::string	name;
+						UniformInfo	info;
+						unsigned int	linkCount;
+
+						Uniform(HdlProgram& _prgm, const std::string& _name, const UniformInfo& _info);
+						void resolve(void);
+						void write(char category, const void* values, int numValues);
+
+						friend class HdlProgram;
+
+					public :
+						Uniform(void);
+
+						bool isValid(void) const;
+						const std::string& getName(void) const;
+						GLenum getType(void) const;
+						int getSize(void) const;
+
+						void set(int v0, int v1=0, int v2=0, int v3=0);
+						void set(unsigned int v0, unsigned int v1=0, unsigned int v2=0, unsigned int v3=0);
+						void set(float v0, float v1=0.0f, float v2=0.0f, float v3=0.0f);
+						void set(const int* v);
+						void set(const unsigned int* v);
+						void set(const float* v);
+						void set(const HdlDynamicData& data);
+				};
+
+				// Friends
+				friend class Uniform;
+
 				// Functions
 				HdlProgram(void);
+				HdlProgram(HdlProgram& _master, const std::string& _uniformsPrefix);
+				HdlProgram(const std::map<GLenum, const ShaderSource*>& sources, const std::vector<std::string>& fragmentLocations);
 				~HdlProgram(void);
 
 				bool isValid(void) const;
@@ -102,12 +290,35 @@ namespace Glip
 				void getVar(const std::string& varName, unsigned int* ptr);
 				void getVar(const std::string& varName, float* ptr);
 				void getVar(const std::string& varName, HdlDynamicData& data);
+				Uniform getUniform(const std::string& varName);
+				int copyVars(HdlProgram& source);
 
 				bool isUniformVariableValid(const std::string& varName);
+				int getUniformOffset(const std::string& varName);
+
+				const std::vector<std::string>& getUniformBlocksNames(void) const;
+				int getUniformBlockSize(const std::string& blockName);
+				HdlGeBO& getUniformBlockBuffer(const std::string& blockName);
+				void setUniformBlockBuffer(const std::string& blockName, HdlGeBO& buffer);
+				void setUniformBlockData(const std::string& blockName, const void* data);
+				static void writeUniformBlockBuffer(HdlGeBO& buffer, const void* data, int size, int offset = 0);
+				unsigned int getModificationCount(void) const;
+				bool isView(void) const;
+				const std::string& getUniformsPrefix(void) const;
+				bool isShared(void) const;
 	
 				// Static tools :
 				static int maxVaryingVar(void);
 				static void stopProgram(void);
+				static int getNumSharedPrograms(void);
+				static void enableErrorChecking(void);
+				static void disableErrorChecking(void);
+				static bool isErrorCheckingEnabled(void);
+				static void setBinaryCacheDirectory(const std::string& directory);
+				static const std::string& getBinaryCacheDirectory(void);
+				static int getNumBinaryCacheHits(void);
+				static int getNumBinaryCacheMisses(void);
+				static void resetBinaryCacheCounters(void);
 		};
 	}
 }
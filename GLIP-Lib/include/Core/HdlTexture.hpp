@@ -25,6 +25,7 @@
 #define __HDLTEXTURE_INCLUDE__
 
 	// Include
+	#include <list>
 	#include "Core/LibTools.hpp"
 	#include "Core/OglInclude.hpp"
 	#include "Core/HdlTextureTools.hpp"
@@ -49,6 +50,8 @@
 					int	width, height; 						// Image parameters.
 					GLenum	mode, depth, minFilter, magFilter, wraps, wrapt;  	// Image format, texture filtering and wrapping modes.
 					int	baseLevel, maxLevel;                			// MipMap information.	
+					GLenum	target;							// Texture target (GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY or GL_TEXTURE_3D).
+					int	numLayers;						// Number of layers (or slices), 1 for GL_TEXTURE_2D.
 
 					// Protected constructors : 
 					HdlAbstractTextureFormat(int _width, int _height, GLenum _mode, GLenum _depth, GLenum _minFilter = GL_NEAREST, GLenum _magFilter = GL_NEAREST, GLenum _wraps = GL_CLAMP_TO_EDGE, GLenum _wrapt = GL_CLAMP_TO_EDGE, int _baseLevel = 0, int _maxLevel = 0);
@@ -78,6 +81,9 @@
 					int	getMaxLevel	(void) const;
 					GLenum	getSWrapping	(void) const;
 					GLenum	getTWrapping	(void) const;
+					GLenum	getGLTarget	(void) const;
+					int	getNumLayers	(void) const;
+					bool	isLayered	(void) const;
 					bool	isCompressed	(void) const;
 					bool	isFloatingPoint	(void) const;
 
@@ -122,6 +128,9 @@
 					void setMaxLevel (int l);
 					void setSWrapping(GLenum m);
 					void setTWrapping(GLenum m);
+					void setGLTarget (GLenum t);
+					void setNumLayers(int n);
+					void setLayers   (GLenum t, int n);
 
 					const HdlAbstractTextureFormat& operator=(const HdlAbstractTextureFormat&);
 
@@ -140,7 +149,9 @@
 				private :
 					// Data
 					GLuint texID;
-					bool proxy;
+					bool proxy,
+					     immutable;
+					unsigned int modificationCount;
 
 					// Functions
 					HdlTexture(const HdlTexture&); // No-copy
@@ -153,10 +164,13 @@
 
 					GLuint	getID(void) const;
 					bool	isProxy(void) const;
+					bool	isImmutable(void) const;
 					int	getSizeOnGPU(int m=0);
 					void	bind(GLenum unit=GL_TEXTURE0); // previously GL_TEXTURE0_ARB, for GLES compatibility.
 					void	bind(int unit);
-					void	write(GLvoid *texData, GLenum pixelFormat = GL_ZERO, GLenum pixelDepth = GL_ZERO, int alignment=-1);
+					void	write(const GLvoid *texData, GLenum pixelFormat = GL_ZERO, GLenum pixelDepth = GL_ZERO, int alignment=-1);
+					void	writeRegion(int x, int y, int w, int h, const GLvoid *texData, int rowLength=0, GLenum pixelFormat = GL_ZERO, GLenum pixelDepth = GL_ZERO, int alignment=-1);
+					void	writeLayer(int layer, const GLvoid *texData, GLenum pixelFormat = GL_ZERO, GLenum pixelDepth = GL_ZERO, int alignment=-1);
 					void	writeCompressed(GLvoid *texData, int size, GLenum pixelFormat = GL_ZERO, GLenum pixelDepth = GL_ZERO, int alignment=-1);
 					void	fill(char dataByte);
 					void	read(GLvoid *data, GLenum pixelFormat = GL_ZERO, GLenum pixelDepth = GL_ZERO, int alignment=-1);
@@ -168,6 +182,9 @@
 					void	setTWrapping(GLenum m);
 					void 	setSetting(GLenum param, unsigned int value);
 
+					unsigned int getModificationCount(void) const;
+					void	markAsModified(void);
+
 					const HdlAbstractTextureFormat& format(void) const;
 
 					// Static Textures tools
@@ -175,6 +192,49 @@
 					static void unbind(int unit);
 					static int  getMaxImageUnits(void);
 			};
+
+			// Texture pool
+			/**
+			\class HdlTexturePool
+			\brief Pool of idle textures, shared by all the pipelines (and the user code).
+
+			The textures released to the pool are kept (up to a budget, in bytes) and given back by the next acquisitions of the same format, instead of being deleted and allocated again. The render targets of the HdlFBO objects (thus the buffers of the pipelines) go through the pool. The pool is disabled by default (zero budget) :
+			\code
+				HdlTexturePool::setBudget(256*1024*1024);
+
+				HdlTexture* texture = HdlTexturePool::acquire(format);
+				// ...
+				HdlTexturePool::release(texture);
+
+				std::cout << "Hit rate : " << HdlTexturePool::getHitRate() << ", resident : " << HdlTexturePool::getResidentBytes() << " bytes." << std::endl;
+			\endcode
+			When the budget is exceeded, the least recently released textures are deleted. The content of an acquired texture is undefined.
+			**/
+			class GLIP_API HdlTexturePool
+			{
+				private :
+					static std::list<HdlTexture*>	idleTextures;		// From the least to the most recently released.
+					static size_t			budget,
+									residentBytes;
+					static unsigned int		numHits,
+									numMisses;
+
+					HdlTexturePool(void);
+
+				public :
+					static HdlTexture* acquire(const HdlAbstractTextureFormat& fmt);
+					static void release(HdlTexture* texture);
+					static void trim(size_t maxBytes);
+					static void clear(void);
+					static void setBudget(size_t bytes);
+					static size_t getBudget(void);
+					static size_t getResidentBytes(void);
+					static int getNumResidentTextures(void);
+					static unsigned int getNumHits(void);
+					static unsigned int getNumMisses(void);
+					static double getHitRate(void);
+					static void resetStatistics(void);
+			};
 		}
 	}
 
@@ -45,7 +45,7 @@
 
 				/// Name of the mode (GL_RGB, GL_RGBA, etc.).
 				const GLenum	mode,
-				/// Name of the alias mode (simplified mode, GL_RGB, GL_RGBA, etc.).
+				/// Name of the alias mode (simplified mode, GL_RGB, GL_RGBA, etc. or GL_RGB_INTEGER, GL_RGBA_INTEGER, etc. for the integer formats), used as pixel format in the transfers.
 						aliasMode,
 				/// Name of the corresponding uncompressed mode (the same as mode if not a compressed format).
 						uncompressedMode,
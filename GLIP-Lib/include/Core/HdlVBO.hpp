@@ -37,9 +37,40 @@
 			/**
 			\class HdlVBO
 			\brief Object handle for OpenGL Vertex Buffer Objects.
+
+			When vertex array objects are available, the arrays are set once at construction in a vertex array object, which is the only binding needed by each draw call. The data is then exposed as generic vertex attributes at fixed locations (see HdlVBO::positionLocation, HdlVBO::normalLocation and HdlVBO::texCoordLocation), bound to the names HdlVBO::positionAttributeName, HdlVBO::normalAttributeName and HdlVBO::texCoordAttributeName in every HdlProgram. In a compatibility profile, it is also exposed through the legacy arrays (gl_Vertex, gl_Normal, gl_MultiTexCoord0). For a core profile context, the vertex shaders must use the generic attributes :
+			\code
+			#version 150
+			in vec4 vertexPosition;
+			in vec2 vertexTexCoord;
+			out vec2 texCoord;
+
+			void main()
+			{
+				texCoord = vertexTexCoord;
+				gl_Position = vertexPosition;
+			}
+			\endcode
+
+			An attribute-less object (see HdlVBO::HdlVBO(int)) holds no data and only draws a number of points, the vertex shader deriving their positions from gl_VertexID (and gl_InstanceID).
 			**/
 			class GLIP_API HdlVBO
 			{
+				public :
+					/// Location of the generic vertex attribute containing the positions.
+					static const GLuint positionLocation = 0;
+					/// Location of the generic vertex attribute containing the normals (same as the alias of gl_Normal on some drivers).
+					static const GLuint normalLocation = 2;
+					/// Location of the generic vertex attribute containing the texture coordinates (same as the alias of gl_MultiTexCoord0 on some drivers).
+					static const GLuint texCoordLocation = 8;
+
+					/// Name of the vertex shader input bound to HdlVBO::positionLocation.
+					static const std::string positionAttributeName;
+					/// Name of the vertex shader input bound to HdlVBO::normalLocation.
+					static const std::string normalAttributeName;
+					/// Name of the vertex shader input bound to HdlVBO::texCoordLocation.
+					static const std::string texCoordAttributeName;
+
 				private :
 					int	nVert,
 						nElements,
@@ -53,19 +84,29 @@
 						offsetNormals,
 						offsetTexCoords;
 					GLenum 	type;
+					GLuint	vertexArray;
+
+					void setArrays(bool legacy);
+					void drawElements(int numInstances);
 
 				public :
 					HdlVBO(int _nVert, int _dim, GLenum freq, const GLfloat* _vertices, int _nElements=0, int _nIndPerElement=0, const GLuint* _elements=NULL, GLenum _type=GL_POINTS, const GLfloat* _normals=NULL, int _dimTexCoords=0, const GLfloat* _texcoords=NULL);
+					explicit HdlVBO(int _nVert);
 					~HdlVBO(void);
 
 					int    getVerticesCount(void);
 					int    getShapeDimension(void);
 					int    getElementsCount(void);
 					GLenum getType(void);
+					bool   hasVertexArray(void) const;
+					bool   isAttributeLess(void) const;
 					void   draw(void);
+					void   drawInstanced(int numInstances);
 
 					static void    unbind(void);
 					static void    unmap(void);
+					static bool    isVertexArrayAvailable(void);
+					static bool    isInstancingAvailable(void);
 			};
 		}
 	}
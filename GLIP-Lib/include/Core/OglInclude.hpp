@@ -26,6 +26,7 @@
 
 	#include <iostream>
 	#include <vector>
+	#include <map>
 	#include "devDebugTools.hpp"
 	#include "Core/LibTools.hpp"
 
@@ -307,6 +308,16 @@
 			/**
 			\class HandleOpenGL
 			\brief Main OpenGL Handle.
+
+			The handle also carries a state tracker : the core objects (HdlProgram, HdlFBO, HdlTexture, Filter) set the program, framebuffer, texture units, viewport and fixed states through it. Inside a tracking scope (for instance during Pipeline::process) the calls which would not change the current state are skipped, and the unbinding calls are deferred to the end of the scope :
+			\code
+				HandleOpenGL::resetStateCallsCounters();
+
+				myPipeline << input << Pipeline::Process;
+
+				std::cout << HandleOpenGL::getNumSkippedStateCalls() << " state changes skipped, " << HandleOpenGL::getNumIssuedStateCalls() << " issued." << std::endl;
+			\endcode
+			The OpenGL states must not be modified outside of the tracker inside a tracking scope.
 			**/
 			class GLIP_API HandleOpenGL
 			{
@@ -337,9 +348,39 @@
 						const std::string 	name;
 					};
 
+					// State tracker :
+					struct GLIP_API StateCache
+					{
+						int				depth;			// Nesting of the tracking scopes (0 if disabled).
+						GLuint				program,
+										framebuffer,
+										activeUnit;
+						std::vector<GLuint>		textures;		// Texture bound on each unit.
+						std::vector<GLenum>		textureTargets;		// Target of the texture bound on each unit.
+						std::vector<GLuint>		uniformBuffers;		// Buffer bound on each uniform block binding point.
+						std::map<GLuint, int>		drawBuffers;		// Number of draw buffers set on each framebuffer.
+						GLint				viewport[4];
+						int				depthTest,		// -1 if unknown, 0 if disabled, 1 if enabled.
+										blend;
+						GLenum				depthFunction,
+										blendSFactor,
+										blendDFactor,
+										blendEquation;
+						bool				clearColorKnown,
+										identityLoaded;
+						GLfloat				clearColor[4];
+						unsigned int			issuedCalls,
+										skippedCalls;
+
+						StateCache(void);
+						void invalidate(void);
+					};
+
 					static HandleOpenGL		*instance;
 					static SupportedVendor 		vendor;
 					static const KeywordPair 	glKeywords[];
+					static StateCache		stateCache;
+					static bool			coreProfile;
 
 				public :
 					HandleOpenGL(void);
@@ -356,6 +397,32 @@
 					static std::string getGLSLVersion(void);
 					static std::vector<std::string> getAvailableGLSLVersions(void);
 					static unsigned int getShaderTypeIndex(GLenum shaderType);
+					static bool isCoreProfile(void);
+
+					// State tracker :
+					static void beginStateTracking(void);
+					static void endStateTracking(void);
+					static bool isStateTrackingEnabled(void);
+					static void useProgram(GLuint program);
+					static void bindFramebuffer(GLuint framebuffer);
+					static void setDrawBuffers(GLuint framebuffer, int count);
+					static void setViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+					static bool bindTexture(unsigned int unit, GLuint texture, GLenum target = GL_TEXTURE_2D);
+					static bool bindTexture(GLuint texture);
+					static bool bindTextureTarget(GLenum target, GLuint texture);
+					static void setCapability(GLenum capability, bool enabled);
+					static void setDepthFunction(GLenum function);
+					static void setBlending(GLenum sFactor, GLenum dFactor, GLenum equation);
+					static void setClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+					static void loadIdentity(void);
+					static void bindUniformBuffer(unsigned int index, GLuint buffer);
+					static void forgetProgram(GLuint program);
+					static void forgetFramebuffer(GLuint framebuffer);
+					static void forgetTexture(GLuint texture);
+					static void forgetBuffer(GLuint buffer);
+					static unsigned int getNumIssuedStateCalls(void);
+					static unsigned int getNumSkippedStateCalls(void);
+					static void resetStateCallsCounters(void);
 
 					// Friend functions :
 					GLIP_API friend std::string getGLEnumName(const GLenum& p);
@@ -28,6 +28,7 @@
 	#include <ctime>
 	#include <algorithm>
 	#include <map>
+	#include <deque>
 	#include <limits>
 	#include "Core/LibTools.hpp"
         #include "Core/Component.hpp"
@@ -216,6 +217,32 @@ How to process the inputs :
 	outputDevice << myPipeline.out(0);
 \endcode
 
+When only some of the outputs of a (large) layout are needed, the filters which do not contribute to the output ports can be removed at construction :
+\code
+	Pipeline myPipeline(myPipelineLayout, "InstanceName", Pipeline::PruneUnusedFilters);
+
+	// List the filters removed :
+	const std::vector<std::string>& pruned = myPipeline.getPrunedFilters();
+\endcode
+
+Chains of filters reading their input only at the current fragment (color transforms, curves, etc.) can be merged into a single shader pass, saving the intermediate buffers and their bandwidth. The uniform variables of the merged filters are still accessed through their original IDs :
+\code
+	Pipeline myPipeline(myPipelineLayout, "InstanceName", Pipeline::PruneUnusedFilters | Pipeline::FusePointwiseFilters);
+
+	// Still valid, even if "Filter" was merged with its consumer :
+	myPipeline[id].program().setVar("variable", GL_FLOAT, 3.1415f);
+\endcode
+Only the fragment shaders with the standard geometry, without blending or depth testing, and sharing the same output format can be merged. The producer must have a single output (out vec4), read by a single consumer with texelFetch(input, ivec2(gl_FragCoord.xy), 0) or texture/textureLod at gl_FragCoord.xy/vec2(format) (see ShaderSource::isPointwiseInput). The intermediate results are clamped and quantized as if they were stored in the texture (except for the half-float formats, which keep the full precision), the results might still differ by one quantization step.
+
+When only the formats of a layout change (for instance the script loaded again with other required formats), the pipeline can be adapted instead of being built again. Only the buffers are reallocated, and only the filters whose shaders changed (such as the ones embedding the size of their output) are compiled again :
+\code
+	loader.addRequiredElement("inputFormat", newImage.format());
+	AbstractPipelineLayout newLayout = loader.getPipelineLayout("pipeline.ppl");
+
+	int numRecompiled = myPipeline.reformat(newLayout);
+	const std::vector<std::string>& recompiled = myPipeline.getRecompiledFilters();
+\endcode
+
 How to access and modify a uniform variable in a filter : 
 \code
 	// Find the global ID of the targeted filter : 
@@ -257,6 +284,81 @@ the buffers cell which represents the needed buffers for one full computation. A
 		}
 	}
 \endcode
+
+Incremental processing : when only some inputs or uniform variables change between two runs, the actions which are not affected can be skipped (their outputs being kept in the buffers cell). An action is applied again if one of its inputs was modified (see HdlTexture::getModificationCount), if its program was modified (see HdlProgram::getModificationCount) or if one of the actions providing its arguments was applied again. Filters which depend on other states (blending into their previous output, time...) should not be used in this mode.
+\code
+	myPipeline.enableIncrementalProcessing();
+
+	myPipeline << input1 << input2 << ... << Pipeline::Process;	// All the actions are applied.
+
+	myPipeline[id].program().setVar("variable", GL_FLOAT, 3.1415);
+	myPipeline << input1 << input2 << ... << Pipeline::Process;	// Only the actions depending on the filter id are applied.
+
+	std::cout << myPipeline.getNumProcessedActions() << " actions applied over " << myPipeline.getNumActions() << std::endl;
+\endcode
+
+Performance monitoring : when timer queries are available (OpenGL 3.3), the results of a run are collected during one of the following runs, without stalling the CPU. Check for their availability before reading them :
+\code
+	myPipeline.enablePerfsMonitoring();
+
+	// Main loop :
+	myPipeline << input1 << input2 << ... << Pipeline::Process;
+
+	if(myPipeline.isTimingReady())
+		std::cout << "Last measured frame took " << myPipeline.getTotalTiming() << " ms." << std::endl;
+\endcode
+
+Batch processing : to apply the same pipeline over many (small) sets of inputs, each filter can be applied on all the sets before moving to the next one. The program and rendering states are then set once per filter instead of once per set. Each set writes into its own buffers cell :
+\code
+	std::vector< std::vector<HdlTexture*> > inputs(numImages);
+	std::vector<int> cellIDs(numImages);
+
+	for(int k=0; k<numImages; k++)
+	{
+		inputs[k].push_back(&images[k]);
+		cellIDs[k] = (k==0) ? myPipeline.getCurrentCellID() : myPipeline.createBuffersCell();
+	}
+
+	myPipeline.processBatch(inputs, cellIDs);
+
+	for(int k=0; k<numImages; k++)
+		outputDevice << myPipeline.out(0, cellIDs[k]);
+\endcode
+
+Asynchronous processing : Pipeline::Process only submits the commands to the driver, the results are ready when the GPU is done. Instead, processAsync returns a ticket which can be tested without blocking (the host thread can prepare the next inputs and uniform variables meanwhile). Combined with several buffers cells, a few runs can be kept in flight :
+\code
+	int cells[2] = {myPipeline.getCurrentCellID(), myPipeline.createBuffersCell()},
+	    tickets[2] = {0, 0};
+
+	for(int k=0; k<numLoops; k++)
+	{
+		const int c = k%2;
+
+		// Make sure the results previously rendered in this cell were consumed :
+		if(tickets[c]>0)
+		{
+			myPipeline.wait(tickets[c]);
+			outputDevice << myPipeline.out(0, cells[c]);
+		}
+
+		// Prepare the inputs of this run :
+		...
+
+		myPipeline.changeTargetBuffersCell(cells[c]);
+		myPipeline << input1 << input2 << ...;
+		tickets[c] = myPipeline.processAsync();
+	}
+\endcode
+
+Timeline : the pipeline can also record, for its last runs, the CPU submission and GPU execution of each action as well as inputs binding, FBO switches and mipmaps generation (Pipeline::processBatch only records the submission and execution of each action, for the whole batch). The result is exported in the Chrome trace event format (JSON, which can be loaded in chrome://tracing) :
+\code
+	myPipeline.enableTimeline(100); // Keep the last 100 runs.
+
+	for(int k=0; k<numLoops; k++)
+		myPipeline << input1 << input2 << ... << Pipeline::Process;
+
+	myPipeline.saveTimeline("timeline.json");
+\endcode
 **/
 			class GLIP_API Pipeline : public AbstractPipelineLayout, public Component
 			{
@@ -270,11 +372,26 @@ the buffers cell which represents the needed buffers for one full computation. A
 						Reset
 					};
 
+					///Build options, can be combined (bitwise OR).
+					enum BuildOption
+					{
+						///No optimization, all the filters of the layout are built.
+						DefaultBuild		= 0,
+						///Remove the filters whose outputs never reach an output port of the pipeline (their buffers are not allocated and their shaders are not compiled).
+						PruneUnusedFilters	= 1,
+						///Merge the chains of filters reading their input only at the current fragment into a single filter (see ShaderSource::isPointwiseInput).
+						FusePointwiseFilters	= 2
+					};
+
+					///Number of frames which can be monitored simultaneously before the oldest timer queries get recycled.
+					static const int numPerfsQueriesFrames = 4;
+
 				private :
 					struct ActionHub
 					{
 						std::vector<int> 		inputBufferIdx;		// The index of the buffer providing the argument k.
 						std::vector<int> 		inputArgumentIdx;	// The index of the output providing the argument k.
+						std::vector<int>		inputActionIdx;		// The index of the action providing the argument k (or THIS_PIPELINE).
 						int				bufferIdx;		// The index of the buffer to use for output.
 						int				filterIdx;		// The index of the filter.
 					};
@@ -283,6 +400,16 @@ the buffers cell which represents the needed buffers for one full computation. A
 					{
 						int 				bufferIdx;		// The index of the targeted buffer holding the input.
 						int				outputIdx;		// The index of the output for this buffer which has to be used.
+						int				actionIdx;		// The index of the action writing the output.
+					};
+
+					struct FusedFilterMember
+					{
+						AbstractFilterLayout*		layout;
+						std::string			name,
+										uniformsPrefix;		// Prefix of its uniform variables in the program of the host.
+						int				hostIdx,		// The index of the fused filter.
+										globalID;
 					};
 
 					struct BufferFormatsCell
@@ -294,14 +421,40 @@ the buffers cell which represents the needed buffers for one full computation. A
 						void append(const HdlAbstractTextureFormat& fmt, int count);
 					};
 
+					struct ActionState
+					{
+						bool				valid;			// The action was rendered in the cell.
+						unsigned int			programState,		// Modification count of the program at the last rendering.
+										generation;		// Generation of the outputs of the action.
+						std::vector<const HdlTexture*>	inputs;			// The inputs of the pipeline used at the last rendering (NULL for the arguments coming from other actions).
+						std::vector<unsigned int>	inputsStates;		// Modification count of these inputs or generation of the actions providing the arguments.
+					};
+
 					struct BuffersCell
 					{
 						std::vector<HdlFBO*>		buffersList;
+						std::vector<int>		buffersOwners;		// The index of the action whose outputs are currently in the buffer (-1 if unknown).
+						std::vector<ActionState>	actionsStates;		// For incremental processing.
+						unsigned int			generationCounter;
 		
 						BuffersCell(const BufferFormatsCell& bufferFormats);
 						~BuffersCell(void);
 					};
 
+					struct TimelineEvent
+					{
+						std::string			name,
+										category;
+						bool				gpu,			// Event measured on the GPU timeline (with timestamp queries).
+										instant;		// Event without duration.
+						int				frame,
+										action;
+						GLint64				begin,			// In nanoseconds.
+										end;
+						GLuint				beginQuery,		// Pending queries, 0 once resolved.
+										endQuery;
+					};
+
 					// Data
 					std::vector<HdlTexture*> 		inputsList;
 					BufferFormatsCell			bufferFormats;
@@ -311,19 +464,55 @@ the buffers cell which represents the needed buffers for one full computation. A
 					std::vector<ActionHub>			actionsList;
 					std::vector<OutputHub>			outputsList;
 					std::map<int, int>			filtersGlobalIDsList;
+					std::vector<std::string>		prunedFiltersList;
+					std::vector<std::string>		recompiledFiltersList;	// Filters rebuilt by the last call to reformat.
+					int					buildFlags;
+					std::vector<Filter*>			fusedMembersList;	// Filters merged into others, only used to access their uniform variables.
+					std::map<int, int>			fusedMembersGlobalIDsList;
+					std::vector<int>			fusedMembersHostsList;	// Index of the filter hosting each member.
 
 					bool 					firstRun,
 										broken,
-										perfsMonitoring;
-					GLuint					queryObject;
+										perfsMonitoring,
+										incrementalProcessing;
+					int					numProcessedActions;
+					std::vector<GLuint>			queryObjects;		// Timer queries, numPerfsQueriesFrames slots of actionsList.size() queries.
+					std::vector<bool>			queryPending;		// Slot is waiting for its results.
+					int					queryCurrentSlot;
+					bool					perfsReady;
 					std::vector<double>			perfs;
 					double					totalPerf;
+					bool					timelineRecording;
+					int					timelineMaxFrames,
+										timelineFrame;
+					std::deque<TimelineEvent>		timelineEvents;
+					std::vector<GLuint>			timelineQueries;	// Timestamp queries of the resolved events, reused by the following runs.
+					int					ticketsCounter;
+					std::map<int, GLsync>			pendingTickets;		// Fences of the asynchronous runs not known to be completed yet.
 
 					// Tools
 					Pipeline(const AbstractPipelineLayout& p, const std::string& name, bool fake);
 					void cleanInput(void);
-					void build(int& currentIdx, std::vector<Filter*>& filters, std::map<int, int>& filtersGlobalID, std::vector<Connection>& connections, AbstractPipelineLayout& originalLayout);
+					void build(int& currentIdx, std::vector<AbstractFilterLayout*>& filterLayouts, std::vector<std::string>& filterNames, std::map<int, int>& filtersGlobalID, std::vector<Connection>& connections, AbstractPipelineLayout& originalLayout);
+					bool isActionOutputHeld(const std::vector<bool>& runList, int action, int until) const;
+					void pruneFilters(std::vector<AbstractFilterLayout*>& filterLayouts, std::vector<std::string>& filterNames, std::vector<Connection>& connections);
+					void fuseFilters(int& currentIdx, std::vector<AbstractFilterLayout*>& filterLayouts, std::vector<std::string>& filterNames, std::vector<Connection>& connections, std::vector<FusedFilterMember>& members);
+					static bool isFusableFilterLayout(const AbstractFilterLayout& layout);
+					static bool haveSameSources(const AbstractFilterLayout& a, const AbstractFilterLayout& b);
+					static bool haveSameSettings(const AbstractFilterLayout& a, const AbstractFilterLayout& b);
+					static std::string getStoreConversion(const HdlAbstractTextureFormat& format);
+					static int getFilterHalo(const AbstractFilterLayout& layout, int declaredHalo, int defaultHalo);
 					void allocateBuffers(std::vector<Connection>& connections);
+					void releasePerfsQueries(void);
+					void collectPerfsQueries(void);
+					void addTimelineEvent(const std::string& name, const std::string& category, int action, GLint64 begin, GLint64 end=-1);
+					void addTimelineGPUEvent(const std::string& name, const std::string& category, int action, GLuint beginQuery, GLuint endQuery);
+					GLuint acquireTimelineQuery(void);
+					void releaseTimelineEvent(TimelineEvent& e);
+					GLint64 beginTimelineFrame(void);
+					void resolveTimelineEvents(bool wait);
+					void clearTimeline(void);
+					void releaseTickets(void);
 
 				protected :
 					// Tools
@@ -331,11 +520,16 @@ the buffers cell which represents the needed buffers for one full computation. A
 
 				public :
 					// Tools
-					Pipeline(const AbstractPipelineLayout& p, const std::string& name);
+					Pipeline(const AbstractPipelineLayout& p, const std::string& name, int buildOptions = DefaultBuild);
 					~Pipeline(void);
 
 					int 			getNumActions(void) const;
+					const std::vector<std::string>& getPrunedFilters(void) const;
+					int			reformat(const AbstractPipelineLayout& p);
+					const std::vector<std::string>& getRecompiledFilters(void) const;
 					int 			getSize(bool askDriver = false);
+					int			getNaiveSize(void) const;
+					int			getHalo(const std::map<int, int>& filtersHalos, int defaultHalo = -1);
 
 					Pipeline& 		operator<<(HdlTexture& texture);
 					Pipeline& 		operator<<(Pipeline& pipeline);
@@ -346,6 +540,12 @@ the buffers cell which represents the needed buffers for one full computation. A
 					bool 			wentThroughFirstRun(void) const;
 					bool 			isBroken(void) const;
 
+					void			processBatch(const std::vector< std::vector<HdlTexture*> >& inputs, const std::vector<int>& cellIDs);
+					int			processAsync(void);
+					bool			isComplete(int ticket);
+					bool			wait(int ticket, double timeout = -1.0);
+					int			getNumPendingTickets(void) const;
+
 					int			createBuffersCell(void);
 					int			getNumBuffersCells(void) const;
 					bool			isBuffersCellValid(int cellID) const;
@@ -354,11 +554,23 @@ the buffers cell which represents the needed buffers for one full computation. A
 					void			changeTargetBuffersCell(int cellID);
 					void			removeBuffersCell(int cellID);
 
+					void			enableIncrementalProcessing(void);
+					void			disableIncrementalProcessing(void);
+					bool			isIncrementalProcessingEnabled(void) const;
+					int			getNumProcessedActions(void) const;
+
 					void 			enablePerfsMonitoring(void);
 					void 			disablePerfsMonitoring(void);
+					bool			isTimingReady(void);
 					double			getTiming(int filterID);
 					double 			getTiming(int action, std::string& filterName);
 					double 			getTotalTiming(void);
+
+					void			enableTimeline(int maxFrames = 256);
+					void			disableTimeline(void);
+					bool			isTimelineEnabled(void) const;
+					std::string		getTimeline(void);
+					void			saveTimeline(const std::string& filename);
 			};
 		}
 	}
@@ -51,6 +51,22 @@ ShaderSource src(myShader);
 \endcode
 
 The shader source will be parsed to find input and output ports name. In the case that you are using gl_FragColor, the name of the output port will be the one contained by string ShaderSource::portNameForFragColor.
+
+A compute shader (declaring its work group size with <i>layout(local_size_x=...) in;</i>) has its output ports declared as image uniforms (image2D, iimage2D or uimage2D) :
+\code
+#version 430
+layout(local_size_x = 16, local_size_y = 16) in;
+uniform sampler2D inputTexture;
+layout(rgba32f) uniform writeonly image2D outputTexture;
+
+void main()
+{
+	const ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+	if(any(greaterThanEqual(pos, imageSize(outputTexture))))
+		return ;
+	imageStore(outputTexture, pos, 1.0 - texelFetch(inputTexture, pos, 0));
+}
+\endcode
 **/
 			class GLIP_API ShaderSource
 			{
@@ -71,6 +87,23 @@ The shader source will be parsed to find input and output ports name. In the cas
 					};
 
 				private :
+					struct Token
+					{
+						enum Kind
+						{
+							Identifier,
+							Number,
+							Symbol,
+							Blank,		// White spaces and comments.
+							Directive	// Full preprocessor line.
+						};
+
+						Kind 		kind;
+						std::string	str;
+
+						Token(Kind _kind, const std::string& _str);
+					};
+
 					// Data
 					std::string 			source,
 									sourceName;
@@ -79,10 +112,13 @@ The shader source will be parsed to find input and output ports name. In the cas
 					std::vector<std::string> 	inSamplers2D;
 					std::vector<std::string> 	uniformVars;
 					std::vector<GLenum>		uniformVarsType;
+					std::vector<std::string>	uniformBlocks;
 					std::vector<std::string> 	outFragments;
+					std::vector<GLenum>		outFragmentsType;
 					bool 				compatibilityRequest;
 					int 				versionNumber,
-									startLine;
+									startLine,
+									workGroupSize[3];
 
 					// Tools :
 					void parseLines(void);
@@ -90,7 +126,19 @@ The shader source will be parsed to find input and output ports name. In the cas
 					void wordSplit(const std::string& line, std::vector<std::string>& split);
 					GLenum parseUniformTypeCode(const std::string& str, const std::string& cpl);
 					GLenum parseOutTypeCode(const std::string& str, const std::string& cpl);
+					static bool isImageType(GLenum typeCode);
 					void parseCode(void);
+					bool isFragCoordExpression(const std::vector<Token>& tokens, int begin, int end, const std::string& inputName, int width, int height, bool followVariables) const;
+					static bool isSizeConstant(const std::vector<Token>& tokens, const std::string& name, int width, int height);
+
+					static void tokenize(const std::string& code, std::vector<Token>& tokens);
+					static int nextToken(const std::vector<Token>& tokens, int k);
+					static int previousToken(const std::vector<Token>& tokens, int k);
+					static int splitArguments(const std::vector<Token>& tokens, int k, std::vector<std::pair<int, int> >& arguments);
+					static int findStatementStart(const std::vector<Token>& tokens, int k);
+					static std::string join(const std::vector<Token>& tokens, int begin, int end, bool withBlanks = false);
+					static bool isReservedName(const std::string& name);
+					static std::string renameToken(const std::vector<Token>& tokens, int k, const std::string& prefix, const std::vector<std::string>& keptNames);
 
 				public :
 					/// Name for the port mapping to gl_FragColor, if used.
@@ -115,11 +163,18 @@ The shader source will be parsed to find input and output ports name. In the cas
 					Exception errorLog(const std::string& log) const;
 					bool requiresCompatibility(void) const;
 					int getVersion(void) const;
+					bool isComputeSource(void) const;
+					void getWorkGroupSize(int& x, int& y, int& z) const;
 
 					const std::vector<std::string>& getInputVars(void) const;
 					const std::vector<std::string>& getOutputVars(void) const;
 					const std::vector<std::string>& getUniformVars(void) const;
 					const std::vector<GLenum>& getUniformTypes(void) const;
+					const std::vector<std::string>& getUniformBlocks(void) const;
+					const std::vector<GLenum>& getOutputTypes(void) const;
+					bool isPointwiseInput(const std::string& inputName, int width, int height) const;
+
+					static ShaderSource fuse(const std::vector<const ShaderSource*>& sources, const std::vector<std::string>& prefixes, const std::vector<int>& consumers, const std::vector<std::string>& consumedInputs, int width, int height, const std::string& storeConversion, const std::string& _sourceName="");
 			};
 		}
 	}
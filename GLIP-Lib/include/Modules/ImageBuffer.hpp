@@ -26,10 +26,13 @@
 
 	// Includes
 	#include <limits>
+	#include <map>
+	#include <vector>
 	#include "Core/LibTools.hpp"
 	#include "Core/OglInclude.hpp"
 	#include "Core/HdlDynamicData.hpp"
 	#include "Core/HdlTexture.hpp"
+	#include "Core/HdlPBO.hpp"
 
 namespace Glip
 {
@@ -94,6 +97,71 @@ namespace Glip
 				static ImageBuffer* load(const std::string& filename, std::string* comment=NULL);
 				void write(const std::string& filename, const std::string& comment="") const;
 		};
+
+/**
+\class AsyncTextureReader
+\brief Read textures back to the host without waiting for the GPU.
+
+The content of the texture is copied into a pixel buffer object (packing) and a fence is placed after the copy. The data can be retrieved later, once the GPU is done, without stalling. Several readbacks can be pending at the same time :
+\code
+	AsyncTextureReader reader;
+	ImageBuffer result(myPipeline.out(0));
+	int previous = 0;
+
+	while(...)
+	{
+		myPipeline << input << Pipeline::Process;
+		const int ticket = reader.read(myPipeline.out(0));
+
+		// Use the previous frame while the current one is processed :
+		if(previous>0)
+		{
+			reader.retrieve(previous, result);
+			// ...
+		}
+		previous = ticket;
+	}
+\endcode
+The pixel buffer objects of the completed readbacks are recycled for the next ones of the same size. At most getMaxFreeBuffers() of them are kept idle, the oldest being released first.
+**/
+		class GLIP_API AsyncTextureReader
+		{
+			private :
+				struct Readback
+				{
+					HdlPBO*			pbo;
+					GLsync			fence;
+					HdlTextureFormat	format;
+
+					Readback(HdlPBO* _pbo, const HdlAbstractTextureFormat& _format);
+				};
+
+				int				ticketsCounter,
+								maxFreeBuffers;
+				std::map<int, Readback*>	readbacks;
+				std::vector<HdlPBO*>		freeBuffers;
+
+				// No copy :
+				AsyncTextureReader(const AsyncTextureReader&);
+				const AsyncTextureReader& operator=(const AsyncTextureReader&);
+
+				Readback& getReadback(int ticket, const std::string& caller);
+				void recycle(HdlPBO* pbo);
+
+			public :
+				AsyncTextureReader(int _maxFreeBuffers=4);
+				~AsyncTextureReader(void);
+
+				int read(HdlTexture& texture);
+				bool isComplete(int ticket);
+				bool wait(int ticket, double timeout=-1.0);
+				const HdlAbstractTextureFormat& getFormat(int ticket);
+				void retrieve(int ticket, ImageBuffer& image);
+				void release(int ticket);
+				int getNumPendingReadbacks(void) const;
+				int getNumFreeBuffers(void) const;
+				int getMaxFreeBuffers(void) const;
+		};
 	}
 }
 
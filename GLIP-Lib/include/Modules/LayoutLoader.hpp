@@ -70,6 +70,7 @@ namespace Glip
 			KW_LL_GRID_2D,
 			KW_LL_GRID_3D,
 			KW_LL_CUSTOM_MODEL,
+			KW_LL_PROCEDURAL_GRID,
 			KW_LL_STANDARD_QUAD,
 			KW_LL_VERTEX,
 			KW_LL_ELEMENT,
@@ -192,7 +193,7 @@ For more information, refer to the modules documentation in Modules::LayoutLoade
 <b>TEXTURE_FORMAT</b>:<i>name</i>(<i>width</i>, <i>height</i>, <i>mode</i>, <i>depth</i>)
 </blockquote>
 <blockquote>
-<b>TEXTURE_FORMAT</b>:<i>name</i>(<i>width</i>, <i>height</i>, <i>mode</i>, <i>depth</i>[, <i>minFiltering</i>, <i>maxFiltering</i>, <i>sWrapping</i>, <i>tWrapping</i>, <i>maxMipMapLevel</i>])
+<b>TEXTURE_FORMAT</b>:<i>name</i>(<i>width</i>, <i>height</i>, <i>mode</i>, <i>depth</i>[, <i>minFiltering</i>, <i>maxFiltering</i>, <i>sWrapping</i>, <i>tWrapping</i>, <i>maxMipMapLevel</i>, <i>numLayers</i>, <i>target</i>])
 </blockquote>
 
 Define a texture format (Core::HdlTextureFormat). The first line shows the minimum set of arguments required.
@@ -203,14 +204,37 @@ Define a texture format (Core::HdlTextureFormat). The first line shows the minim
 <tr class="glipDescrRow"><td><i>width</i></td>				<td>Width in pixels of the format.</td></tr>
 <tr class="glipDescrRow"><td><i>height</i></td>				<td>Height in pixels of the format.</td></tr>
 <tr class="glipDescrRow"><td><i>mode</i></td>				<td>Mode of the format, among GL_RED, GL_LUMINANCE, GL_RGB, GL_RGBA, etc.</td></tr>
-<tr class="glipDescrRow"><td><i>depth</i></td>				<td>Depth of the format, among GL_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_FLOAT, etc.</td></tr>
+<tr class="glipDescrRow"><td><i>depth</i></td>				<td>Depth of the format, among GL_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_HALF_FLOAT (required by the 16F modes), GL_FLOAT, etc.</td></tr>
 <tr class="glipDescrRow"><td><i>minFilter</i> = GL_NEAREST</td>		<td>Minification filtering.</td></tr>
 <tr class="glipDescrRow"><td><i>magFilter</i> = GL_NEAREST</td>		<td>Magnification filtering.</td></tr>
 <tr class="glipDescrRow"><td><i>sWrapping</i> = GL_CLAMP</td>		<td>S Wrapping.</td></tr>
 <tr class="glipDescrRow"><td><i>tWrapping</i> = GL_CLAMP</td>		<td>T Wrapping.</td></tr>
 <tr class="glipDescrRow"><td><i>maxMipMapLevel</i> = 0</td>		<td>Maximum MipMap level.</td></tr>
+<tr class="glipDescrRow"><td><i>numLayers</i> = 1</td>			<td>Number of layers (or slices).</td></tr>
+<tr class="glipDescrRow"><td><i>target</i></td>				<td>Texture target, among GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY and GL_TEXTURE_3D (default is GL_TEXTURE_2D_ARRAY if there is more than one layer, GL_TEXTURE_2D otherwise).</td></tr>
 </table>
 
+A filter rendering to a layered format (array or 3D texture) draws all the layers in a single call, with one instance per layer : the fragment shader can read the index of the layer in <i>flat in int layer</i> and sample the layered inputs with sampler2DArray (or sampler3D) uniforms. A custom vertex shader must then write gl_Layer itself, a custom geometry shader (without vertex shader) reads the layer in <i>flat in int vLayer[]</i> and the texture coordinates in <i>in vec2 vTexCoord[]</i>. Such filters are never fused and cannot have a depth buffer. For instance, a burst of 8 frames processed at once :
+\code
+TEXTURE_FORMAT:burstFormat(640, 480, GL_RGBA8, GL_UNSIGNED_BYTE, GL_NEAREST, GL_NEAREST, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, 0, 8)
+
+SOURCE:gainSource
+{
+	#version 150
+	uniform sampler2DArray inputFrames;
+	uniform float gain = 1.0;
+	flat in int layer;
+	out vec4 outputFrames;
+
+	void main()
+	{
+		outputFrames = gain * texelFetch(inputFrames, ivec3(gl_FragCoord.xy, layer), 0);
+	}
+}
+
+FILTER_LAYOUT:gainFilter(burstFormat, gainSource)
+\endcode
+
 ### Required Format
 <blockquote>
 <b>REQUIRED_FORMAT</b>:<i>name</i>(<i>requiredFormatName</i>)
@@ -247,7 +271,7 @@ Define a model, which can be used as the base drawing in a filter.
 <table class="glipDescrTable">
 <tr class="glipDescrHeaderRow"><th class="glipDescrHeaderFirstColumn">Argument</th><th>Description</th></tr>
 <tr class="glipDescrRow"><td><i>name</i></td>				<td>Name of the model.</td></tr>
-<tr class="glipDescrRow"><td><i>type</i></td>				<td>Type of the geometry. Can be GRID_2D, GRID_3D or CUSTOM_MODEL.</td></tr>
+<tr class="glipDescrRow"><td><i>type</i></td>				<td>Type of the geometry. Can be GRID_2D, GRID_3D, PROCEDURAL_GRID or CUSTOM_MODEL.</td></tr>
 <tr class="glipDescrRow"><td><i>argument_0</i></td>			<td>Argument, depending on the choice of the geometry.</td></tr>
 </table>
 
@@ -280,6 +304,21 @@ Create a 3D grid of dots.
 <tr class="glipDescrRow"><td><i>depth</i></td>				<td>Number of dots in the Z direction.</td></tr>
 </table>
 
+#### ProceduralGrid
+<blockquote>
+<b>GEOMETRY</b>:<i>name</i>(PROCEDURAL_GRID, <i>width</i>, <i>height</i>[, <i>depth</i>])
+</blockquote>
+
+Create a 2D or 3D grid of dots without any vertex data (see GeometryPrimitives::ProceduralGrid) : the vertex shader must compute the coordinates of each dot from gl_VertexID. Nothing is generated or stored, whatever the size of the grid.
+
+<table class="glipDescrTable">
+<tr class="glipDescrHeaderRow"><th class="glipDescrHeaderFirstColumn">Argument</th><th>Description</th></tr>
+<tr class="glipDescrRow"><td><i>name</i></td>				<td>Name of the model.</td></tr>
+<tr class="glipDescrRow"><td><i>width</i></td>				<td>Number of dots in the X direction.</td></tr>
+<tr class="glipDescrRow"><td><i>height</i></td>				<td>Number of dots in the Y direction.</td></tr>
+<tr class="glipDescrRow"><td><i>depth</i></td>				<td>Number of dots in the Z direction (default is 1).</td></tr>
+</table>
+
 #### CustomModel
 <blockquote>
 <b>GEOMETRY</b>:<i>name</i>(CUSTOM_MODEL, <i>primitive</i>, <i>hasNormals</i>, <i>hasTexCoords</i>)<br>
@@ -413,7 +452,7 @@ Define a filter layout.
 <tr class="glipDescrHeaderRow"><th class="glipDescrHeaderFirstColumn">Argument</th><th>Description</th></tr>
 <tr class="glipDescrRow"><td><i>name</i></td>				<td>Name of the filter layout created.</td></tr>
 <tr class="glipDescrRow"><td><i>outputFormatName</i></td>		<td>Name of the format for the output.</td></tr>
-<tr class="glipDescrRow"><td><i>fragmentShaderSourceName</i></td>	<td>Name of the fragment shader source.</td></tr>
+<tr class="glipDescrRow"><td><i>fragmentShaderSourceName</i></td>	<td>Name of the fragment shader source, or of a compute shader source (declaring its work group size with layout(local_size_x = ...) in;).</td></tr>
 <tr class="glipDescrRow"><td><i>vertexShaderSourceName</i></td>		<td>Name of the vertex shader source. Use DEFAULT_VERTEX_SHADER to get the default vertex shader.</td></tr>
 <tr class="glipDescrRow"><td><i>geometryName</i></td>			<td>Name of the geometry model.</td></tr>
 <tr class="glipDescrRow"><td><i>extraOptions</i></td>			<td>Set of shaders, among GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_COMPUTE_SHADER, GL_TESS_CONTROL_SHADER, GL_TESS_EVALUATION_SHADER, GL_GEOMETRY_SHADER. Specific Geometry model with GL_RENDER. Set of options for the filter layout : GL_CLEAR, GL_BLEND, GL_DEPTH_TEST</td></tr>
@@ -423,7 +462,7 @@ Define a filter layout.
 <blockquote>
 <b>GL_VERTEX_SHADER</b>(<i>name</i>)<br>
 <b>GL_FRAGMENT_SHADER</b>(<i>name</i>)<br>
-<b>GL_COMPUTE_SHADER</b>(<i>name</i>)<br>
+<b>GL_COMPUTE_SHADER</b>(<i>name</i>[, <i>inputPortName</i>])<br>
 <b>GL_TESS_CONTROL_SHADER</b>(<i>name</i>)<br>
 <b>GL_TESS_EVALUATION_SHADER</b>(<i>name</i>)<br>
 <b>GL_GEOMETRY_SHADER</b>(<i>name</i>)
@@ -434,11 +473,38 @@ Add other shader sources to the filter.
 <table class="glipDescrTable">
 <tr class="glipDescrHeaderRow"><th class="glipDescrHeaderFirstColumn">Argument</th><th>Description</th></tr>
 <tr class="glipDescrRow"><td><i>name</i></td>				<td>Name of the ShaderSource to be used.</td></tr>
+<tr class="glipDescrRow"><td><i>inputPortName</i></td>			<td>For a compute shader, the input port covered by the work groups (the output is covered by default, see AbstractFilterLayout::setComputeDomain).</td></tr>
 </table>
 
+A compute shader cannot be combined with other shaders or with a geometry model. Its outputs are the image uniforms (image2D, iimage2D, uimage2D) bound to the image units in their order of declaration, the output format must then be a sized format (e.g. GL_RGBA8, GL_RGBA32F, GL_R32UI). The shader is dispatched over the output (or over the input port given as second argument of GL_COMPUTE_SHADER), with as many work groups as needed to cover it, and must discard the invocations outside of the image. The outputs are cleared before each dispatch unless GL_CLEAR(FALSE) is set. For instance, a histogram :
+\code
+SOURCE:histogramSource
+{
+	#version 430
+	layout(local_size_x = 16, local_size_y = 16) in;
+	uniform sampler2D inputTexture;
+	layout(r32ui) uniform coherent uimage2D histogram;
+
+	void main()
+	{
+		const ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+		if(any(greaterThanEqual(pos, textureSize(inputTexture, 0))))
+			return ;
+		const float l = dot(texelFetch(inputTexture, pos, 0).rgb, vec3(0.2126, 0.7152, 0.0722));
+		imageAtomicAdd(histogram, ivec2(min(int(l*256.0), 255), 0), 1u);
+	}
+}
+
+TEXTURE_FORMAT:histogramFormat(256, 1, GL_R32UI, GL_UNSIGNED_INT, GL_NEAREST, GL_NEAREST)
+FILTER_LAYOUT:histogramFilter(histogramFormat)
+{
+	GL_COMPUTE_SHADER(histogramSource, inputTexture)
+}
+\endcode
+
 ### Geometry Model
 <blockquote>
-<b>GL_RENDER</b>(<i>name</i>)
+<b>GL_RENDER</b>(<i>name</i>[, <i>numInstances</i>])
 </blockquote>
 
 Specify the GeometryModel to be used (default is a standard quad).
@@ -446,6 +512,7 @@ Specify the GeometryModel to be used (default is a standard quad).
 <table class="glipDescrTable">
 <tr class="glipDescrHeaderRow"><th class="glipDescrHeaderFirstColumn">Argument</th><th>Description</th></tr>
 <tr class="glipDescrRow"><td><i>name</i></td>				<td>Name of the GeometryModel to be used.</td></tr>
+<tr class="glipDescrRow"><td><i>numInstances</i></td>			<td>Number of instances of the geometry drawn in a single call (default is 1, see AbstractFilterLayout::setNumInstances). The shaders can read the index of the current instance in gl_InstanceID.</td></tr>
 </table>
 
 ### Clearing
@@ -569,7 +569,7 @@ Match if a format setting is larger than a value (unsigned integer or GL keyword
 
 ### GENERATE_SAME_SIZE_2D_GRID
 <blockquote>
-<b>CALL</b>:GENERATE_SAME_SIZE_2D_GRID(nameNewGeometry, nameFormat [, normalized])<br>
+<b>CALL</b>:GENERATE_SAME_SIZE_2D_GRID(nameNewGeometry, nameFormat [, normalized, procedural])<br>
 </blockquote>
 
 Create a 2D grid geometry of the same size as the format in argument (width and height).
@@ -579,11 +579,12 @@ Create a 2D grid geometry of the same size as the format in argument (width and
 <tr class="glipDescrRow"><td><i>nameNewGeometry</i></td> <td>Name of the new geometry.</td></tr>
 <tr class="glipDescrRow"><td><i>nameFormat</i></td> <td>Name of the original format.</td></tr>
 <tr class="glipDescrRow"><td><i>normalized</i></td> <td>Either TRUE or FALSE. If enabled, the vertices coordinates will be in the range [0,1].</td></tr>
+<tr class="glipDescrRow"><td><i>procedural</i></td> <td>Either TRUE or FALSE. If enabled, the grid has no vertex data and the vertex shader must compute the coordinates from gl_VertexID (normalized is then ignored).</td></tr>
 </table>
 
 ### GENERATE_SAME_SIZE_3D_GRID
 <blockquote>
-<b>CALL</b>:GENERATE_SAME_SIZE_3D_GRID(nameNewGeometry, nameFormat [, normalized])<br>
+<b>CALL</b>:GENERATE_SAME_SIZE_3D_GRID(nameNewGeometry, nameFormat [, normalized, procedural])<br>
 </blockquote>
 
 Create a 3D grid geometry of the same size as the format in argument (width, height and number of channels).
@@ -593,6 +594,7 @@ Create a 3D grid geometry of the same size as the format in argument (width, hei
 <tr class="glipDescrRow"><td><i>nameNewGeometry</i></td> <td>Name of the new geometry.</td></tr>
 <tr class="glipDescrRow"><td><i>nameFormat</i></td> <td>Name of the original format.</td></tr>
 <tr class="glipDescrRow"><td><i>normalized</i></td> <td>Either TRUE or FALSE. If enabled, the vertices coordinates will be in the range [0,1].</td></tr>
+<tr class="glipDescrRow"><td><i>procedural</i></td> <td>Either TRUE or FALSE. If enabled, the grid has no vertex data and the vertex shader must compute the coordinates from gl_VertexID (normalized is then ignored).</td></tr>
 </table>
 
 ### CHAIN_PIPELINES
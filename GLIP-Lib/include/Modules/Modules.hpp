@@ -29,5 +29,6 @@
 	#include "Modules/ImageBuffer.hpp"
 	#include "Modules/FFT.hpp"
 	#include "Modules/GeometryLoader.hpp"
+	#include "Modules/TiledProcessor.hpp"
 
 #endif
@@ -0,0 +1,100 @@
+/* ************************************************************************************************************* */
+/*                                                                                                               */
+/*     GLIP-LIB                                                                                                  */
+/*     OpenGL Image Processing LIBrary                                                                           */
+/*                                                                                                               */
+/*     Author        : R. Kerviche                                                                               */
+/*     LICENSE       : MIT License                                                                               */
+/*     Website       : glip-lib.net                                                                              */
+/*                                                                                                               */
+/*     File          : TiledProcessor.hpp                                                                        */
+/*     Original Date : October 17th 2026                                                                         */
+/*                                                                                                               */
+/*     Description   : Module : Tiled processing of large images                                                 */
+/*                                                                                                               */
+/* ************************************************************************************************************* */
+
+/**
+ * \file    TiledProcessor.hpp
+ * \brief   Module : Tiled processing of large images
+ * \author  R. KERVICHE
+ * \date    October 17th 2026
+**/
+
+#ifndef __TILED_PROCESSOR_INCLUDE__
+#define __TILED_PROCESSOR_INCLUDE__
+
+	// Includes
+	#include <map>
+	#include <vector>
+	#include "Core/LibTools.hpp"
+	#include "Core/OglInclude.hpp"
+	#include "Core/HdlTexture.hpp"
+	#include "Core/HdlPBO.hpp"
+	#include "Core/Pipeline.hpp"
+	#include "Modules/ImageBuffer.hpp"
+
+namespace Glip
+{
+	// Prototypes
+	using namespace Glip::CoreGL;
+	using namespace Glip::CorePipeline;
+
+	namespace Modules
+	{
+/**
+\class TiledProcessor
+\brief Apply a pipeline on images larger than its own resolution (or than HdlAbstractTextureFormat::getMaxSize()), tile by tile.
+
+The pipeline is built for the size of a tile (the size of its outputs). The inputs are split into overlapping tiles, the overlap (halo) being the distance up to which an input pixel can influence an output pixel (see Pipeline::getHalo). The filters reading their inputs only at the current fragment have no halo, the others must be declared or covered by the default halo (an exception naming the filter is raised otherwise) :
+\code
+	// The pipeline is built for tiles of 2048x2048 pixels :
+	Pipeline* pipeline = loader.getPipeline("process.ppl");
+	TiledProcessor processor(*pipeline);
+
+	// A 7x7 blur reads its input up to 3 pixels away :
+	processor.setFilterHalo(pipeline->getElementID("Blur"), 3);
+
+	ImageBuffer* input = ImageBuffer::load("scan.raw");
+	ImageBuffer output(*input);
+
+	std::vector<const ImageBuffer*> inputs(1, input);
+	std::vector<ImageBuffer*> outputs(1, &output);
+	processor.process(inputs, outputs);
+\endcode
+
+The upload of the next tile (through a pixel buffer object) is prepared while the current one is processed. The input tiles use GL_CLAMP_TO_EDGE wrapping and are placed inside the image whenever possible, so that the results match the processing of the whole image (when the filters only use relative coordinates). If the image is smaller than a tile along one dimension, the tile is padded by repeating the border pixels.
+**/
+		class GLIP_API TiledProcessor
+		{
+			private :
+				Pipeline&		pipeline;
+				std::map<int, int>	filtersHalos;
+				int			defaultHalo,
+							numProcessedTiles;
+
+				// No copy :
+				TiledProcessor(const TiledProcessor&);
+				const TiledProcessor& operator=(const TiledProcessor&);
+
+				static void listTiles(int size, int tileSize, int halo, std::vector<int>& coresStarts, std::vector<int>& origins);
+				static void uploadTile(const ImageBuffer& image, int x, int y, ImageBuffer& tile, HdlPBO& pbo, HdlTexture& texture);
+
+			public :
+				TiledProcessor(Pipeline& _pipeline, int _defaultHalo=-1);
+				~TiledProcessor(void);
+
+				int getTileWidth(void);
+				int getTileHeight(void);
+				void setFilterHalo(int filterID, int halo);
+				void setDefaultHalo(int halo);
+				int getHalo(void);
+				int getNumTiles(int width, int height);
+				int getNumProcessedTiles(void) const;
+				void process(const std::vector<const ImageBuffer*>& inputs, const std::vector<ImageBuffer*>& outputs);
+		};
+	}
+}
+
+#endif
+
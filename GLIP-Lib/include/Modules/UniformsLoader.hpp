@@ -132,6 +132,8 @@ Processing example :
 	std::cout << c << " variables were loaded." << std::endl;
 \endcode
 
+The members of the uniform blocks are listed with the other variables of the filters (for a block declared with an instance name, as <i>BlockName.member</i>). They are applied one by one, as the other variables. A whole block is written with HdlProgram::setUniformBlockData or, for a buffer shared by several programs, with HdlProgram::writeUniformBlockBuffer.
+
 Note that each UniformsLoader will index the pipelines by their layout name (see AbstractComponentLayout::getLayoutName()). Each can only have one set of pipeline uniform variables per layout name.
 **/
 		class GLIP_API UniformsLoader
@@ -54,7 +54,8 @@
 		sFactor(GL_ONE),
 		dFactor(GL_ONE),
 		blendingEquation(GL_FUNC_ADD),
-		depthTestingFunction(GL_LESS)
+		depthTestingFunction(GL_LESS),
+		numInstances(1)
 	{
 		for(unsigned int k=0; k<HandleOpenGL::numShaderTypes; k++)
 			shaderSources[k] = NULL;
@@ -76,7 +77,9 @@
 		sFactor(c.sFactor),
 		dFactor(c.dFactor),
 		blendingEquation(c.blendingEquation),
-		depthTestingFunction(c.depthTestingFunction)
+		depthTestingFunction(c.depthTestingFunction),
+		computeDomain(c.computeDomain),
+		numInstances(c.numInstances)
 	{
 		for(unsigned int k=0; k<HandleOpenGL::numShaderTypes; k++)
 			shaderSources[k] = NULL;
@@ -151,6 +154,15 @@
 		return isStandardGeometry;
 	}
 
+	/**
+	\fn bool AbstractFilterLayout::isComputeFilter(void) const
+	\return true if the filter is a compute shader (dispatched over its output instead of rendering a geometry).
+	**/
+	bool AbstractFilterLayout::isComputeFilter(void) const
+	{
+		return getShaderSource(GL_COMPUTE_SHADER)!=NULL;
+	}
+
 	/**
 	\fn bool AbstractFilterLayout::isClearingEnabled(void) const
 	\return true if clearing is enabled.		
@@ -295,13 +307,61 @@
 		depthTesting = false;
 	}
 
+	/**
+	\fn const std::string& AbstractFilterLayout::getComputeDomain(void) const
+	\return The name of the input port over which the compute shader is dispatched, or an empty string if it is dispatched over the output.
+	**/
+	const std::string& AbstractFilterLayout::getComputeDomain(void) const
+	{
+		return computeDomain;
+	}
+
+	/**
+	\fn void AbstractFilterLayout::setComputeDomain(const std::string& inputPortName)
+	\brief Set the domain over which the compute shader is dispatched. By default, the work groups cover the output. Scatter operations (such as a histogram) can instead cover one of the inputs.
+	\param inputPortName The name of the input port covered by the work groups, or an empty string for the output.
+	**/
+	void AbstractFilterLayout::setComputeDomain(const std::string& inputPortName)
+	{
+		if(!isComputeFilter())
+			throw Exception("AbstractFilterLayout::setComputeDomain - " + getFullName() + " is not a compute filter.", __FILE__, __LINE__, Exception::CoreException);
+		if(!inputPortName.empty() && !doesInputPortExist(inputPortName))
+			throw Exception("AbstractFilterLayout::setComputeDomain - " + getFullName() + " has no input port named \"" + inputPortName + "\".", __FILE__, __LINE__, Exception::CoreException);
+
+		computeDomain = inputPortName;
+	}
+
+	/**
+	\fn int AbstractFilterLayout::getNumInstances(void) const
+	\return The number of instances of the geometry drawn at each processing (1 by default).
+	**/
+	int AbstractFilterLayout::getNumInstances(void) const
+	{
+		return numInstances;
+	}
+
+	/**
+	\fn void AbstractFilterLayout::setNumInstances(int n)
+	\brief Set the number of instances of the geometry drawn in a single call at each processing. The shaders can read the index of the current instance in gl_InstanceID.
+	\param n The number of instances (at least 1).
+	**/
+	void AbstractFilterLayout::setNumInstances(int n)
+	{
+		if(n<1)
+			throw Exception("AbstractFilterLayout::setNumInstances - Invalid number of instances (" + toString(n) + ") for " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+		if(isComputeFilter() && n!=1)
+			throw Exception("AbstractFilterLayout::setNumInstances - " + getFullName() + " is a compute filter and cannot draw instances.", __FILE__, __LINE__, Exception::CoreException);
+
+		numInstances = n;
+	}
+
 // FilterLayout
 	/**
 	\fn FilterLayout::FilterLayout(const std::string& type, const HdlAbstractTextureFormat& fout, const ShaderSource& fragmentSource, GeometryModel* geometry)
 	\brief FilterLayout constructor.
 	\param type The typename of the filter layout.
 	\param fout The texture format of all the outputs.
-	\param fragmentSource The ShaderSource of the fragement shader.
+	\param fragmentSource The ShaderSource of the fragement shader, or of a compute shader (see ShaderSource::isComputeSource).
 	\param geometry The geometry model to use in this filter (if left to NULL, the standard quad will be used, otherwise the object will be copied).
 	**/
 	FilterLayout::FilterLayout(const std::string& type, const HdlAbstractTextureFormat& fout, const ShaderSource& fragmentSource, GeometryModel* geometry)
@@ -310,9 +370,12 @@
 		HdlAbstractTextureFormat(fout),
 		AbstractFilterLayout(type, fout)
 	{
+		if(fragmentSource.isComputeSource() && geometry!=NULL)
+			throw Exception("FilterLayout::FilterLayout - A geometry cannot be used with the compute shader of " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+
 		// Copy the source : 
 		ShaderSource* _fragmentSource = new ShaderSource(fragmentSource);
-		shaderSources[HandleOpenGL::getShaderTypeIndex(GL_FRAGMENT_SHADER)] = _fragmentSource;
+		shaderSources[HandleOpenGL::getShaderTypeIndex(fragmentSource.isComputeSource() ? GL_COMPUTE_SHADER : GL_FRAGMENT_SHADER)] = _fragmentSource;
 
 		// Create the ports : 
 		std::vector<std::string> varsIn = _fragmentSource->getInputVars(),
@@ -341,6 +404,8 @@
 	\param fout The texture format of all the outputs.
 	\param sources List of all the sources, map to their respective types (GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_COMPUTE_SHADER, GL_TESS_CONTROL_SHADER, GL_TESS_EVALUATION_SHADER, GL_GEOMETRY_SHADER), the objects will be copied.
 	\param geometry The geometry model to use in this filter (if left to NULL, the standard quad will be used, otherwise the object will be copied).
+
+	A compute shader cannot be combined with other sources nor with a geometry.
 	**/
 	FilterLayout::FilterLayout(const std::string& type, const HdlAbstractTextureFormat& fout, const std::map<GLenum, ShaderSource*>& sources, GeometryModel* geometry)
 	 : 	AbstractComponentLayout(type),  
@@ -351,6 +416,19 @@
 		if(sources.empty())
 			throw Exception("FilterLayout::FilterLayout - No ShaderSource provided.", __FILE__, __LINE__, Exception::CoreException);
 
+		std::map<GLenum, ShaderSource*>::const_iterator itCompute = sources.find(GL_COMPUTE_SHADER);
+		if(itCompute!=sources.end() && itCompute->second!=NULL)
+		{
+			for(std::map<GLenum, ShaderSource*>::const_iterator it=sources.begin(); it!=sources.end(); it++)
+			{
+				if(it!=itCompute && it->second!=NULL)
+					throw Exception("FilterLayout::FilterLayout - The compute shader of " + getFullName() + " cannot be combined with a " + getGLEnumNameSafe(it->first) + ".", __FILE__, __LINE__, Exception::CoreException);
+			}
+
+			if(geometry!=NULL)
+				throw Exception("FilterLayout::FilterLayout - A geometry cannot be used with the compute shader of " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+		}
+
 		// Copy the sources, and the find the input/output variables : 
 		std::set<std::string>	varsIn,
 					varsOut;
@@ -404,9 +482,6 @@
 		const int 	limInput  = HdlTexture::getMaxImageUnits(),
 				limOutput = HdlFBO::getMaximumColorAttachment();
 
-		for(unsigned int k=0; k<HandleOpenGL::numShaderTypes; k++)
-			shaders[k] = NULL;
-
 		firstRun	= true;
 		broken		= true; // Wait for complete initialization.
 
@@ -417,40 +492,99 @@
 		if(getNumOutputPort()>limOutput)
 			throw Exception("Filter::Filter - Filter " + getFullName() + " has too many output port for hardware (Max : " + toString(limOutput) + ", Current : " + toString(getNumInputPort()) + ").", __FILE__, __LINE__, Exception::CoreException);
 
+		// Check the compute shaders :
+		if(isComputeFilter())
+		{
+			if(!isComputeAvailable())
+				throw Exception("Filter::Filter - Filter " + getFullName() + " is a compute shader but compute shaders are not supported by the hardware or the driver.", __FILE__, __LINE__, Exception::CoreException);
+			if(isBlendingEnabled() || isDepthTestingEnabled())
+				throw Exception("Filter::Filter - Filter " + getFullName() + " is a compute shader and cannot use blending or depth testing.", __FILE__, __LINE__, Exception::CoreException);
+			if(!isImageFormat(getGLMode()))
+				throw Exception("Filter::Filter - Filter " + getFullName() + " is a compute shader but its output format " + getGLEnumNameSafe(getGLMode()) + " cannot be bound to an image unit (use a sized format such as GL_RGBA8, GL_RGBA32F or GL_R32UI).", __FILE__, __LINE__, Exception::CoreException);
+		}
+		else if(getNumInstances()>1 && !HdlVBO::isInstancingAvailable())
+			throw Exception("Filter::Filter - Filter " + getFullName() + " draws " + toString(getNumInstances()) + " instances but instanced drawing is not supported by the hardware or the driver.", __FILE__, __LINE__, Exception::CoreException);
+
+		// Check the layered rendering (one instance per layer) :
+		if(isLayered() && !isComputeFilter())
+		{
+			if(!isLayeredRenderingAvailable())
+				throw Exception("Filter::Filter - Filter " + getFullName() + " renders to a layered format (" + getGLEnumNameSafe(getGLTarget()) + ") but layered rendering is not supported by the hardware or the driver.", __FILE__, __LINE__, Exception::CoreException);
+			if(getNumInstances()>1)
+				throw Exception("Filter::Filter - Filter " + getFullName() + " renders to a layered format and cannot draw " + toString(getNumInstances()) + " instances (one instance is drawn per layer).", __FILE__, __LINE__, Exception::CoreException);
+		}
+
 		// Build arguments table :
 		arguments.assign(getNumInputPort(), reinterpret_cast<HdlTexture*>(NULL));
 
+		ShaderSource	*layeredVertexSource	= NULL,
+				*layeredGeometrySource	= NULL;
+
 		try
 		{
-			// Build the shaders and the program : 
-			prgm 	= new HdlProgram;
-
+			// Build the program, shared with the filters having the same sources : 
 			#ifdef GLIP_USE_GL
 				const GLenum listShaderTypeEnum[] = {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_COMPUTE_SHADER, GL_TESS_CONTROL_SHADER, GL_TESS_EVALUATION_SHADER, GL_GEOMETRY_SHADER};
 			#else
 				const GLenum listShaderTypeEnum[] = {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_COMPUTE_SHADER};
 			#endif
+			std::map<GLenum, const ShaderSource*> sources;
+			bool allRequireCompatibility = true;
 			for(unsigned int k=0; k<(sizeof(listShaderTypeEnum)/sizeof(GLenum)); k++)
 			{
 				const ShaderSource* ptr = getShaderSource(listShaderTypeEnum[k]);
 				if(ptr!=NULL)
 				{
-					shaders[k] = new HdlShader(listShaderTypeEnum[k], *ptr);
-					prgm->updateShader(*shaders[k], false);
+					sources[listShaderTypeEnum[k]] = ptr;
+					allRequireCompatibility = allRequireCompatibility && ptr->requiresCompatibility();
 				}
 			}
-			prgm->link();
-		}
-		catch(Exception& e)
-		{
-			for(unsigned int k=0; k<HandleOpenGL::numShaderTypes; k++)
+
+			// Without the fixed pipeline, the geometry must go through a vertex shader reading the generic attributes (see HdlVBO) : 
+			const ShaderSource standardVertexSource(	"#version 150\n"
+									"in vec4 " + HdlVBO::positionAttributeName + ";\n"
+									"in vec2 " + HdlVBO::texCoordAttributeName + ";\n"
+									"out vec2 texCoord;\n"
+									"void main()\n"
+									"{\n"
+									"	gl_Position = " + HdlVBO::positionAttributeName + ";\n"
+									"	texCoord = " + HdlVBO::texCoordAttributeName + ";\n"
+									"}\n", "<StandardVertexSource>");
+			if(HandleOpenGL::isCoreProfile() && !isComputeFilter() && !isLayered() && sources.find(GL_VERTEX_SHADER)==sources.end())
+				sources[GL_VERTEX_SHADER] = &standardVertexSource;
+
+			// In the layered mode, each instance renders a layer (gl_Layer), set from the vertex shader if possible or from a geometry shader :
+			if(isLayered() && !isComputeFilter() && sources.find(GL_VERTEX_SHADER)==sources.end())
+			{
+				const bool vertexLayer = isVertexLayerAvailable() && sources.find(GL_GEOMETRY_SHADER)==sources.end();
+
+				layeredVertexSource = new ShaderSource(getLayeredVertexSource(vertexLayer), "<LayeredVertexSource>");
+				sources[GL_VERTEX_SHADER] = layeredVertexSource;
+
+				if(!vertexLayer && sources.find(GL_GEOMETRY_SHADER)==sources.end())
+				{
+					layeredGeometrySource = new ShaderSource(getLayeredGeometrySource(getGeometryModel().primitiveGL), "<LayeredGeometrySource>");
+					sources[GL_GEOMETRY_SHADER] = layeredGeometrySource;
+				}
+			}
+
+			// Test if this filter is using out vec4's : 
+			std::vector<std::string> fragmentLocations;
+			if(!allRequireCompatibility && !isComputeFilter())
 			{
-				delete shaders[k];
-				shaders[k] = NULL;
+				for(int i=0; i<getNumOutputPort(); i++)
+					fragmentLocations.push_back(getOutputPortName(i));
 			}
 
-			delete prgm;
-			prgm = NULL;
+			prgm = new HdlProgram(sources, fragmentLocations);
+
+			delete layeredVertexSource;
+			delete layeredGeometrySource;
+		}
+		catch(Exception& e)
+		{
+			delete layeredVertexSource;
+			delete layeredGeometrySource;
 
 			Exception m("Filter::Filter - Caught an exception while creating the shaders for " + getFullName(), __FILE__, __LINE__, Exception::CoreException);
 			m << e;
@@ -459,34 +593,18 @@
 
 		try
 		{
-			// Test if this filter is using out vec4's : 
-			bool allRequireCompatibility = true;
-			for(unsigned int k=0; k<HandleOpenGL::numShaderTypes; k++)
-				allRequireCompatibility = allRequireCompatibility && (shaders[k]==NULL || shaders[k]->requiresCompatibility());
-
-			if(!allRequireCompatibility)
-			{
-				for(int i=0; i<getNumOutputPort(); i++)
-					prgm->setFragmentLocation(getOutputPortName(i), i);
-
-				// Now link to apply the change of locations (link must be done before setting any uniform values, including input sampler2D) : 
-				prgm->link();
-			}
-
 			// Set the names of the samplers :
 			for(int i=0; i<getNumInputPort(); i++)
 				prgm->setVar(getInputPortName(i), GL_INT, i);
+
+			// Set the image units of the outputs of the compute shaders :
+			for(int i=0; i<getNumOutputPort() && isComputeFilter(); i++)
+				prgm->setVar(getOutputPortName(i), GL_INT, i);
 			
 			prgm->stopProgram();
 		}
 		catch(Exception& e)
 		{
-			for(unsigned int k=0; k<HandleOpenGL::numShaderTypes; k++)
-			{
-				delete shaders[k];
-				shaders[k] = NULL;
-			}
-
 			delete prgm;
 			prgm = NULL;
 
@@ -495,18 +613,38 @@
 			throw m;
 		}
 
-		// Build the geometry :
-		geometry = new GeometryInstance( getGeometryModel(), GL_STATIC_DRAW );
+		// Build the geometry (the compute shaders are dispatched over the output) :
+		if(!isComputeFilter())
+			geometry = new GeometryInstance( getGeometryModel(), GL_STATIC_DRAW );
 
 		// Finally : 
 		broken = false;
 	}
 
+	/**
+	\fn Filter::Filter(const AbstractFilterLayout& c, const std::string& name, Filter& host, const std::string& uniformsPrefix)
+	\brief Filter constructor, for a filter which was fused into another one (the filter is not rendered, it only gives access to its uniform variables in the program of the host).
+	\param c Filter layout.
+	\param name The instance name.
+	\param host The filter actually rendered.
+	\param uniformsPrefix The prefix of the uniform variables of this filter in the program of the host.
+	**/
+	Filter::Filter(const AbstractFilterLayout& c, const std::string& name, Filter& host, const std::string& uniformsPrefix)
+	:	AbstractComponentLayout(c), 
+		Component(c, name),
+		HdlAbstractTextureFormat(c), 
+		AbstractFilterLayout(c),
+		prgm(NULL), 
+		geometry(NULL),
+		firstRun(false),
+		broken(false)
+	{
+		prgm = new HdlProgram(host.program(), uniformsPrefix);
+	}
+
 	Filter::~Filter(void)
 	{
 		delete prgm;
-		for(unsigned int k=0; k<HandleOpenGL::numShaderTypes; k++)
-			delete shaders[k];
 		delete geometry;
 	}
 
@@ -523,6 +661,29 @@
 		arguments[id] = ptr;
 	}
 
+	/**
+	\fn void Filter::changeFormat(const HdlAbstractTextureFormat& fmt)
+	\brief Change the output format of the filter, without rebuilding its program (see Pipeline::reformat).
+	\param fmt The new output format.
+	**/
+	void Filter::changeFormat(const HdlAbstractTextureFormat& fmt)
+	{
+		if(isComputeFilter() && !isImageFormat(fmt.getGLMode()))
+			throw Exception("Filter::changeFormat - Filter " + getFullName() + " is a compute shader but its output format " + getGLEnumNameSafe(fmt.getGLMode()) + " cannot be bound to an image unit.", __FILE__, __LINE__, Exception::CoreException);
+
+		width		= fmt.getWidth();
+		height		= fmt.getHeight();
+		mode		= fmt.getGLMode();
+		depth		= fmt.getGLDepth();
+		minFilter	= fmt.getMinFilter();
+		magFilter	= fmt.getMagFilter();
+		wraps		= fmt.getSWrapping();
+		wrapt		= fmt.getTWrapping();
+		baseLevel	= fmt.getBaseLevel();
+		maxLevel	= fmt.getMaxLevel();
+		setAlignment(fmt.getAlignment());
+	}
+
 	/**
 	\fn void Filter::process(HdlFBO& renderer)
 	\brief Start the rendering process.
@@ -532,6 +693,12 @@
 	{
 		if(renderer.getAttachmentCount()<getNumOutputPort())
 			throw Exception("Filter::process - Renderer doesn't have as many texture targets as Filter " + getFullName() + " has outputs.", __FILE__, __LINE__, Exception::CoreException);
+
+		if(isComputeFilter())
+		{
+			processCompute(renderer);
+			return ;
+		}
 		
 		// Pre-depth test : 
 			if(isDepthTestingEnabled() && !renderer.hasDepthBuffer())
@@ -541,26 +708,17 @@
 			renderer.beginRendering(getNumOutputPort(), isDepthTestingEnabled());
 	
 		// Enable states
+			HandleOpenGL::setCapability(GL_DEPTH_TEST, isDepthTestingEnabled());
 			if(isDepthTestingEnabled())
-			{
-				glEnable(GL_DEPTH_TEST);
-				glDepthFunc(getDepthTestingFunction());
-			}
-			else
-				glDisable(GL_DEPTH_TEST);
+				HandleOpenGL::setDepthFunction(getDepthTestingFunction());
 
+			HandleOpenGL::setCapability(GL_BLEND, isBlendingEnabled());
 			if(isBlendingEnabled())
-			{
-				glEnable(GL_BLEND);
-				glBlendFunc(getSFactor(), getDFactor());
-				glBlendEquation(getBlendingEquation());
-			}
-			else
-				glDisable(GL_BLEND);
+				HandleOpenGL::setBlending(getSFactor(), getDFactor(), getBlendingEquation());
 
 			if(isClearingEnabled())
 			{
-				glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+				HandleOpenGL::setClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 			}
 
@@ -569,9 +727,7 @@
 				arguments[i]->bind(i);
 
 		// Prepare geometry
-		#ifdef GLIP_USE_GL
-			glLoadIdentity();
-		#endif
+			HandleOpenGL::loadIdentity();
 
 		// Load the shader
 			prgm->use();
@@ -593,8 +749,13 @@
 				}
 			}
 
-		// Draw
-			geometry->draw();
+		// Draw (an instance per layer in the layered mode)
+			if(isLayered())
+				geometry->drawInstanced(getNumLayers());
+			else if(getNumInstances()>1)
+				geometry->drawInstanced(getNumInstances());
+			else
+				geometry->draw();
 
 		// Test on first run ; 
 			if(firstRun)
@@ -618,10 +779,10 @@
 
 		// Remove from stack
 			if(isDepthTestingEnabled())
-				glDisable(GL_DEPTH_TEST);
+				HandleOpenGL::setCapability(GL_DEPTH_TEST, false);
 
 			if(isBlendingEnabled())
-				glDisable(GL_BLEND);
+				HandleOpenGL::setCapability(GL_BLEND, false);
 
 		// Unload
 			for(int i=0; i<getNumInputPort(); i++)
@@ -646,6 +807,227 @@
 			}
 	}
 
+	/**
+	\fn void Filter::processCompute(HdlFBO& renderer)
+	\brief Dispatch the compute shader over the targets of the renderer, bound to the image units.
+	\param renderer The FBO containing the targets.
+
+	The number of work groups is the size of the domain (the output, or the input given to AbstractFilterLayout::setComputeDomain) divided by the work group size (rounded up), the shader must discard the invocations outside of the domain (see imageSize() and textureSize()).
+	**/
+	void Filter::processCompute(HdlFBO& renderer)
+	{
+		#if defined(GLIP_USE_GL) || defined(GL_ES_VERSION_3_1)
+		int	workGroupWidth	= 1,
+			workGroupHeight	= 1,
+			workGroupDepth	= 1;
+		getShaderSource(GL_COMPUTE_SHADER)->getWorkGroupSize(workGroupWidth, workGroupHeight, workGroupDepth);
+
+		const std::vector<GLenum>& outputTypes = getShaderSource(GL_COMPUTE_SHADER)->getOutputTypes();
+		const HdlAbstractTextureFormat& domain = getComputeDomain().empty() ? static_cast<const HdlAbstractTextureFormat&>(*this) : *arguments[getInputPortID(getComputeDomain())];
+
+		// Prepare the renderer (the outputs are cleared through the framebuffer) :
+			renderer.beginRendering(getNumOutputPort(), false);
+
+			if(isClearingEnabled())
+			{
+				const GLfloat	zerosf[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+				const GLint	zerosi[4] = {0, 0, 0, 0};
+				const GLuint	zerosu[4] = {0, 0, 0, 0};
+
+				for(int i=0; i<getNumOutputPort(); i++)
+				{
+					if(outputTypes[i]==GL_INT_IMAGE_2D || outputTypes[i]==GL_INT_IMAGE_2D_ARRAY || outputTypes[i]==GL_INT_IMAGE_3D)
+						glClearBufferiv(GL_COLOR, i, zerosi);
+					else if(outputTypes[i]==GL_UNSIGNED_INT_IMAGE_2D || outputTypes[i]==GL_UNSIGNED_INT_IMAGE_2D_ARRAY || outputTypes[i]==GL_UNSIGNED_INT_IMAGE_3D)
+						glClearBufferuiv(GL_COLOR, i, zerosu);
+					else
+						glClearBufferfv(GL_COLOR, i, zerosf);
+				}
+			}
+
+		// Link the textures and the images :
+			for(int i=0; i<getNumInputPort(); i++)
+				arguments[i]->bind(i);
+
+			for(int i=0; i<getNumOutputPort(); i++)
+				glBindImageTexture(i, renderer[i]->getID(), 0, renderer[i]->isLayered() ? GL_TRUE : GL_FALSE, 0, GL_READ_WRITE, renderer[i]->getGLMode());
+
+		// Load the shader
+			prgm->use();
+
+		// Test on first run : 
+			if(firstRun)
+			{
+				const GLenum err = glGetError();
+
+				if(err!=GL_NO_ERROR)
+				{
+					HdlProgram::stopProgram();
+					renderer.endRendering();
+
+					firstRun 	= false;
+					broken 		= true;
+					throw Exception("Filter::processCompute : Exception caught on first run of filter " + getFullName() + ". The error occured after initialization, GL error : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::CoreException);
+				}
+			}
+
+		// Dispatch
+			glDispatchCompute((domain.getWidth()+workGroupWidth-1)/workGroupWidth, (domain.getHeight()+workGroupHeight-1)/workGroupHeight, (domain.getNumLayers()+workGroupDepth-1)/workGroupDepth);
+
+			// Make the writes visible to the following filters (sampling, image access, read back, copies and mipmaps generation) :
+			glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT | GL_PIXEL_BUFFER_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT);
+
+		// Test on first run ; 
+			if(firstRun)
+			{
+				const GLenum err = glGetError();
+
+				if(err!=GL_NO_ERROR)
+				{
+					HdlProgram::stopProgram();
+					renderer.endRendering();
+
+					firstRun 	= false;
+					broken 		= true;
+					throw Exception("Filter::processCompute : Exception caught on first run of filter " + getFullName() + ". The error occured after the dispatch operation, GL error : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::CoreException);
+				}
+			}
+
+		// Stop using the shader
+			HdlProgram::stopProgram();
+
+		// Unload
+			for(int i=0; i<getNumInputPort(); i++)
+				HdlTexture::unbind(i);
+
+		// End rendering (marks the targets as modified and generates their mipmaps)
+			renderer.endRendering();
+
+		// Test on first run ; 
+			if(firstRun)
+			{
+				const GLenum err = glGetError();
+
+				if(err!=GL_NO_ERROR)
+				{
+					firstRun 	= false;
+					broken 		= true;
+					throw Exception("Filter::processCompute : Exception caught on first run of filter " + getFullName() + ". The error occured after deinitialization, GL error : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err) + ".", __FILE__, __LINE__, Exception::CoreException);
+				}
+				else
+					firstRun 	= false; // First run completed successfully.
+			}
+		#else
+			throw Exception("Filter::processCompute - Compute shaders are not supported in this build (filter " + getFullName() + ").", __FILE__, __LINE__, Exception::CoreException);
+		#endif
+	}
+
+	/**
+	\fn void Filter::processBatch(const std::vector<HdlFBO*>& renderers, const std::vector< std::vector<HdlTexture*> >& batchArguments)
+	\brief Apply the filter on several sets of inputs, the program and the rendering states being set only once.
+	\param renderers The FBOs to use as targets, one per entry.
+	\param batchArguments The input textures of each entry (must contain as many textures as the filter has input ports).
+	**/
+	void Filter::processBatch(const std::vector<HdlFBO*>& renderers, const std::vector< std::vector<HdlTexture*> >& batchArguments)
+	{
+		if(renderers.size()!=batchArguments.size())
+			throw Exception("Filter::processBatch - The number of renderers (" + toString(renderers.size()) + ") does not match the number of arguments sets (" + toString(batchArguments.size()) + ") for Filter " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+
+		// The compute shaders do not have rendering states to share :
+		if(isComputeFilter())
+		{
+			for(unsigned int k=0; k<renderers.size(); k++)
+			{
+				if(static_cast<int>(batchArguments[k].size())!=getNumInputPort())
+					throw Exception("Filter::processBatch - Wrong number of arguments for Filter " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+
+				arguments = batchArguments[k];
+				process(*renderers[k]);
+			}
+			return ;
+		}
+
+		unsigned int start = 0;
+
+		// The first run goes through the standard (checked) path :
+		if(firstRun && !renderers.empty())
+		{
+			arguments = batchArguments[0];
+			process(*renderers[0]);
+			start = 1;
+		}
+
+		if(start>=renderers.size())
+			return ;
+
+		for(unsigned int k=start; k<renderers.size(); k++)
+		{
+			if(renderers[k]->getAttachmentCount()<getNumOutputPort())
+				throw Exception("Filter::processBatch - Renderer doesn't have as many texture targets as Filter " + getFullName() + " has outputs.", __FILE__, __LINE__, Exception::CoreException);
+			if(static_cast<int>(batchArguments[k].size())!=getNumInputPort())
+				throw Exception("Filter::processBatch - Wrong number of arguments for Filter " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+			if(isDepthTestingEnabled() && !renderers[k]->hasDepthBuffer())
+				renderers[k]->addDepthBuffer();
+		}
+
+		// Enable states
+			HandleOpenGL::setCapability(GL_DEPTH_TEST, isDepthTestingEnabled());
+			if(isDepthTestingEnabled())
+				HandleOpenGL::setDepthFunction(getDepthTestingFunction());
+
+			HandleOpenGL::setCapability(GL_BLEND, isBlendingEnabled());
+			if(isBlendingEnabled())
+				HandleOpenGL::setBlending(getSFactor(), getDFactor(), getBlendingEquation());
+
+			if(isClearingEnabled())
+				HandleOpenGL::setClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+		// Prepare geometry
+			HandleOpenGL::loadIdentity();
+
+		// Load the shader
+			prgm->use();
+
+		for(unsigned int k=start; k<renderers.size(); k++)
+		{
+			renderers[k]->beginRendering(getNumOutputPort(), isDepthTestingEnabled());
+
+			if(isClearingEnabled())
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+			// The bindings are reset by the mipmaps generation in HdlFBO::endRendering :
+			for(int i=0; i<getNumInputPort(); i++)
+				batchArguments[k][i]->bind(i);
+
+			if(isLayered())
+				geometry->drawInstanced(getNumLayers());
+			else if(getNumInstances()>1)
+				geometry->drawInstanced(getNumInstances());
+			else
+				geometry->draw();
+
+			renderers[k]->endRendering();
+		}
+
+		// Stop using the shader
+			HdlProgram::stopProgram();
+
+		// Remove from stack
+			if(isDepthTestingEnabled())
+				HandleOpenGL::setCapability(GL_DEPTH_TEST, false);
+
+			if(isBlendingEnabled())
+				HandleOpenGL::setCapability(GL_BLEND, false);
+
+		// Unload
+			for(int i=0; i<getNumInputPort(); i++)
+				HdlTexture::unbind(i);
+
+		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+			OPENGL_ERROR_TRACKER("Filter::processBatch", "geometry->draw()")
+		#endif
+	}
+
 	/**
 	\fn HdlProgram& Filter::program(void)
 	\brief Access the program carried.
@@ -666,6 +1048,193 @@
 		return !firstRun;
 	}
 
+	/**
+	\fn bool Filter::isComputeAvailable(void)
+	\brief Check if the compute shaders (and the image load/store operations) are supported.
+	\return True if the compute filters can be used.
+	**/
+	bool Filter::isComputeAvailable(void)
+	{
+		#ifdef GLIP_USE_GL
+			return GLEW_VERSION_4_3 || (GLEW_ARB_compute_shader && GLEW_ARB_shader_image_load_store);
+		#elif defined(GL_ES_VERSION_3_1)
+			return true;
+		#else
+			return false;
+		#endif
+	}
+
+	/**
+	\fn bool Filter::isLayeredRenderingAvailable(void)
+	\brief Check if the layered rendering (to arrays and 3D textures, see HdlAbstractTextureFormat::isLayered()) is supported.
+	\return True if the filters can render to layered formats.
+	**/
+	bool Filter::isLayeredRenderingAvailable(void)
+	{
+		#ifdef GLIP_USE_GL
+			return (GLEW_VERSION_3_2 || GLEW_ARB_geometry_shader4) && HdlVBO::isInstancingAvailable();
+		#elif defined(GL_ES_VERSION_3_2)
+			return true;
+		#else
+			return false;
+		#endif
+	}
+
+	/**
+	\fn bool Filter::isVertexLayerAvailable(void)
+	\brief Check if gl_Layer can be written from the vertex shader (AMD_vertex_shader_layer), without a geometry shader.
+	\return True if the vertex shader can select the layer.
+	**/
+	bool Filter::isVertexLayerAvailable(void)
+	{
+		#ifdef GLIP_USE_GL
+			return GLEW_AMD_vertex_shader_layer;
+		#else
+			return false;
+		#endif
+	}
+
+	/**
+	\fn std::string Filter::getLayeredVertexSource(bool vertexLayer)
+	\brief Get the vertex shader used in the layered mode when the filter does not have one. The instance index is the layer index.
+	\param vertexLayer If true, the vertex shader writes gl_Layer, texCoord and layer. Otherwise, it writes vTexCoord and vLayer for a geometry shader.
+	\return The source of the vertex shader.
+	**/
+	std::string Filter::getLayeredVertexSource(bool vertexLayer)
+	{
+		const std::string	texCoordName	= vertexLayer ? "texCoord" : "vTexCoord",
+					layerName	= vertexLayer ? "layer" : "vLayer";
+
+		return	"#version 150\n" +
+			std::string(vertexLayer ? "#extension GL_AMD_vertex_shader_layer : require\n" : "") +
+			"in vec4 " + HdlVBO::positionAttributeName + ";\n"
+			"in vec2 " + HdlVBO::texCoordAttributeName + ";\n"
+			"out vec2 " + texCoordName + ";\n"
+			"flat out int " + layerName + ";\n"
+			"void main()\n"
+			"{\n"
+			"	gl_Position = " + HdlVBO::positionAttributeName + ";\n"
+			"	" + texCoordName + " = " + HdlVBO::texCoordAttributeName + ";\n"
+			"	" + layerName + " = gl_InstanceID;\n" +
+			std::string(vertexLayer ? "	gl_Layer = gl_InstanceID;\n" : "") +
+			"}\n";
+	}
+
+	/**
+	\fn std::string Filter::getLayeredGeometrySource(GLenum primitive)
+	\brief Get the pass-through geometry shader writing gl_Layer, used in the layered mode when the vertex shader cannot select the layer.
+	\param primitive The primitive of the geometry (see GeometryModel), adjacency primitives are not supported.
+	\return The source of the geometry shader.
+	**/
+	std::string Filter::getLayeredGeometrySource(GLenum primitive)
+	{
+		std::string	inputLayout,
+				outputLayout;
+		int		numVertices = 0;
+
+		switch(primitive)
+		{
+			case GL_POINTS :
+				inputLayout	= "points";
+				outputLayout	= "points";
+				numVertices	= 1;
+				break;
+			case GL_LINES :
+			case GL_LINE_STRIP :
+			case GL_LINE_LOOP :
+				inputLayout	= "lines";
+				outputLayout	= "line_strip";
+				numVertices	= 2;
+				break;
+			case GL_TRIANGLES :
+			case GL_TRIANGLE_STRIP :
+			case GL_TRIANGLE_FAN :
+				inputLayout	= "triangles";
+				outputLayout	= "triangle_strip";
+				numVertices	= 3;
+				break;
+			default :
+				throw Exception("Filter::getLayeredGeometrySource - Primitive " + getGLEnumNameSafe(primitive) + " is not supported in the layered mode without a geometry shader.", __FILE__, __LINE__, Exception::CoreException);
+		}
+
+		return	"#version 150\n"
+			"layout(" + inputLayout + ") in;\n"
+			"layout(" + outputLayout + ", max_vertices=" + toString(numVertices) + ") out;\n"
+			"in vec2 vTexCoord[];\n"
+			"flat in int vLayer[];\n"
+			"out vec2 texCoord;\n"
+			"flat out int layer;\n"
+			"void main()\n"
+			"{\n"
+			"	for(int k=0; k<" + toString(numVertices) + "; k++)\n"
+			"	{\n"
+			"		gl_Position = gl_in[k].gl_Position;\n"
+			"		texCoord = vTexCoord[k];\n"
+			"		layer = vLayer[k];\n"
+			"		gl_Layer = vLayer[k];\n"
+			"		EmitVertex();\n"
+			"	}\n"
+			"	EndPrimitive();\n"
+			"}\n";
+	}
+
+	/**
+	\fn bool Filter::isImageFormat(GLenum mode)
+	\brief Check if a texture format can be bound to an image unit (see glBindImageTexture).
+	\param mode The internal format of the texture.
+	\return True if the format can be used as an output of a compute filter.
+	**/
+	bool Filter::isImageFormat(GLenum mode)
+	{
+		switch(mode)
+		{
+			case GL_RGBA32F :
+			case GL_RGBA16F :
+			case GL_R32F :
+			case GL_RGBA32UI :
+			case GL_RGBA16UI :
+			case GL_RGBA8UI :
+			case GL_R32UI :
+			case GL_RGBA32I :
+			case GL_RGBA16I :
+			case GL_RGBA8I :
+			case GL_R32I :
+			case GL_RGBA8 :
+			case GL_RGBA8_SNORM :
+		#ifdef GLIP_USE_GL
+			case GL_RG32F :
+			case GL_RG16F :
+			case GL_R11F_G11F_B10F :
+			case GL_R16F :
+			case GL_RGB10_A2UI :
+			case GL_RG32UI :
+			case GL_RG16UI :
+			case GL_RG8UI :
+			case GL_R16UI :
+			case GL_R8UI :
+			case GL_RG32I :
+			case GL_RG16I :
+			case GL_RG8I :
+			case GL_R16I :
+			case GL_R8I :
+			case GL_RGBA16 :
+			case GL_RGB10_A2 :
+			case GL_RG16 :
+			case GL_RG8 :
+			case GL_R16 :
+			case GL_R8 :
+			case GL_RGBA16_SNORM :
+			case GL_RG16_SNORM :
+			case GL_RG8_SNORM :
+			case GL_R16_SNORM :
+			case GL_R8_SNORM :
+		#endif
+				return true;
+			default :
+				return false;
+		}
+	}
+
 	/**
 	\fn bool Filter::isBroken(void) const
 	\brief Check if the filter is broken (its initialization failed, or an error occured during its first run).
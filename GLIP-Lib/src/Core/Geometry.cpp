@@ -52,6 +52,12 @@
 		elementStride(getPrimitiveStride(_primitiveGL)),
 		primitiveGL(_primitiveGL)
 	{
+		hash = 0;
+		hashValid = false;
+		proceduralSize[0] = 0;
+		proceduralSize[1] = 0;
+		proceduralSize[2] = 0;
+
 		if(dim!=2 && dim!=3)
 			throw Exception("GeometryModel::GeometryModel - Dimension must be either 2 or 3 (current : " + toString(dim) + ").", __FILE__, __LINE__, Exception::CoreException);
 	}
@@ -73,7 +79,13 @@
 		numVerticesPerElement(mdl.numVerticesPerElement),
 		elementStride(mdl.elementStride),
 		primitiveGL(mdl.primitiveGL)
-	{ }
+	{
+		hash = mdl.hash;
+		hashValid = mdl.hashValid;
+		proceduralSize[0] = mdl.proceduralSize[0];
+		proceduralSize[1] = mdl.proceduralSize[1];
+		proceduralSize[2] = mdl.proceduralSize[2];
+	}
 
 	GeometryModel::~GeometryModel(void)
 	{
@@ -140,6 +152,8 @@
 	**/
 	void GeometryModel::addVertices2DInterleaved(const size_t N, const GLfloat* interleavedXY, const GLfloat* interleavedNormalsXY, const GLfloat* interleavedUV)
 	{
+		hashValid = false;
+
 		if(dim!=2)
 			throw Exception("GeometryModel::addVertices2D - Dimensions should be equal to 2 (current : " + toString(dim) + ").", __FILE__, __LINE__, Exception::CoreException);
 
@@ -177,6 +191,8 @@
 	**/
 	void GeometryModel::addVertices2D(const size_t N, const GLfloat* x, const GLfloat* y, const GLfloat* nx, const GLfloat* ny, const GLfloat* u, const GLfloat* v)
 	{
+		hashValid = false;
+
 		if(dim!=2)
 			throw Exception("GeometryModel::addVertices2D - Dimensions should be equal to 2 (current : " + toString(dim) + ").", __FILE__, __LINE__, Exception::CoreException);
 
@@ -227,6 +243,8 @@
 	**/
 	GLuint GeometryModel::addVertex2D(const GLfloat& x, const GLfloat& y, const GLfloat& nx, const GLfloat& ny, const GLfloat& u, const GLfloat& v)
 	{
+		hashValid = false;
+
 		//if(dim!=2)
 		//	throw Exception("GeometryModel::addVertex2D - Dimensions should be equal to 2 (current : " + toString(dim) + ").", __FILE__, __LINE__, Exception::CoreException);
 
@@ -260,6 +278,8 @@
 	**/
 	void GeometryModel::addVertices3DInterleaved(const size_t N, const GLfloat* interleavedXYZ, const GLfloat* interleavedNormalsXYZ, const GLfloat* interleavedUV)
 	{
+		hashValid = false;
+
 		if(dim!=2)
 			throw Exception("GeometryModel::addVertices3D - Dimensions should be equal to 2 (current : " + toString(dim) + ").", __FILE__, __LINE__, Exception::CoreException);
 
@@ -299,6 +319,8 @@
 	**/
 	void GeometryModel::addVertices3D(const size_t N, const GLfloat* x, const GLfloat* y, const GLfloat* z, const GLfloat* nx, const GLfloat* ny, const GLfloat* nz, const GLfloat* u, const GLfloat* v)
 	{
+		hashValid = false;
+
 		//if(dim!=3)
 		//	throw Exception("GeometryModel::addVertices3D - Dimensions should be equal to 3 (current : " + toString(dim) + ").", __FILE__, __LINE__, Exception::CoreException);
 
@@ -353,6 +375,8 @@
 	**/
 	GLuint GeometryModel::addVertex3D(const GLfloat& x, const GLfloat& y, const GLfloat& z, const GLfloat& nx, const GLfloat& ny, const GLfloat& nz, const GLfloat& u, const GLfloat& v)
 	{
+		hashValid = false;
+
 		//if(dim!=3)
 		//	throw Exception("GeometryModel::addVertex3D - Dimensions should be equal to 3 (current : " + toString(dim) + ").", __FILE__, __LINE__, Exception::CoreException);
 
@@ -384,6 +408,8 @@
 	**/
 	void GeometryModel::addElementsInterleaved(const size_t N, GLuint* interleavedIndices)
 	{
+		hashValid = false;
+
 		elements.insert(elements.end(), interleavedIndices, interleavedIndices+N*numVerticesPerElement);
 	}
 
@@ -400,6 +426,8 @@
 	**/
 	void GeometryModel::addElements(const size_t N, GLuint* a, GLuint* b, GLuint* c, GLuint* d)
 	{
+		hashValid = false;
+
 		if(elementStride!=numVerticesPerElement)
 			throw Exception("GeometryModel::addElements - Cannot insert non-interleaved data in stripped primitive.", __FILE__, __LINE__, Exception::CoreException);
 		if((numVerticesPerElement>=1 && a==NULL) || (numVerticesPerElement>=2 && b==NULL) || (numVerticesPerElement>=3 && c==NULL) || (numVerticesPerElement>=4 && d==NULL) || numVerticesPerElement>4)
@@ -423,6 +451,8 @@
 	**/
 	GLuint GeometryModel::addElement(GLuint a)
 	{
+		hashValid = false;
+
 		//const int expectedNumberOfVertices = 1;
 		//if(numVerticesPerElement!=expectedNumberOfVertices)
 		//	throw Exception("GeometryModel::addElement - Wrong number of vertex indices (" + toString(expectedNumberOfVertices) + " argument(s) received, " + toString(numVerticesPerElement) + " expected ).", __FILE__, __LINE__, Exception::CoreException);
@@ -440,6 +470,8 @@
 	**/
 	GLuint GeometryModel::addElement(GLuint a, GLuint b)
 	{
+		hashValid = false;
+
 		//const int expectedNumberOfVertices = 2;
 		//if(numVerticesPerElement!=expectedNumberOfVertices)
 		//	throw Exception("GeometryModel::addElement - Wrong number of vertex indices (" + toString(expectedNumberOfVertices) + " argument(s) received, " + toString(numVerticesPerElement) + " expected ).", __FILE__, __LINE__, Exception::CoreException);
@@ -459,6 +491,8 @@
 	**/
 	GLuint GeometryModel::addElement(GLuint a, GLuint b, GLuint c)
 	{
+		hashValid = false;
+
 		//const int expectedNumberOfVertices = 3;
 		//if(numVerticesPerElement!=expectedNumberOfVertices)
 		//	throw Exception("GeometryModel::addElement - Wrong number of vertex indices (" + toString(expectedNumberOfVertices) + " argument(s) received, " + toString(numVerticesPerElement) + " expected ).", __FILE__, __LINE__, Exception::CoreException);
@@ -480,6 +514,8 @@
 	**/
 	GLuint GeometryModel::addElement(GLuint a, GLuint b, GLuint c, GLuint d)
 	{
+		hashValid = false;
+
 		//const int expectedNumberOfVertices = 4;
 		//if(numVerticesPerElement!=expectedNumberOfVertices)
 		//	throw Exception("GeometryModel::addElement - Wrong number of vertex indices (" + toString(expectedNumberOfVertices) + " argument(s) received, " + toString(numVerticesPerElement) + " expected ).", __FILE__, __LINE__, Exception::CoreException);
@@ -499,6 +535,8 @@
 	**/
 	GLuint GeometryModel::addElement(const std::vector<GLuint>& indices)
 	{
+		hashValid = false;
+
 		//if(numVerticesPerElement!=static_cast<int>(indices.size()))
 		//	throw Exception("GeometryModel::addElement - Wrong number of vertex indices (" + toString(indices.size()) + " argument(s) received, " + toString(numVerticesPerElement) + " expected ).", __FILE__, __LINE__, Exception::CoreException);
 		elements.insert(elements.end(), indices.begin(), indices.end());
@@ -513,6 +551,8 @@
 	**/
 	void GeometryModel::generateNormals(void)
 	{
+		hashValid = false;
+
 		const GLuint nElements = getNumElements();
 		normals.clear();
 		normals.assign(vertices.size(), 0.0f);
@@ -614,6 +654,7 @@
 	**/
 	GLfloat& GeometryModel::x(GLuint i)
 	{
+		hashValid = false;
 		return vertices[i*dim+0];
 	}
 
@@ -625,6 +666,7 @@
 	**/
 	GLfloat& GeometryModel::y(GLuint i)
 	{
+		hashValid = false;
 		return vertices[i*dim+1];
 	}
 
@@ -636,6 +678,8 @@
 	**/
 	GLfloat& GeometryModel::z(GLuint i)
 	{
+		hashValid = false;
+
 		/*if(dim<3)
 			throw Exception("GeometryModel::z - This geometry has only " + toString(dim) + " dimensions.", __FILE__, __LINE__, Exception::CoreException);*/
 		return vertices[i*dim+2];
@@ -649,6 +693,7 @@
 	**/
 	GLfloat& GeometryModel::nx(GLuint i)
 	{
+		hashValid = false;
 		return normals[i*dim+0];
 	}
 
@@ -660,6 +705,7 @@
 	**/
 	GLfloat& GeometryModel::ny(GLuint i)
 	{
+		hashValid = false;
 		return normals[i*dim+1];
 	}
 
@@ -671,6 +717,8 @@
 	**/
 	GLfloat& GeometryModel::nz(GLuint i)
 	{
+		hashValid = false;
+
 		/*if(dim<3)
 			throw Exception("GeometryModel::z - This geometry has only " + toString(dim) + " dimensions.", __FILE__, __LINE__, Exception::CoreException);*/
 		return normals[i*dim+2];
@@ -684,6 +732,8 @@
 	**/
 	GLfloat& GeometryModel::u(GLuint i)
 	{
+		hashValid = false;
+
 		/*if(!hasTexCoords)
 			throw Exception("GeometryModel::u - Current geometry does not have texture coordinates.", __FILE__, __LINE__, Exception::CoreException);*/
 		return texCoords[i*2+0];
@@ -697,6 +747,8 @@
 	**/
 	GLfloat& GeometryModel::v(GLuint i)
 	{
+		hashValid = false;
+
 		/*if(!hasTexCoords)
 			throw Exception("GeometryModel::v - Current geometry does not have texture coordinates.", __FILE__, __LINE__, Exception::CoreException);*/
 		return texCoords[i*2+1];
@@ -710,6 +762,8 @@
 	**/
 	GLuint& GeometryModel::a(GLuint i)
 	{
+		hashValid = false;
+
 		/*const int expectedNumberOfVertices = 1;
 		if(numVerticesPerElement<expectedNumberOfVertices)
 			throw Exception("GeometryModel::a - Wrong number of vertex indices (" + toString(expectedNumberOfVertices) + " argument(s) received, " + toString(numVerticesPerElement) + " expected ).", __FILE__, __LINE__, Exception::CoreException);
@@ -725,6 +779,8 @@
 	**/
 	GLuint& GeometryModel::b(GLuint i)
 	{
+		hashValid = false;
+
 		/*const int expectedNumberOfVertices = 2;
 		if(numVerticesPerElement<expectedNumberOfVertices)
 			throw Exception("GeometryModel::a - Wrong number of vertex indices (" + toString(expectedNumberOfVertices) + " argument(s) received, " + toString(numVerticesPerElement) + " expected ).", __FILE__, __LINE__, Exception::CoreException);
@@ -740,6 +796,8 @@
 	**/
 	GLuint& GeometryModel::c(GLuint i)
 	{
+		hashValid = false;
+
 		/*const int expectedNumberOfVertices = 3;
 		if(numVerticesPerElement<expectedNumberOfVertices)
 			throw Exception("GeometryModel::a - Wrong number of vertex indices (" + toString(expectedNumberOfVertices) + " argument(s) received, " + toString(numVerticesPerElement) + " expected ).", __FILE__, __LINE__, Exception::CoreException);
@@ -755,6 +813,8 @@
 	**/
 	GLuint& GeometryModel::d(GLuint i)
 	{
+		hashValid = false;
+
 		/*const int expectedNumberOfVertices = 4;
 		if(numVerticesPerElement<expectedNumberOfVertices)
 			throw Exception("GeometryModel::a - Wrong number of vertex indices (" + toString(expectedNumberOfVertices) + " argument(s) received, " + toString(numVerticesPerElement) + " expected ).", __FILE__, __LINE__, Exception::CoreException);
@@ -929,7 +989,57 @@
 	**/
 	unsigned int GeometryModel::getNumVertices(void) const
 	{
-		return vertices.size() / dim;
+		if(isProcedural())
+			return proceduralSize[0]*proceduralSize[1]*proceduralSize[2];
+		else
+			return vertices.size() / dim;
+	}
+
+	/**
+	\fn bool GeometryModel::isProcedural(void) const
+	\return True if the model has no vertex data, the positions of its points being computed in the vertex shader (see GeometryPrimitives::ProceduralGrid).
+	**/
+	bool GeometryModel::isProcedural(void) const
+	{
+		return proceduralSize[0]>0;
+	}
+
+	/**
+	\fn void GeometryModel::getProceduralSize(int& w, int& h, int& d) const
+	\brief Get the size of the grid of a procedural model.
+	\param w Number of points along the X dimension.
+	\param h Number of points along the Y dimension.
+	\param d Number of points along the Z dimension.
+	**/
+	void GeometryModel::getProceduralSize(int& w, int& h, int& d) const
+	{
+		if(!isProcedural())
+			throw Exception("GeometryModel::getProceduralSize - The model is not procedural.", __FILE__, __LINE__, Exception::CoreException);
+
+		w = proceduralSize[0];
+		h = proceduralSize[1];
+		d = proceduralSize[2];
+	}
+
+	/**
+	\fn void GeometryModel::setProceduralSize(int w, int h, int d)
+	\brief Declare the model as a procedural grid, drawn without vertex data.
+	\param w Number of points along the X dimension.
+	\param h Number of points along the Y dimension.
+	\param d Number of points along the Z dimension.
+	**/
+	void GeometryModel::setProceduralSize(int w, int h, int d)
+	{
+		hashValid = false;
+
+		if(w<=0 || h<=0 || d<=0)
+			throw Exception("GeometryModel::setProceduralSize - Invalid grid size : " + toString(w) + "x" + toString(h) + "x" + toString(d) + ".", __FILE__, __LINE__, Exception::CoreException);
+		if(!vertices.empty() || primitiveGL!=GL_POINTS)
+			throw Exception("GeometryModel::setProceduralSize - A procedural model must be made of points and cannot have vertex data.", __FILE__, __LINE__, Exception::CoreException);
+
+		proceduralSize[0] = w;
+		proceduralSize[1] = h;
+		proceduralSize[2] = d;
 	}
 
 	/**
@@ -964,6 +1074,54 @@
 		return true;	
 	}
 
+	void GeometryModel::hashBytes(unsigned long long& h, const void* data, size_t size)
+	{
+		// FNV-1a :
+		const unsigned char* ptr = reinterpret_cast<const unsigned char*>(data);
+		for(size_t k=0; k<size; k++)
+		{
+			h ^= ptr[k];
+			h *= 1099511628211ULL;
+		}
+	}
+
+	/**
+	\fn unsigned long long GeometryModel::getHash(void) const
+	\brief Get a hash of the content of the model. It is computed once and kept until the model is modified.
+	\return The 64 bits hash of the model (two identical models have the same hash, the reverse is not guaranteed).
+	**/
+	unsigned long long GeometryModel::getHash(void) const
+	{
+		if(!hashValid)
+		{
+			const int header[6] = {hasNormals, hasTexCoords, dim, numVerticesPerElement, static_cast<int>(primitiveGL), 0};
+
+			hash = 14695981039346656037ULL;
+			hashBytes(hash, header, sizeof(header));
+			hashBytes(hash, proceduralSize, sizeof(proceduralSize));
+			if(!vertices.empty())
+				hashBytes(hash, &vertices.front(), vertices.size()*sizeof(GLfloat));
+			if(!normals.empty())
+				hashBytes(hash, &normals.front(), normals.size()*sizeof(GLfloat));
+			if(!texCoords.empty())
+				hashBytes(hash, &texCoords.front(), texCoords.size()*sizeof(GLfloat));
+			if(!elements.empty())
+				hashBytes(hash, &elements.front(), elements.size()*sizeof(GLuint));
+			hashValid = true;
+		}
+		return hash;
+	}
+
+	/**
+	\fn size_t GeometryModel::getDataSize(void) const
+	\brief Get the size of the data of the model, as uploaded to the VBO.
+	\return The size in bytes.
+	**/
+	size_t GeometryModel::getDataSize(void) const
+	{
+		return (vertices.size() + normals.size() + texCoords.size())*sizeof(GLfloat) + elements.size()*sizeof(GLuint);
+	}
+
 	/**
 	\fn bool GeometryModel::operator==(const GeometryModel& mdl) const
 	\brief Test if two models are identical.
@@ -976,6 +1134,9 @@
 			&&	(dim==mdl.dim)
 			&&	(numVerticesPerElement==mdl.numVerticesPerElement)
 			&&	(primitiveGL==mdl.primitiveGL)
+			&&	(std::equal(proceduralSize, proceduralSize+3, mdl.proceduralSize))
+			&&	(vertices.size()==mdl.vertices.size())
+			&&	(elements.size()==mdl.elements.size())
 			&& 	(std::equal(vertices.begin(), vertices.end(), mdl.vertices.begin()))
 			&& 	(std::equal(normals.begin(), normals.end(), mdl.normals.begin()))
 			&&	(std::equal(texCoords.begin(), texCoords.end(), mdl.texCoords.begin()))
@@ -990,6 +1151,8 @@
 	**/
 	HdlVBO* GeometryModel::getVBO(GLenum freq) const
 	{
+		if(isProcedural())
+			return new HdlVBO(getNumVertices());
 		if(vertices.empty())
 			throw Exception("GeometryModel::getVBO - Empty vertices list.", __FILE__, __LINE__, Exception::CoreException);
 
@@ -1105,6 +1268,7 @@
 	std::map<int, HdlVBO*> 		GeometryInstance::vbos;
 	std::map<int, GeometryModel*>	GeometryInstance::models;
 	std::map<int, int>		GeometryInstance::counters;
+	std::multimap<unsigned long long, int> GeometryInstance::hashes;
 
 	/**
 	\fn GeometryInstance::GeometryInstance(const GeometryModel& mdl, GLenum freq)
@@ -1115,13 +1279,16 @@
  	GeometryInstance::GeometryInstance(const GeometryModel& mdl, GLenum freq)
 	 : id(-1)
 	{
-		// Find if a similar model exist : 
-		for(std::map<int, GeometryModel*>::iterator it=models.begin(); it!=models.end(); it++)
+		// Find if a similar model exist (full comparison only among the models with the same hash) : 
+		const unsigned long long hash = mdl.getHash();
+		std::pair<std::multimap<unsigned long long, int>::iterator, std::multimap<unsigned long long, int>::iterator> range = hashes.equal_range(hash);
+
+		for(std::multimap<unsigned long long, int>::iterator it=range.first; it!=range.second; it++)
 		{
-			if(it->second!=NULL && (*it->second)==mdl)
+			if((*models[it->second])==mdl)
 			{
 				// Found!
-				id = it->first;
+				id = it->second;
 				counters[id]++;
 				break;
 			}
@@ -1136,6 +1303,7 @@
 			vbos[id] 	= mdl.getVBO(freq);
 			models[id] 	= new GeometryModel(mdl);
 			counters[id] 	= 1;
+			hashes.insert(std::pair<unsigned long long, int>(hash, id));
 		}
 	}
 
@@ -1157,6 +1325,16 @@
 		// If there is no reference anymore :
 		if(counters[id]<=0)
 		{
+			std::pair<std::multimap<unsigned long long, int>::iterator, std::multimap<unsigned long long, int>::iterator> range = hashes.equal_range(models[id]->getHash());
+			for(std::multimap<unsigned long long, int>::iterator it=range.first; it!=range.second; it++)
+			{
+				if(it->second==id)
+				{
+					hashes.erase(it);
+					break;
+				}
+			}
+
 			delete vbos[id];
 			delete models[id];
 
@@ -1195,6 +1373,48 @@
 		vbos[id]->draw();
 	}
 
+	/**
+	\fn void GeometryInstance::drawInstanced(int numInstances)
+	\brief Draw several instances of this geometry in a single call (see HdlVBO::drawInstanced).
+	\param numInstances Number of instances to draw.
+	**/
+	void GeometryInstance::drawInstanced(int numInstances)
+	{
+		vbos[id]->drawInstanced(numInstances);
+	}
+
+	/**
+	\fn int GeometryInstance::getNumSharedVBOs(void)
+	\brief Get the number of VBOs currently shared by several instances.
+	\return The number of shared VBOs.
+	**/
+	int GeometryInstance::getNumSharedVBOs(void)
+	{
+		int n = 0;
+		for(std::map<int, int>::const_iterator it=counters.begin(); it!=counters.end(); it++)
+		{
+			if(it->second>1)
+				n++;
+		}
+		return n;
+	}
+
+	/**
+	\fn size_t GeometryInstance::getSavedBytes(void)
+	\brief Get the amount of GPU memory saved by sharing the VBOs between the instances of identical models.
+	\return The number of bytes which would have been uploaded without sharing.
+	**/
+	size_t GeometryInstance::getSavedBytes(void)
+	{
+		size_t s = 0;
+		for(std::map<int, int>::const_iterator it=counters.begin(); it!=counters.end(); it++)
+		{
+			if(it->second>1)
+				s += static_cast<size_t>(it->second-1)*models[it->first]->getDataSize();
+		}
+		return s;
+	}
+
 // Geometries :
 	using namespace GeometryPrimitives;
 
@@ -1351,6 +1571,35 @@
 			normalized(mdl.normalized)
 		{ }
 
+	// Procedural grid of points
+		/**
+		\fn ProceduralGrid::ProceduralGrid(int w, int h, int d)
+		\brief ProceduralGrid constructor.
+		\param w Number of points along the X dimension.
+		\param h Number of points along the Y dimension.
+		\param d Number of points along the Z dimension.
+		**/
+		ProceduralGrid::ProceduralGrid(int w, int h, int d)
+		 : 	GeometryModel(GeometryModel::ProceduralGrid, (d>1) ? 3 : 2, GL_POINTS, false, false),
+			width(w),
+			height(h),
+			depth(d)
+		{
+			setProceduralSize(w, h, d);
+		}
+
+		/**
+		\fn ProceduralGrid::ProceduralGrid(const ProceduralGrid& mdl)
+		\brief Copy constructor.
+		\param mdl Original model.
+		**/
+		ProceduralGrid::ProceduralGrid(const ProceduralGrid& mdl)
+		 : 	GeometryModel(mdl),
+			width(mdl.width),
+			height(mdl.height),
+			depth(mdl.depth)
+		{ }
+
 	// Custom model : 
 		/**
 		\fn CustomModel::CustomModel(int _dim, GLenum _primitiveGL, bool _hasNormals, bool _hasTexCoords)
@@ -23,6 +23,12 @@
 	// Includes :
 	#include "Core/HdlDynamicData.hpp"
 
+	// The F16C instructions convert 8 values at once (MSVC does not define __F16C__, AVX2 implies it) :
+	#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+		#define __GLIPLIB_USE_F16C__
+		#include <immintrin.h>
+	#endif
+
 	// Namespaces :
 	using namespace Glip;
 	using namespace Glip::CoreGL;
@@ -345,6 +351,156 @@
 		return os;
 	}
 
+// HalfFloat :
+	/**
+	\fn HalfFloat::HalfFloat(void)
+	\brief HalfFloat constructor (zero).
+	**/
+	HalfFloat::HalfFloat(void)
+	 :	bits(0)
+	{ }
+
+	/**
+	\fn HalfFloat::HalfFloat(const float& value)
+	\brief HalfFloat constructor.
+	\param value The value to convert.
+	**/
+	HalfFloat::HalfFloat(const float& value)
+	 :	bits(toHalf(value))
+	{ }
+
+	/**
+	\fn HalfFloat::operator float(void) const
+	\brief Convert to single precision.
+	\return The value as a float.
+	**/
+	HalfFloat::operator float(void) const
+	{
+		return toFloat(bits);
+	}
+
+	/**
+	\fn unsigned short HalfFloat::toHalf(const float& value)
+	\brief Convert a single precision value to half precision (rounding to the nearest, ties to even).
+	\param value The value to convert.
+	\return The bits of the half precision value.
+	**/
+	unsigned short HalfFloat::toHalf(const float& value)
+	{
+		unsigned int f = 0;
+		std::memcpy(&f, &value, sizeof(f));
+
+		const unsigned int	sign		= (f >> 16) & 0x8000u,
+					exponent	= (f >> 23) & 0xFFu;
+		unsigned int		mantissa	= f & 0x7FFFFFu;
+
+		// Infinity and NaN (keep NaN quiet) :
+		if(exponent==0xFFu)
+			return static_cast<unsigned short>(sign | 0x7C00u | ((mantissa!=0) ? (0x200u | (mantissa >> 13)) : 0u));
+
+		const int e = static_cast<int>(exponent) - 127 + 15;
+
+		if(e>=31) // Overflow :
+			return static_cast<unsigned short>(sign | 0x7C00u);
+		else if(e<=0) // Denormalized or zero :
+		{
+			if(e<-10)
+				return static_cast<unsigned short>(sign);
+
+			mantissa |= 0x800000u;
+			const unsigned int	shift		= static_cast<unsigned int>(14 - e),
+						halfway		= 1u << (shift - 1),
+						remainder	= mantissa & ((1u << shift) - 1u);
+			unsigned int h = mantissa >> shift;
+			if(remainder>halfway || (remainder==halfway && (h & 1u)!=0))
+				h++;
+			return static_cast<unsigned short>(sign | h);
+		}
+		else
+		{
+			unsigned int h = (static_cast<unsigned int>(e) << 10) | (mantissa >> 13);
+			const unsigned int remainder = mantissa & 0x1FFFu;
+			// (A carry can propagate to the exponent, up to the infinity)
+			if(remainder>0x1000u || (remainder==0x1000u && (h & 1u)!=0))
+				h++;
+			return static_cast<unsigned short>(sign | h);
+		}
+	}
+
+	/**
+	\fn float HalfFloat::toFloat(const unsigned short& h)
+	\brief Convert a half precision value to single precision (exact).
+	\param h The bits of the half precision value.
+	\return The value as a float.
+	**/
+	float HalfFloat::toFloat(const unsigned short& h)
+	{
+		const unsigned int	sign		= (static_cast<unsigned int>(h) & 0x8000u) << 16,
+					exponent	= (static_cast<unsigned int>(h) >> 10) & 0x1Fu;
+		unsigned int		mantissa	= static_cast<unsigned int>(h) & 0x3FFu,
+					f		= 0;
+
+		if(exponent==0)
+		{
+			if(mantissa==0)
+				f = sign;
+			else // Denormalized, renormalize :
+			{
+				unsigned int e = 113;
+				while((mantissa & 0x400u)==0)
+				{
+					mantissa <<= 1;
+					e--;
+				}
+				f = sign | (e << 23) | ((mantissa & 0x3FFu) << 13);
+			}
+		}
+		else if(exponent==0x1Fu) // Infinity and NaN (made quiet, as by the F16C instructions) :
+			f = sign | 0x7F800000u | (mantissa << 13) | ((mantissa!=0) ? 0x400000u : 0u);
+		else
+			f = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+		float value = 0.0f;
+		std::memcpy(&value, &f, sizeof(value));
+		return value;
+	}
+
+	/**
+	\fn void HalfFloat::toHalf(HalfFloat* dst, const float* src, size_t count)
+	\brief Convert an array of single precision values to half precision.
+	\param dst The destination array.
+	\param src The source array.
+	\param count The number of values to convert.
+	**/
+	void HalfFloat::toHalf(HalfFloat* dst, const float* src, size_t count)
+	{
+		size_t k = 0;
+		#ifdef __GLIPLIB_USE_F16C__
+			for(; k+8<=count; k+=8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k), _mm256_cvtps_ph(_mm256_loadu_ps(src + k), 0));
+		#endif
+		for(; k<count; k++)
+			dst[k].bits = toHalf(src[k]);
+	}
+
+	/**
+	\fn void HalfFloat::toFloat(float* dst, const HalfFloat* src, size_t count)
+	\brief Convert an array of half precision values to single precision.
+	\param dst The destination array.
+	\param src The source array.
+	\param count The number of values to convert.
+	**/
+	void HalfFloat::toFloat(float* dst, const HalfFloat* src, size_t count)
+	{
+		size_t k = 0;
+		#ifdef __GLIPLIB_USE_F16C__
+			for(; k+8<=count; k+=8)
+				_mm256_storeu_ps(dst + k, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + k))));
+		#endif
+		for(; k<count; k++)
+			dst[k] = toFloat(src[k].bits);
+	}
+
 // HdlDynamicTable :
 	HdlDynamicTable::HdlDynamicTable(const GLenum& _type, int _columns, int _rows, int _slices, bool _normalized, int _alignment, bool _proxy)
 	 :	rows(_rows),
@@ -377,9 +533,9 @@
 	bool HdlDynamicTable::isFloatingPointType(void) const
 	{
 		#ifdef GLIP_USE_GL
-			return (type==GL_FLOAT) || (type==GL_DOUBLE);
+			return (type==GL_HALF_FLOAT) || (type==GL_FLOAT) || (type==GL_DOUBLE);
 		#else
-			return (type==GL_FLOAT);
+			return (type==GL_HALF_FLOAT) || (type==GL_FLOAT);
 		#endif
 	}
 
@@ -601,9 +757,9 @@
 		HdlDynamicTable* res = NULL;
 
 		#ifdef GLIP_USE_GL
-			_normalized = _normalized && ((type==GL_FLOAT) || (type==GL_DOUBLE));
+			_normalized = _normalized && ((type==GL_HALF_FLOAT) || (type==GL_FLOAT) || (type==GL_DOUBLE));
 		#else
-			_normalized = _normalized && (type==GL_FLOAT);
+			_normalized = _normalized && ((type==GL_HALF_FLOAT) || (type==GL_FLOAT));
 		#endif
 
 		#define GENERATE_ELM(glType, CType) \
@@ -622,6 +778,7 @@
 		else	GENERATE_ELM( 	GL_UNSIGNED_BYTE,	unsigned char)
 		else	GENERATE_ELM( 	GL_SHORT,		short)
 		else	GENERATE_ELM( 	GL_UNSIGNED_SHORT,	unsigned short)
+		else	GENERATE_ELM( 	GL_HALF_FLOAT,		HalfFloat)
 		else	GENERATE_ELM( 	GL_FLOAT, 		float)
 		else	ERROR_ELM( 	GL_FLOAT_VEC2)
 		else	ERROR_ELM( 	GL_FLOAT_VEC3)
@@ -673,9 +830,9 @@
 		HdlDynamicTable* res = NULL;
 
 		#ifdef GLIP_USE_GL
-			_normalized = _normalized && ((type==GL_FLOAT) || (type==GL_DOUBLE));
+			_normalized = _normalized && ((type==GL_HALF_FLOAT) || (type==GL_FLOAT) || (type==GL_DOUBLE));
 		#else
-			_normalized = _normalized && (type==GL_FLOAT);
+			_normalized = _normalized && ((type==GL_HALF_FLOAT) || (type==GL_FLOAT));
 		#endif
 
 		#define GENERATE_ELM(glType, CType) \
@@ -694,6 +851,7 @@
 		else	GENERATE_ELM( 	GL_UNSIGNED_BYTE,	unsigned char)
 		else	GENERATE_ELM( 	GL_SHORT,		short)
 		else	GENERATE_ELM( 	GL_UNSIGNED_SHORT,	unsigned short)
+		else	GENERATE_ELM( 	GL_HALF_FLOAT,		HalfFloat)
 		else	GENERATE_ELM( 	GL_FLOAT, 		float)
 		else	ERROR_ELM( 	GL_FLOAT_VEC2)
 		else	ERROR_ELM( 	GL_FLOAT_VEC3)
@@ -750,6 +908,7 @@
 		else	COPY_ELM( GL_UNSIGNED_BYTE,		unsigned char)
 		else	COPY_ELM( GL_SHORT,			short)
 		else	COPY_ELM( GL_UNSIGNED_SHORT,		unsigned short)
+		else	COPY_ELM( GL_HALF_FLOAT,		HalfFloat)
 		else	COPY_ELM( GL_FLOAT, 			float)
 		#ifdef GLIP_USE_GL
 		else	COPY_ELM( GL_DOUBLE,			double)
@@ -792,6 +951,18 @@
 			{
 				return t;
 			}
+
+			template<>
+			float HdlDynamicTableSpecial<HalfFloat>::normalize(const HalfFloat& t)
+			{
+				return t;
+			}
+
+			template<>
+			HalfFloat HdlDynamicTableSpecial<HalfFloat>::denormalize(const float& t)
+			{
+				return HalfFloat(t);
+			}
 		}
 	}
 
@@ -132,6 +132,9 @@ using namespace Glip::CoreGL;
 		depthBuffer(NULL),
 		depthBufferAttached(false)
 	{
+		mipmapsQueries[0] = 0;
+		mipmapsQueries[1] = 0;
+
 		#ifdef GLIP_USE_GL
 		NEED_EXTENSION(GL_ARB_framebuffer_object)
 		FIX_MISSING_GLEW_CALL(glGenFramebuffers, glGenFramebuffersEXT)
@@ -140,6 +143,9 @@ using namespace Glip::CoreGL;
 		FIX_MISSING_GLEW_CALL(glFramebufferTexture2D, glFramebufferTexture2DEXT)
 		FIX_MISSING_GLEW_CALL(glDrawBuffers, glDrawBuffersARB)
 		FIX_MISSING_GLEW_CALL(glGenerateMipmap, glGenerateMipmapEXT)
+
+		if(isLayered())
+			NEED_EXTENSION((GLEW_VERSION_3_2 || GLEW_ARB_geometry_shader4))
 		#endif
 
 		if(isCompressed())
@@ -149,7 +155,7 @@ using namespace Glip::CoreGL;
 			std::cout << "HdlFBO::HdlFBO - Disabling Depth buffer." << std::endl;
 		#endif
 
-		glDisable(GL_DEPTH_TEST);
+		HandleOpenGL::setCapability(GL_DEPTH_TEST, false);
 
 		glGenFramebuffers(1, &fboID);
 
@@ -170,7 +176,7 @@ using namespace Glip::CoreGL;
 			addTarget();
 
 		// check FBO status
-		glBindFramebuffer(GL_FRAMEBUFFER, 0); //unbind
+		HandleOpenGL::bindFramebuffer(0); //unbind
 	}
 
 	HdlFBO::~HdlFBO(void)
@@ -185,15 +191,16 @@ using namespace Glip::CoreGL;
 			OPENGL_ERROR_TRACKER("HdlFBO::~HdlFBO", "glFlush()")
 		#endif
 
+		HandleOpenGL::forgetFramebuffer(fboID);
 		glDeleteFramebuffers( 1, &fboID);
 
 		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
 			OPENGL_ERROR_TRACKER("HdlFBO::~HdlFBO", "glDeleteFramebuffers()")
 		#endif
 
-		// Delete all textures :
+		// Give the textures back to the pool :
 		for(std::vector<HdlTexture*>::iterator it=targets.begin(); it!=targets.end(); it++)
-			delete (*it);
+			HdlTexturePool::release(*it);
 
 		delete depthBuffer;
 	}
@@ -203,9 +210,19 @@ using namespace Glip::CoreGL;
 		// Entering safe zone :
 		glGetError();
 
-		glBindFramebuffer(GL_FRAMEBUFFER, fboID);
+		HandleOpenGL::bindFramebuffer(fboID);
 
-		glFramebufferTexture2D(GL_FRAMEBUFFER, getAttachment(i), GL_TEXTURE_2D, targets[i]->getID(), 0);
+		// The layers of an array (or the slices of a 3D texture) are all attached, the rendering selects them with gl_Layer :
+		if(targets[i]->isLayered())
+		{
+			#if defined(GLIP_USE_GL) || defined(GL_ES_VERSION_3_2)
+				glFramebufferTexture(GL_FRAMEBUFFER, getAttachment(i), targets[i]->getID(), 0);
+			#else
+				throw Exception("HdlFBO::bindTextureToFBO - Layered rendering is not supported in this build.", __FILE__, __LINE__, Exception::GLException);
+			#endif
+		}
+		else
+			glFramebufferTexture2D(GL_FRAMEBUFFER, getAttachment(i), GL_TEXTURE_2D, targets[i]->getID(), 0);
 
 		GLenum err = glGetError();
 		if(err!=GL_NO_ERROR)
@@ -214,9 +231,16 @@ using namespace Glip::CoreGL;
 
 	void HdlFBO::unbindTextureFromFBO(int i)
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, fboID);
+		HandleOpenGL::bindFramebuffer(fboID);
 
-		glFramebufferTexture2D(GL_FRAMEBUFFER, getAttachment(i), GL_TEXTURE_2D, 0, 0);
+		if(targets[i]->isLayered())
+		{
+			#if defined(GLIP_USE_GL) || defined(GL_ES_VERSION_3_2)
+				glFramebufferTexture(GL_FRAMEBUFFER, getAttachment(i), 0, 0);
+			#endif
+		}
+		else
+			glFramebufferTexture2D(GL_FRAMEBUFFER, getAttachment(i), GL_TEXTURE_2D, 0, 0);
 
 		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
 			OPENGL_ERROR_TRACKER("HdlFBO::unbindTextureFromFBO", "glFramebufferTexture2D()")
@@ -234,7 +258,7 @@ using namespace Glip::CoreGL;
 		else
 		{
 			int i = targets.size();
-			targets.push_back(new HdlTexture(*this));
+			targets.push_back(HdlTexturePool::acquire(*this));
 			targets[i]->fill(0);
 			bindTextureToFBO(i);
 			return i;
@@ -263,10 +287,12 @@ using namespace Glip::CoreGL;
 
 	/**
 	\fn void HdlFBO::addDepthBuffer(void)
-	\brief Add a depth buffer to this Framebuffer object.
+	\brief Add a depth buffer to this Framebuffer object (not available for layered targets).
 	**/
 	void HdlFBO::addDepthBuffer(void)
 	{
+		if(isLayered())
+			throw Exception("HdlFBO::addDepthBuffer - A depth buffer cannot be attached to layered targets.", __FILE__, __LINE__, Exception::GLException);
 		if(depthBuffer==NULL)
 			depthBuffer = new HdlRenderBuffer(GL_DEPTH_COMPONENT, getWidth(), getHeight());
 	}
@@ -305,11 +331,6 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlFBO::beginRendering(int usedTarget, bool useExistingDepthBuffer)
 	{
-		static const GLenum attachmentsList[] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3, GL_COLOR_ATTACHMENT4,
-							GL_COLOR_ATTACHMENT5, GL_COLOR_ATTACHMENT6, GL_COLOR_ATTACHMENT7, GL_COLOR_ATTACHMENT8, GL_COLOR_ATTACHMENT9,
-							GL_COLOR_ATTACHMENT10, GL_COLOR_ATTACHMENT11, GL_COLOR_ATTACHMENT12, GL_COLOR_ATTACHMENT13,GL_COLOR_ATTACHMENT14, GL_COLOR_ATTACHMENT15};
-
-
 		if(usedTarget==0)
 			usedTarget = targets.size();
 
@@ -326,7 +347,7 @@ using namespace Glip::CoreGL;
 			firstRendering = false;
 		}
 
-		glBindFramebuffer(GL_FRAMEBUFFER, fboID);
+		HandleOpenGL::bindFramebuffer(fboID);
 
 		// Attach a depth buffer (uncommon?) : 
 		if(depthBuffer!=NULL && useExistingDepthBuffer)
@@ -335,7 +356,7 @@ using namespace Glip::CoreGL;
 			depthBufferAttached = true;
 		}
 
-		glDrawBuffers(usedTarget, attachmentsList);
+		HandleOpenGL::setDrawBuffers(fboID, usedTarget);
 
 		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
 			OPENGL_ERROR_TRACKER("HdlFBO::beginRendering", "glDrawBuffers()")
@@ -349,7 +370,19 @@ using namespace Glip::CoreGL;
 		//#endif
 
 		// Create a new viewport configuration
-		glViewport(0,0,getWidth(),getHeight());
+		HandleOpenGL::setViewport(0, 0, getWidth(), getHeight());
+	}
+
+	/**
+	\fn void HdlFBO::setMipmapsQueries(GLuint beforeQuery, GLuint afterQuery)
+	\brief Time the mipmaps generation of the next call to HdlFBO::endRendering with timestamp queries (glQueryCounter). Both queries are issued, even if no mipmaps are generated.
+	\param beforeQuery Query issued before the mipmaps generation (0 to disable).
+	\param afterQuery Query issued after the mipmaps generation (0 to disable).
+	**/
+	void HdlFBO::setMipmapsQueries(GLuint beforeQuery, GLuint afterQuery)
+	{
+		mipmapsQueries[0] = beforeQuery;
+		mipmapsQueries[1] = afterQuery;
 	}
 
 	/**
@@ -364,23 +397,37 @@ using namespace Glip::CoreGL;
 			depthBufferAttached = false;
 		}
 
-		glBindFramebuffer(GL_FRAMEBUFFER, 0); // unbind
+		HandleOpenGL::bindFramebuffer(0); // unbind
+
+		#ifdef GLIP_USE_GL
+		if(mipmapsQueries[0]!=0)
+			glQueryCounter(mipmapsQueries[0], GL_TIMESTAMP);
+		#endif
 
 		// trigger mipmaps generation explicitly
 		for(std::vector<HdlTexture*>::iterator it=targets.begin(); it!=targets.end(); it++)
 		{
+			(*it)->markAsModified();
+
 			if((*it)->getMaxLevel()>0)
 			{
-				glBindTexture(GL_TEXTURE_2D, (*it)->getID());
+				HandleOpenGL::bindTextureTarget((*it)->getGLTarget(), (*it)->getID());
 
-				glGenerateMipmap(GL_TEXTURE_2D);
+				glGenerateMipmap((*it)->getGLTarget());
 
 				#ifdef __GLIPLIB_TRACK_GL_ERRORS__
 					OPENGL_ERROR_TRACKER("HdlFBO::endRendering", "glGenerateMipmap()")
 				#endif
 			}
 		}
-		glBindTexture(GL_TEXTURE_2D, 0);
+		HandleOpenGL::bindTextureTarget(getGLTarget(), 0);
+
+		#ifdef GLIP_USE_GL
+		if(mipmapsQueries[1]!=0)
+			glQueryCounter(mipmapsQueries[1], GL_TIMESTAMP);
+		#endif
+		mipmapsQueries[0] = 0;
+		mipmapsQueries[1] = 0;
 
 		// restore viewport setting (removed for GLES compatibility, impact?) :
 		//glPopAttrib();
@@ -410,7 +457,7 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlFBO::bind(void)
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, fboID);
+		HandleOpenGL::bindFramebuffer(fboID);
 	}
 
 	/**
@@ -494,6 +541,6 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlFBO::unbind(void)
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, 0); //unbind
+		HandleOpenGL::bindFramebuffer(0); //unbind
 	}
 
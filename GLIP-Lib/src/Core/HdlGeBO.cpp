@@ -27,24 +27,24 @@
 using namespace Glip::CoreGL;
 
 // Data
-	bool HdlGeBO::binding[4] = {false, false, false, false};
-	bool HdlGeBO::mapping[4] = {false, false, false, false};
+	bool HdlGeBO::binding[5] = {false, false, false, false, false};
+	bool HdlGeBO::mapping[5] = {false, false, false, false, false};
 
 // Functions
 	/**
 	\fn HdlGeBO::HdlGeBO(GLsizeiptr _size, GLenum infoTarget, GLenum infoUsage)
 	\brief HdlGeBO Construtor.
 	\param _size Size of the buffer, in bytes.
-	\param infoTarget Target kind, among GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER.
+	\param infoTarget Target kind, among GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, GL_UNIFORM_BUFFER.
 	\param infoUsage Usage kind among GL_STATIC_DRAW, GL_STATIC_READ, GL_STATIC_COPY, GL_DYNAMIC_DRAW, GL_DYNAMIC_READ, GL_DYNAMIC_COPY, GL_STREAM_DRAW, GL_STREAM_READ, GL_STREAM_COPY.
 	**/
 	HdlGeBO::HdlGeBO(GLsizeiptr _size, GLenum infoTarget, GLenum infoUsage)
-	 : size(_size)
+	 : size(_size), persistentPointer(NULL)
 	{
 		#ifdef GLIP_USE_GL
 		NEED_EXTENSION(GLEW_VERSION_1_5)
-		NEED_EXTENSION(GLEW_ARB_pixel_buffer_object)
-		NEED_EXTENSION(GLEW_ARB_vertex_buffer_object)
+		NEED_EXTENSION((GLEW_VERSION_2_1 || GLEW_ARB_pixel_buffer_object))
+		NEED_EXTENSION((GLEW_VERSION_1_5 || GLEW_ARB_vertex_buffer_object))
 		FIX_MISSING_GLEW_CALL(glGenBuffers, glGenBuffersARB)
 		FIX_MISSING_GLEW_CALL(glBindBuffer, glBindBufferARB)
 		FIX_MISSING_GLEW_CALL(glBufferData, glBufferDataARB)
@@ -89,11 +89,11 @@ using namespace Glip::CoreGL;
 	\brief HdlGeBO Construtor.
 	\param id GL id of the Buffer Object to be mapped in.
 	\param _size Size of the buffer, in bytes.
-	\param infoTarget Target kind, among GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER.
+	\param infoTarget Target kind, among GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, GL_UNIFORM_BUFFER.
 	\param infoUsage  Usage kind among GL_STATIC_DRAW, GL_STATIC_READ, GL_STATIC_COPY, GL_DYNAMIC_DRAW, GL_DYNAMIC_READ, GL_DYNAMIC_COPY, GL_STREAM_DRAW, GL_STREAM_READ, GL_STREAM_COPY.
 	**/
 	HdlGeBO::HdlGeBO(GLuint id, GLsizeiptr _size, GLenum infoTarget, GLenum infoUsage)
-	 : size(_size)
+	 : size(_size), persistentPointer(NULL)
 	{
 		#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
 			std::cerr << "HdlGeBO::HdlGeBO ERROR : a copy was made" << std::endl;
@@ -110,6 +110,7 @@ using namespace Glip::CoreGL;
 	HdlGeBO::~HdlGeBO(void)
 	{
 		// Delete the object
+		HandleOpenGL::forgetBuffer(bufferId);
 		glDeleteBuffers(1, &bufferId);
 
 		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
@@ -141,7 +142,7 @@ using namespace Glip::CoreGL;
 	/**
 	\fn GLenum HdlGeBO::getTarget(void)
 	\brief Get the target of the Buffer Object.
-	\return Target of the Buffer Object, among : GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER.
+	\return Target of the Buffer Object, among : GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, GL_UNIFORM_BUFFER.
 	**/
 	GLenum HdlGeBO::getTarget(void)
 	{
@@ -161,7 +162,7 @@ using namespace Glip::CoreGL;
 	/**
 	\fn void HdlGeBO::bind(GLenum target)
 	\brief Bind the Buffer Object to target.
-	\param target The target (GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER), default is the target specified for this object.
+	\param target The target (GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, GL_UNIFORM_BUFFER), default is the target specified for this object.
 	**/
 	void HdlGeBO::bind(GLenum target)
 	{
@@ -180,7 +181,7 @@ using namespace Glip::CoreGL;
 	\fn void* HdlGeBO::map(GLenum target, GLenum access)
 	\brief Map the Buffer Object into the CPU memory.
 	\param access Kind of access, among GL_READ_ONLY, GL_WRITE_ONLY, GL_READ_WRITE, default can be used is target is GL_PIXEL_UNPACK_BUFFER or GL_PIXEL_PACK_BUFFER (will use respectively GL_WRITE_ONLY or GL_READ_ONLY). Will raise an exception otherwise.
-	\param target Target mapping point, among GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, default is the target specified for this object.
+	\param target Target mapping point, among GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, GL_UNIFORM_BUFFER, default is the target specified for this object.
 	\return Pointer in CPU memory.
 	**/
 	void* HdlGeBO::map(GLenum access, GLenum target)
@@ -236,6 +237,9 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlGeBO::write(const void* data)
 	{
+		if(persistentPointer!=NULL)
+			throw Exception("HdlGeBO::write - The storage of a persistently mapped Buffer Object cannot be reallocated.", __FILE__, __LINE__, Exception::GLException);
+
 		bind();
 
 		glBufferData(getTarget(), static_cast<GLsizeiptr>(size), reinterpret_cast<const GLvoid *>(data), getUsage());
@@ -263,6 +267,88 @@ using namespace Glip::CoreGL;
 		#endif
 	}
 
+	/**
+	\fn void HdlGeBO::orphan(void)
+	\brief Orphan the storage of the Buffer Object : a new storage of the same size is allocated while the previous one is released once the pending commands using it are completed. The next map() will then not wait for these commands.
+	**/
+	void HdlGeBO::orphan(void)
+	{
+		write(NULL);
+	}
+
+	/**
+	\fn void* HdlGeBO::mapPersistent(GLenum access)
+	\brief Replace the storage of the Buffer Object by an immutable storage, persistently and coherently mapped into the CPU memory (requires OpenGL 4.4 or ARB_buffer_storage, see isPersistentMappingAvailable()).
+	\param access Kind of access, among GL_READ_ONLY, GL_WRITE_ONLY, GL_READ_WRITE, default can be used is target is GL_PIXEL_UNPACK_BUFFER or GL_PIXEL_PACK_BUFFER (will use respectively GL_WRITE_ONLY or GL_READ_ONLY).
+	\return Pointer in CPU memory, valid until the destruction of the object.
+
+	The pointer stays valid while the buffer is used by the GL, the writes are visible to the next GL commands (and the GL writes are visible once their commands are completed). The user is responsible for not modifying the data still in use by the GPU (see glFenceSync). The content of the previous storage is lost.
+	**/
+	void* HdlGeBO::mapPersistent(GLenum access)
+	{
+		if(persistentPointer!=NULL)
+			return persistentPointer;
+
+		const GLenum target = getTarget();
+		if(access==GL_NONE)
+		{
+			if(target==GL_PIXEL_UNPACK_BUFFER)
+				access = GL_WRITE_ONLY;
+			else if(target==GL_PIXEL_PACK_BUFFER)
+				access = GL_READ_ONLY;
+			else
+				throw Exception("HdlGeBO::mapPersistent - You must provide an acces type (R/W) for target " + getGLEnumNameSafe(target), __FILE__, __LINE__, Exception::GLException);
+		}
+
+		#ifdef GLIP_USE_GL
+			if(!isPersistentMappingAvailable())
+				throw Exception("HdlGeBO::mapPersistent - Persistent mapping is not available (requires OpenGL 4.4 or ARB_buffer_storage).", __FILE__, __LINE__, Exception::GLException);
+
+			GLbitfield flags = GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			if(access==GL_READ_ONLY || access==GL_READ_WRITE)
+				flags |= GL_MAP_READ_BIT;
+			if(access==GL_WRITE_ONLY || access==GL_READ_WRITE)
+				flags |= GL_MAP_WRITE_BIT;
+
+			HdlGeBO::unmap(target);
+			bind(target);
+
+			glBufferStorage(target, size, NULL, flags);
+
+			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+				OPENGL_ERROR_TRACKER("HdlGeBO::mapPersistent", "glBufferStorage()")
+			#endif
+
+			persistentPointer = glMapBufferRange(target, 0, size, flags);
+
+			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+				OPENGL_ERROR_TRACKER("HdlGeBO::mapPersistent", "glMapBufferRange()")
+			#endif
+
+			HdlGeBO::unbind(target);
+
+			if(persistentPointer==NULL)
+			{
+				const GLenum err = glGetError();
+				throw Exception("HdlGeBO::mapPersistent - Buffer Object can't be mapped. OpenGL error " + getGLEnumNameSafe(err) + " : " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+			}
+		#else
+			throw Exception("HdlGeBO::mapPersistent - Persistent mapping is not available.", __FILE__, __LINE__, Exception::GLException);
+		#endif
+
+		return persistentPointer;
+	}
+
+	/**
+	\fn bool HdlGeBO::isPersistentlyMapped(void) const
+	\brief Test if the Buffer Object is persistently mapped (see mapPersistent()).
+	\return true if the Buffer Object is persistently mapped.
+	**/
+	bool HdlGeBO::isPersistentlyMapped(void) const
+	{
+		return persistentPointer!=NULL;
+	}
+
 
 // Static tools
 	int HdlGeBO::getIDTarget(GLenum target)
@@ -273,6 +359,7 @@ using namespace Glip::CoreGL;
 			case GL_ELEMENT_ARRAY_BUFFER :	return 1;
 			case GL_PIXEL_UNPACK_BUFFER :	return 2;
 			case GL_PIXEL_PACK_BUFFER :	return 3;
+			case GL_UNIFORM_BUFFER :	return 4;
 			default :
 				throw Exception("HdlGeBO::getIDTarget - Unknown target : " + getGLEnumNameSafe(target), __FILE__, __LINE__, Exception::GLException);
 		}
@@ -281,7 +368,7 @@ using namespace Glip::CoreGL;
 	/**
 	\fn void HdlGeBO::unbind(GLenum target)
 	\brief Unbind any Buffer Object.
-	\param target Target binding point, among GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER.
+	\param target Target binding point, among GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, GL_UNIFORM_BUFFER.
 	**/
 	void HdlGeBO::unbind(GLenum target)
 	{
@@ -292,7 +379,7 @@ using namespace Glip::CoreGL;
 	/**
 	\fn void HdlGeBO::unmap(GLenum target)
 	\brief Unmap any Buffer Object.
-	\param target Target binding point, among GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER.
+	\param target Target binding point, among GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, GL_UNIFORM_BUFFER.
 	**/
 	void HdlGeBO::unmap(GLenum target)
 	{
@@ -318,7 +405,7 @@ using namespace Glip::CoreGL;
 	/**
 	\fn bool HdlGeBO::isBound(GLenum target)
 	\brief Test if the target is bound.
-	\param target The target (GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER).
+	\param target The target (GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, GL_UNIFORM_BUFFER).
 	\return true if the target is bound.
 	**/
 	bool HdlGeBO::isBound(GLenum target)
@@ -329,7 +416,7 @@ using namespace Glip::CoreGL;
 	/**
 	\fn bool HdlGeBO::isMapped(GLenum target)
 	\brief Test if the target is mapped.
-	\param target The target (GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER).
+	\param target The target (GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_PACK_BUFFER, GL_UNIFORM_BUFFER).
 	\return true if the target is mapped.
 	**/
 	bool HdlGeBO::isMapped(GLenum target)
@@ -337,3 +424,17 @@ using namespace Glip::CoreGL;
 		return mapping[getIDTarget(target)];
 	}
 
+	/**
+	\fn bool HdlGeBO::isPersistentMappingAvailable(void)
+	\brief Test if the Buffer Objects can be persistently mapped (OpenGL 4.4 or ARB_buffer_storage).
+	\return true if mapPersistent() can be used.
+	**/
+	bool HdlGeBO::isPersistentMappingAvailable(void)
+	{
+		#ifdef GLIP_USE_GL
+			return GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage;
+		#else
+			return false;
+		#endif
+	}
+
@@ -21,6 +21,10 @@
  * \date    August 7th 2010
 */
 
+#include <cstring>
+#ifndef _WIN32
+	#include <time.h>
+#endif
 #include "Core/Exception.hpp"
 #include "Core/HdlPBO.hpp"
 
@@ -94,7 +98,11 @@ using namespace Glip::CoreGL;
 		texture.bind();
 		bind(GL_PIXEL_UNPACK_BUFFER);
 
-		glTexSubImage2D(GL_TEXTURE_2D, 0, oX, oY, w, h, mode, depth, 0);
+		// All the layers of an array (or 3D) texture are copied, packed one after the other :
+		if(texture.isLayered())
+			glTexSubImage3D(texture.getGLTarget(), 0, oX, oY, 0, w, h, texture.getNumLayers(), mode, depth, 0);
+		else
+			glTexSubImage2D(GL_TEXTURE_2D, 0, oX, oY, w, h, mode, depth, 0);
 
 		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
 			OPENGL_ERROR_TRACKER("HdlPBO::copyToTexture", "glTexSubImage2D()")
@@ -110,6 +118,8 @@ using namespace Glip::CoreGL;
 
 		// Unbind from target :
 		unbind(GL_PIXEL_UNPACK_BUFFER);
+
+		texture.markAsModified();
 	}
 
 	/**
@@ -162,3 +172,266 @@ using namespace Glip::CoreGL;
 		else
 			HdlGeBO::unmap(target);
 	}
+
+// HdlPBORing
+	/**
+	\fn HdlPBORing::HdlPBORing(const HdlAbstractTextureFormat& fmt, int numSlots, bool usePersistentMapping)
+	\brief HdlPBORing constructor.
+	\param fmt The format of the data to upload, this must an uncompressed format.
+	\param numSlots The number of slots in the ring (at least 1, 2 or 3 are usually enough to avoid stalls).
+	\param usePersistentMapping Use persistently mapped slots if the hardware allows it, otherwise orphan the storage of the slots.
+	**/
+	HdlPBORing::HdlPBORing(const HdlAbstractTextureFormat& fmt, int numSlots, bool usePersistentMapping)
+	 :	persistent(false),
+		currentSlot(-1),
+		nextSlot(0),
+		numUploads(0),
+		numStalls(0),
+		uploadedBytes(0),
+		startTime(-1.0),
+		lastTime(-1.0),
+		stallTime(0.0)
+	{
+		if(numSlots<1)
+			throw Exception("HdlPBORing::HdlPBORing - The ring needs at least one slot (" + toString(numSlots) + " requested).", __FILE__, __LINE__, Exception::GLException);
+
+		#ifdef GLIP_USE_GL
+			persistent = usePersistentMapping && HdlGeBO::isPersistentMappingAvailable() && (GLEW_VERSION_3_2 || GLEW_ARB_sync);
+		#endif
+
+		try
+		{
+			for(int k=0; k<numSlots; k++)
+			{
+				slots.push_back(new HdlPBO(fmt, GL_PIXEL_UNPACK_BUFFER, GL_STREAM_DRAW));
+				fences.push_back(NULL);
+
+				if(persistent)
+					slots.back()->mapPersistent(GL_WRITE_ONLY);
+			}
+		}
+		catch(Exception& e)
+		{
+			for(std::vector<HdlPBO*>::iterator it=slots.begin(); it!=slots.end(); it++)
+				delete (*it);
+			slots.clear();
+
+			Exception m("HdlPBORing::HdlPBORing - Unable to create the slots.", __FILE__, __LINE__, Exception::GLException);
+			m << e;
+			throw m;
+		}
+	}
+
+	HdlPBORing::~HdlPBORing(void)
+	{
+		if(currentSlot>=0 && !persistent)
+			HdlPBO::unmap(GL_PIXEL_UNPACK_BUFFER);
+
+		#ifdef GLIP_USE_GL
+			for(std::vector<GLsync>::iterator it=fences.begin(); it!=fences.end(); it++)
+			{
+				if((*it)!=NULL)
+					glDeleteSync(*it);
+			}
+		#endif
+
+		for(std::vector<HdlPBO*>::iterator it=slots.begin(); it!=slots.end(); it++)
+			delete (*it);
+	}
+
+	void HdlPBORing::waitSlot(int slot, bool count)
+	{
+		#ifdef GLIP_USE_GL
+			if(fences[slot]==NULL)
+				return ;
+
+			GLenum result = glClientWaitSync(fences[slot], 0, 0);
+
+			if(result==GL_TIMEOUT_EXPIRED)
+			{
+				const double t = getTime();
+
+				do
+					result = glClientWaitSync(fences[slot], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+				while(result==GL_TIMEOUT_EXPIRED);
+
+				if(count)
+				{
+					numStalls++;
+					stallTime += getTime() - t;
+				}
+			}
+
+			if(result==GL_WAIT_FAILED)
+				throw Exception("HdlPBORing::waitSlot - Unable to wait for the slot " + toString(slot) + ".", __FILE__, __LINE__, Exception::GLException);
+
+			glDeleteSync(fences[slot]);
+			fences[slot] = NULL;
+		#endif
+	}
+
+	double HdlPBORing::getTime(void)
+	{
+		// Monotonic wall clock, on the CPU side (clock() would only measure the time spent by the CPU, not the stalls, and GL_TIMESTAMP is a round trip to the server on another clock) :
+		#ifdef _WIN32
+			LARGE_INTEGER frequency, counter;
+			QueryPerformanceFrequency(&frequency);
+			QueryPerformanceCounter(&counter);
+			return static_cast<double>(counter.QuadPart)/static_cast<double>(frequency.QuadPart);
+		#else
+			timespec t;
+			clock_gettime(CLOCK_MONOTONIC, &t);
+			return static_cast<double>(t.tv_sec) + static_cast<double>(t.tv_nsec)*1e-9;
+		#endif
+	}
+
+	/**
+	\fn int HdlPBORing::getNumSlots(void) const
+	\return The number of slots in the ring.
+	\fn GLsizeiptr HdlPBORing::getSlotSize(void) const
+	\return The size of each slot, in bytes.
+	\fn bool HdlPBORing::isPersistent(void) const
+	\return True if the slots are persistently mapped (otherwise, their storage is orphaned before each mapping).
+	**/
+	int HdlPBORing::getNumSlots(void) const		{ return slots.size(); }
+	GLsizeiptr HdlPBORing::getSlotSize(void) const	{ return slots.front()->getSize(); }
+	bool HdlPBORing::isPersistent(void) const	{ return persistent; }
+
+	/**
+	\fn void* HdlPBORing::map(void)
+	\brief Get the next slot of the ring. If the slot is still read by the GPU, wait for the end of the transfer (stall).
+	\return Pointer in CPU memory where the data must be written (getSlotSize() bytes), valid until the next call to copyToTexture().
+	**/
+	void* HdlPBORing::map(void)
+	{
+		if(currentSlot>=0)
+			throw Exception("HdlPBORing::map - The previous slot was not copied to a texture yet.", __FILE__, __LINE__, Exception::GLException);
+
+		if(startTime<0.0)
+			startTime = getTime();
+
+		void* ptr = NULL;
+
+		if(persistent)
+		{
+			waitSlot(nextSlot, true);
+			ptr = slots[nextSlot]->mapPersistent(GL_WRITE_ONLY);
+		}
+		else
+		{
+			slots[nextSlot]->orphan();
+			ptr = slots[nextSlot]->map(GL_WRITE_ONLY, GL_PIXEL_UNPACK_BUFFER);
+		}
+
+		if(ptr==NULL)
+			throw Exception("HdlPBORing::map - Unable to map the slot " + toString(nextSlot) + ".", __FILE__, __LINE__, Exception::GLException);
+
+		currentSlot = nextSlot;
+		return ptr;
+	}
+
+	/**
+	\fn void HdlPBORing::copyToTexture(HdlTexture& texture, int oX, int oY, int w, int h, GLenum mode, GLenum depth)
+	\brief Enqueue the copy of the slot returned by the last call to map() into a texture, without waiting for the transfer. The ring then moves to the next slot.
+	\param texture The target texture.
+	\param oX The offset in X direction for the destination target, default is 0.
+	\param oY The offset in Y direction for the destination target, default is 0.
+	\param w The width to be copied, default is the width of texture.
+	\param h The height to be copied, default is the height of texture.
+	\param mode The channel layout of the input data, default is the mode of texture.
+	\param depth The depth of the input data, default is the depth of texture.
+	**/
+	void HdlPBORing::copyToTexture(HdlTexture& texture, int oX, int oY, int w, int h, GLenum mode, GLenum depth)
+	{
+		if(currentSlot<0)
+			throw Exception("HdlPBORing::copyToTexture - No slot was mapped.", __FILE__, __LINE__, Exception::GLException);
+
+		const int slot = currentSlot;
+		currentSlot = -1;
+
+		if(!persistent)
+			HdlPBO::unmap(GL_PIXEL_UNPACK_BUFFER);
+
+		slots[slot]->copyToTexture(texture, oX, oY, w, h, mode, depth);
+
+		#ifdef GLIP_USE_GL
+			if(persistent)
+			{
+				fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+				#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+					OPENGL_ERROR_TRACKER("HdlPBORing::copyToTexture", "glFenceSync()")
+				#endif
+			}
+		#endif
+
+		nextSlot = (slot + 1) % slots.size();
+		numUploads++;
+		uploadedBytes += slots[slot]->getSize();
+		lastTime = getTime();
+	}
+
+	/**
+	\fn void HdlPBORing::write(HdlTexture& texture, const void* data)
+	\brief Upload data to a texture through the ring (map(), copy of getSlotSize() bytes and copyToTexture()).
+	\param texture The target texture, its format must match the format of the ring.
+	\param data Pointer to the data to upload.
+	**/
+	void HdlPBORing::write(HdlTexture& texture, const void* data)
+	{
+		void* ptr = map();
+		std::memcpy(ptr, data, getSlotSize());
+		copyToTexture(texture);
+	}
+
+	/**
+	\fn void HdlPBORing::finish(void)
+	\brief Wait for the completion of all the transfers (not counted as stalls).
+	**/
+	void HdlPBORing::finish(void)
+	{
+		for(int k=0; k<static_cast<int>(slots.size()); k++)
+			waitSlot(k, false);
+	}
+
+	/**
+	\fn int HdlPBORing::getNumUploads(void) const
+	\return The number of uploads since the creation of the ring or the last call to resetStatistics().
+	\fn int HdlPBORing::getNumStalls(void) const
+	\return The number of uploads which had to wait for the GPU to release their slot.
+	\fn double HdlPBORing::getStallTime(void) const
+	\return The total time spent waiting for the slots, in seconds.
+	\fn unsigned long long HdlPBORing::getUploadedBytes(void) const
+	\return The number of bytes uploaded.
+	**/
+	int HdlPBORing::getNumUploads(void) const			{ return numUploads; }
+	int HdlPBORing::getNumStalls(void) const			{ return numStalls; }
+	double HdlPBORing::getStallTime(void) const			{ return stallTime; }
+	unsigned long long HdlPBORing::getUploadedBytes(void) const	{ return uploadedBytes; }
+
+	/**
+	\fn double HdlPBORing::getBandwidth(void) const
+	\brief Get the upload bandwidth, from the first mapping to the last copy.
+	\return The bandwidth, in bytes per second (zero if it cannot be measured yet).
+	**/
+	double HdlPBORing::getBandwidth(void) const
+	{
+		if(numUploads==0 || lastTime<=startTime)
+			return 0.0;
+		else
+			return static_cast<double>(uploadedBytes)/(lastTime - startTime);
+	}
+
+	/**
+	\fn void HdlPBORing::resetStatistics(void)
+	\brief Reset the number of uploads and stalls, the stall time and the bandwidth measurement.
+	**/
+	void HdlPBORing::resetStatistics(void)
+	{
+		numUploads	= 0;
+		numStalls	= 0;
+		uploadedBytes	= 0;
+		startTime	= -1.0;
+		lastTime	= -1.0;
+		stallTime	= 0.0;
+	}
@@ -26,8 +26,11 @@
 #include <sstream>
 #include <cstring>
 #include <algorithm>
+#include <fstream>
+#include <cstdio>
 #include "Core/Exception.hpp"
 #include "Core/HdlShader.hpp"
+#include "Core/HdlVBO.hpp"
 #include "devDebugTools.hpp"
 
 using namespace Glip::CoreGL;
@@ -50,23 +53,19 @@ using namespace Glip::CoreGL;
 	
 		switch(type)
 		{
-			case GL_FRAGMENT_SHADER :	
-				NEED_EXTENSION(GLEW_ARB_fragment_shader)
-				NEED_EXTENSION(GLEW_ARB_fragment_program)
-				break;
-			case GL_VERTEX_SHADER : 
-				NEED_EXTENSION(GLEW_ARB_vertex_shader)
-				NEED_EXTENSION(GLEW_ARB_vertex_program)				
+			// (The stages are part of the core profile, where the extensions are not listed anymore)
+			case GL_FRAGMENT_SHADER :
+			case GL_VERTEX_SHADER :
 				break;
 			case GL_COMPUTE_SHADER : 
-				NEED_EXTENSION(GLEW_ARB_compute_shader)
+				NEED_EXTENSION((GLEW_VERSION_4_3 || GLEW_ARB_compute_shader))
 				break;
 			case GL_TESS_CONTROL_SHADER :
 			case GL_TESS_EVALUATION_SHADER :
-				NEED_EXTENSION(GLEW_ARB_tessellation_shader)
+				NEED_EXTENSION((GLEW_VERSION_4_0 || GLEW_ARB_tessellation_shader))
 				break;
 			case GL_GEOMETRY_SHADER :
-				NEED_EXTENSION(GLEW_ARB_geometry_shader4)
+				NEED_EXTENSION((GLEW_VERSION_3_2 || GLEW_ARB_geometry_shader4))
 				break;
 			default : 
 				throw Exception("HdlShader::HdlShader - Unknown shader type : \"" + getGLEnumNameSafe(type) + "\".", __FILE__, __LINE__, Exception::GLException);
@@ -197,13 +196,25 @@ using namespace Glip::CoreGL;
 	}
 
 // HdlProgram :
+	std::map<unsigned long long, HdlProgram::SharedProgram*> HdlProgram::sharedPrograms;
+	std::map<const HdlGeBO*, HdlProgram::SharedBlock*> HdlProgram::sharedBlocks;
+	std::string HdlProgram::binaryCacheDirectory;
+	int HdlProgram::binaryCacheHits = 0;
+	int HdlProgram::binaryCacheMisses = 0;
+	bool HdlProgram::errorChecking = false;
+	const char HdlProgram::binarySignature[8] = {'G', 'L', 'I', 'P', 'P', 'R', 'G', '1'};
+
 	/**
 	\fn HdlProgram::HdlProgram(void)
 	\brief HdlProgram constructor.
 	**/
 	HdlProgram::HdlProgram(void)
 	 : 	valid(false),
-		program(0)
+		program(0),
+		modificationCount(0),
+		linkCount(0),
+		master(NULL),
+		shared(NULL)
 	{
 		std::memset(attachedShaders, 0, numShaderTypes*sizeof(GLuint));
 
@@ -221,8 +232,216 @@ using namespace Glip::CoreGL;
 		}
 	}
 
+	/**
+	\fn HdlProgram::HdlProgram(HdlProgram& _master, const std::string& _uniformsPrefix)
+	\brief HdlProgram constructor, create a view on the uniform variables of another program.
+	\param _master The program owning the variables (must outlive this object).
+	\param _uniformsPrefix The prefix of the variables in the master program, which is omitted in the names used with this object.
+
+	The view cannot be modified (shaders, link) but the changes made to the uniform variables are also reported to the master (see HdlProgram::getModificationCount).
+	**/
+	HdlProgram::HdlProgram(HdlProgram& _master, const std::string& _uniformsPrefix)
+	 :	valid(_master.valid),
+		program(_master.program),
+		modificationCount(0),
+		linkCount(0),
+		master(&_master),
+		uniformsPrefix(_uniformsPrefix),
+		shared(NULL)
+	{
+		std::memset(attachedShaders, 0, numShaderTypes*sizeof(GLuint));
+
+		for(unsigned int k=0; k<_master.activeUniforms.size(); k++)
+		{
+			if(_master.activeUniforms[k].compare(0, uniformsPrefix.size(), uniformsPrefix)==0)
+			{
+				activeUniforms.push_back(_master.activeUniforms[k].substr(uniformsPrefix.size()));
+				activeTypes.push_back(_master.activeTypes[k]);
+			}
+		}
+	}
+
+	/**
+	\fn HdlProgram::HdlProgram(const std::map<GLenum, const ShaderSource*>& sources, const std::vector<std::string>& fragmentLocations)
+	\brief HdlProgram constructor, build a shared program.
+	\param sources The sources of the shaders, for each shader type (GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, etc.).
+	\param fragmentLocations The names of the fragment outputs, in the order of their locations (can be empty).
+
+	If another program was built from identical sources and fragment locations, its compiled program is used. Otherwise the program is loaded from the binary cache (see HdlProgram::setBinaryCacheDirectory) or the shaders are compiled and linked. The shared program cannot be modified (shaders, link) but the values of its uniform variables are kept separately for each object (see HdlProgram::use).
+	**/
+	HdlProgram::HdlProgram(const std::map<GLenum, const ShaderSource*>& sources, const std::vector<std::string>& fragmentLocations)
+	 :	valid(false),
+		program(0),
+		modificationCount(0),
+		linkCount(0),
+		master(NULL),
+		shared(NULL)
+	{
+		std::memset(attachedShaders, 0, numShaderTypes*sizeof(GLuint));
+
+		// Build the key (FNV-1a hash of the final sources and of the fragment locations) :
+		std::string key;
+		for(std::map<GLenum, const ShaderSource*>::const_iterator it=sources.begin(); it!=sources.end(); it++)
+			key += getGLEnumNameSafe(it->first) + "\n" + toString(it->second->getSource().size()) + "\n" + it->second->getSource();
+		for(unsigned int k=0; k<fragmentLocations.size(); k++)
+			key += "location:" + fragmentLocations[k] + "\n";
+
+		const unsigned long long hash = getHash(key);
+
+		std::map<unsigned long long, SharedProgram*>::iterator it = sharedPrograms.find(hash);
+
+		if(it!=sharedPrograms.end() && it->second->key==key)
+			shared = it->second;
+		else
+		{
+			SharedProgram* s = new SharedProgram;
+			s->hash		= hash;
+			s->key		= key;
+			s->program	= 0;
+			s->references	= 0;
+			s->owner	= this;		// A new program holds the default values.
+			for(int k=0; k<numShaderTypes; k++)
+				s->shaders[k] = NULL;
+
+			try
+			{
+				program = glCreateProgram();
+
+				#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+					OPENGL_ERROR_TRACKER("HdlProgram::HdlProgram(sources)", "glCreateProgram()")
+				#endif
+
+				if(program==0)
+				{
+					const GLenum err = glGetError();
+					throw Exception("HdlProgram::HdlProgram - Program can't be created. Last OpenGL error : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+				}
+
+				s->program = program;
+
+				// The binaries also depend on the driver :
+				std::string	binaryKey,
+						binaryFilename;
+				bool		loaded = false;
+
+				if(isBinaryCacheAvailable())
+				{
+					binaryKey	= key + "vendor:" + HandleOpenGL::getVendorName() + "\nrenderer:" + HandleOpenGL::getRendererName() + "\nversion:" + HandleOpenGL::getVersion() + "\n";
+					binaryFilename	= binaryCacheDirectory;
+
+					if(binaryFilename[binaryFilename.size()-1]!='/' && binaryFilename[binaryFilename.size()-1]!='\\')
+						binaryFilename += "/";
+
+					std::ostringstream name;
+					name << std::hex << getHash(binaryKey) << ".glpb";
+					binaryFilename += name.str();
+
+					loaded = loadBinary(binaryFilename, binaryKey);
+
+					if(loaded)
+						binaryCacheHits++;
+					else
+						binaryCacheMisses++;
+				}
+
+				// Compile if the binary is missing or was rejected by the driver :
+				if(!loaded)
+				{
+					for(std::map<GLenum, const ShaderSource*>::const_iterator itSrc=sources.begin(); itSrc!=sources.end(); itSrc++)
+					{
+						const unsigned int k = HandleOpenGL::getShaderTypeIndex(itSrc->first);
+						s->shaders[k] = new HdlShader(itSrc->first, *itSrc->second);
+						updateShader(*s->shaders[k], false);
+					}
+
+					// The locations are applied by the link : 
+					for(unsigned int k=0; k<fragmentLocations.size(); k++)
+						setFragmentLocation(fragmentLocations[k], k);
+
+					if(!binaryFilename.empty())
+						glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+					link();
+
+					if(!binaryFilename.empty())
+						saveBinary(binaryFilename, binaryKey);
+				}
+
+				s->activeUniforms	= activeUniforms;
+				s->activeTypes		= activeTypes;
+
+				s->uniformsTable	= uniformsTable;
+				s->uniformBlocks	= uniformBlocks;
+				s->uniformBlocksNames	= uniformBlocksNames;
+
+				// Save the default values of the variables (including the elements of the arrays, the blocks have no default values) :
+				for(std::map<std::string, UniformInfo>::const_iterator itUniform=uniformsTable.begin(); itUniform!=uniformsTable.end(); itUniform++)
+				{
+					if(getNumWords(itUniform->second.type)==0 || itUniform->second.size>1 || itUniform->second.block>=0)
+						continue;
+
+					UniformValue v;
+					v.type		= itUniform->second.type;
+					v.location	= itUniform->second.location;
+
+					switch(getTypeCategory(v.type))
+					{
+						case 'u' :	glGetUniformuiv(program, v.location, v.words);					break;
+						case 'i' :	glGetUniformiv(program, v.location, reinterpret_cast<GLint*>(v.words));		break;
+						default :	glGetUniformfv(program, v.location, reinterpret_cast<GLfloat*>(v.words));
+					}
+
+					s->defaultValues[v.location] = v;
+				}
+
+				#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+					OPENGL_ERROR_TRACKER("HdlProgram::HdlProgram(sources)", "glGetUniform()")
+				#endif
+			}
+			catch(Exception& e)
+			{
+				// The shaders and the program now belong to the shared program :
+				std::memset(attachedShaders, 0, numShaderTypes*sizeof(GLuint));
+				releaseSharedProgram(s);
+				throw ;
+			}
+
+			// The program is not shared in case of collision :
+			if(it==sharedPrograms.end())
+				sharedPrograms[hash] = s;
+
+			std::memset(attachedShaders, 0, numShaderTypes*sizeof(GLuint));
+			shared = s;
+		}
+
+		shared->references++;
+		program		= shared->program;
+		activeUniforms	= shared->activeUniforms;
+		activeTypes	= shared->activeTypes;
+		uniformsTable	= shared->uniformsTable;
+		uniformBlocks	= shared->uniformBlocks;
+		uniformBlocksNames = shared->uniformBlocksNames;
+		uniformsValues	= shared->defaultValues;
+		valid		= true;
+	}
+
 	HdlProgram::~HdlProgram(void)
 	{
+		// The views do not own the program :
+		if(master!=NULL)
+			return ;
+
+		releaseUniformBlocks();
+
+		if(shared!=NULL)
+		{
+			if(shared->owner==this)
+				shared->owner = NULL;
+
+			releaseSharedProgram(shared);
+			return ;
+		}
+
 		for(int k=0; k<numShaderTypes; k++)
 		{
 			if(attachedShaders[k]!=0)
@@ -235,6 +454,7 @@ using namespace Glip::CoreGL;
 			}
 		}
 
+		HandleOpenGL::forgetProgram(program);
 		glDeleteProgram(program);
 
 		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
@@ -260,6 +480,11 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlProgram::updateShader(const HdlShader& shader, bool linkNow)
 	{
+		if(master!=NULL)
+			throw Exception("HdlProgram::updateShader - Cannot modify a view on another program.", __FILE__, __LINE__, Exception::GLException);
+		if(shared!=NULL)
+			throw Exception("HdlProgram::updateShader - Cannot modify a shared program.", __FILE__, __LINE__, Exception::GLException);
+
 		unsigned int k = HandleOpenGL::getShaderTypeIndex(shader.getType());
 
 		// Dettach previous : 
@@ -294,8 +519,18 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlProgram::link(void)
 	{
+		if(master!=NULL)
+			throw Exception("HdlProgram::link - Cannot link a view on another program.", __FILE__, __LINE__, Exception::GLException);
+		if(shared!=NULL)
+			throw Exception("HdlProgram::link - Cannot link a shared program.", __FILE__, __LINE__, Exception::GLException);
+
 		valid = false;
 
+		// Generic attributes of the vertex arrays (see HdlVBO) :
+		glBindAttribLocation(program, HdlVBO::positionLocation, HdlVBO::positionAttributeName.c_str());
+		glBindAttribLocation(program, HdlVBO::normalLocation, HdlVBO::normalAttributeName.c_str());
+		glBindAttribLocation(program, HdlVBO::texCoordLocation, HdlVBO::texCoordAttributeName.c_str());
+
 		// Link them
 		glLinkProgram(program);
 
@@ -339,331 +574,947 @@ using namespace Glip::CoreGL;
 			throw Exception("HdlProgram::link - Error during Program linking : \n" + logstr, __FILE__, __LINE__, Exception::ClientShaderException);
 		}
 		else
+			listActiveUniforms();
+	}
+
+	void HdlProgram::listActiveUniforms(void)
+	{
+		use();
+
+		// Clean :
+		activeUniforms.clear();
+		activeTypes.clear();
+		uniformsTable.clear();
+		releaseUniformBlocks();
+		uniformBlocks.clear();
+		uniformBlocksNames.clear();
+
+		// Update available uniforms of the following types :
+		#ifdef GLIP_USE_GL
+		const GLenum interestTypes[] = {GL_FLOAT, GL_FLOAT_VEC2, GL_FLOAT_VEC3, GL_FLOAT_VEC4, GL_DOUBLE, GL_DOUBLE_VEC2, GL_DOUBLE_VEC3, GL_DOUBLE_VEC4, GL_INT, GL_INT_VEC2, GL_INT_VEC3, GL_INT_VEC4, GL_UNSIGNED_INT_VEC2, GL_UNSIGNED_INT_VEC3, GL_UNSIGNED_INT_VEC4, GL_BOOL, GL_BOOL_VEC2, GL_BOOL_VEC3, GL_BOOL_VEC4, GL_FLOAT_MAT2, GL_FLOAT_MAT3, GL_FLOAT_MAT4, /*GL_DOUBLE_MAT2, GL_DOUBLE_MAT3, GL_DOUBLE_MAT4,*/ GL_UNSIGNED_INT};
+		#else
+		const GLenum interestTypes[] = {GL_FLOAT, GL_FLOAT_VEC2, GL_FLOAT_VEC3, GL_FLOAT_VEC4, GL_INT, GL_INT_VEC2, GL_INT_VEC3, GL_INT_VEC4, GL_UNSIGNED_INT_VEC2, GL_UNSIGNED_INT_VEC3, GL_UNSIGNED_INT_VEC4, GL_BOOL, GL_BOOL_VEC2, GL_BOOL_VEC3, GL_BOOL_VEC4, GL_FLOAT_MAT2, GL_FLOAT_MAT3, GL_FLOAT_MAT4, GL_UNSIGNED_INT};
+		#endif
+		const int numAllowedTypes = sizeof(interestTypes) / sizeof(GLenum);
+
+		// Get number of uniforms :
+		GLint numUniforms = 0;
+		glGetProgramiv(	program, GL_ACTIVE_UNIFORMS, &numUniforms);
+
+		const int maxLength = 1024;
+		char buffer[maxLength];
+		GLenum type;
+		GLint actualSize, actualSizeName;
+
+		// Get the uniform blocks, the block k uses the binding point k :
+		if(isUniformBufferAvailable())
 		{
-			use();
+			GLint numBlocks = 0;
+			glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &numBlocks);
 
-			// Clean :
-			activeUniforms.clear();
-			activeTypes.clear();
+			for(int k=0; k<numBlocks; k++)
+			{
+				UniformBlock b;
+				glGetActiveUniformBlockName(program, k, maxLength-1, &actualSizeName, buffer);
+				glGetActiveUniformBlockiv(program, k, GL_UNIFORM_BLOCK_DATA_SIZE, &b.size);
+				glUniformBlockBinding(program, k, k);
+
+				b.name		= buffer;
+				b.buffer	= NULL;
+				b.ownBuffer	= false;
+				b.deferred	= false;
+				b.modified	= false;
+				b.data.assign(b.size, 0);
+				b.store		= NULL;
+				uniformBlocks.push_back(b);
+				uniformBlocksNames.push_back(b.name);
+			}
 
-			// Update available uniforms of the following types :
-			#ifdef GLIP_USE_GL
-			const GLenum interestTypes[] = {GL_FLOAT, GL_FLOAT_VEC2, GL_FLOAT_VEC3, GL_FLOAT_VEC4, GL_DOUBLE, GL_DOUBLE_VEC2, GL_DOUBLE_VEC3, GL_DOUBLE_VEC4, GL_INT, GL_INT_VEC2, GL_INT_VEC3, GL_INT_VEC4, GL_UNSIGNED_INT_VEC2, GL_UNSIGNED_INT_VEC3, GL_UNSIGNED_INT_VEC4, GL_BOOL, GL_BOOL_VEC2, GL_BOOL_VEC3, GL_BOOL_VEC4, GL_FLOAT_MAT2, GL_FLOAT_MAT3, GL_FLOAT_MAT4, /*GL_DOUBLE_MAT2, GL_DOUBLE_MAT3, GL_DOUBLE_MAT4,*/ GL_UNSIGNED_INT};
-			#else
-			const GLenum interestTypes[] = {GL_FLOAT, GL_FLOAT_VEC2, GL_FLOAT_VEC3, GL_FLOAT_VEC4, GL_INT, GL_INT_VEC2, GL_INT_VEC3, GL_INT_VEC4, GL_UNSIGNED_INT_VEC2, GL_UNSIGNED_INT_VEC3, GL_UNSIGNED_INT_VEC4, GL_BOOL, GL_BOOL_VEC2, GL_BOOL_VEC3, GL_BOOL_VEC4, GL_FLOAT_MAT2, GL_FLOAT_MAT3, GL_FLOAT_MAT4, GL_UNSIGNED_INT};
+			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+				OPENGL_ERROR_TRACKER("HdlProgram::listActiveUniforms", "glGetActiveUniformBlockiv()")
 			#endif
-			const int numAllowedTypes = sizeof(interestTypes) / sizeof(GLenum);
+		}
+
+		for(int k=0; k<numUniforms; k++)
+		{
+			glGetActiveUniform( program, k, maxLength-1, &actualSizeName, &actualSize, &type, buffer);
 
-			// Get number of uniforms :
-			GLint numUniforms = 0;
-			glGetProgramiv(	program, GL_ACTIVE_UNIFORMS, &numUniforms);
+			if(std::find(interestTypes, interestTypes + numAllowedTypes, type)!=interestTypes + numAllowedTypes)
+			{
+ 				activeUniforms.push_back(buffer);
+				activeTypes.push_back(type);
+			}
 
-			const int maxLength = 1024;
-			char buffer[maxLength];
-			GLenum type;
-			GLint actualSize, actualSizeName;
-			for(int k=0; k<numUniforms; k++)
+			// Locations table, with the elements of the arrays :
+			std::string name = buffer;
+			if(name.size()>3 && name.compare(name.size()-3, 3, "[0]")==0)
+				name = name.substr(0, name.size()-3);
+
+			UniformInfo info;
+			info.location		= glGetUniformLocation(program, name.c_str());
+			info.type		= type;
+			info.size		= actualSize;
+			info.block		= -1;
+			info.offset		= 0;
+			info.arrayStride	= 0;
+			info.matrixStride	= 0;
+			info.rowMajor		= 0;
+
+			if(!uniformBlocks.empty())
 			{
-				glGetActiveUniform( program, k, maxLength-1, &actualSizeName, &actualSize, &type, buffer);
+				const GLuint index = k;
+				glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_BLOCK_INDEX, &info.block);
+				glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_OFFSET, &info.offset);
+				glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_ARRAY_STRIDE, &info.arrayStride);
+				glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_MATRIX_STRIDE, &info.matrixStride);
+				glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_IS_ROW_MAJOR, &info.rowMajor);
+			}
 
-				if(std::find(interestTypes, interestTypes + numAllowedTypes, type)!=interestTypes + numAllowedTypes)
-				{
- 					activeUniforms.push_back(buffer);
-					activeTypes.push_back(type);
-				}
+			uniformsTable[name] = info;
+
+			for(int l=0; l<actualSize && actualSize>1; l++)
+			{
+				const std::string elementName = name + "[" + toString(l) + "]";
+				UniformInfo element = info;
+				element.location	= glGetUniformLocation(program, elementName.c_str());
+				element.size		= 1;
+				element.offset		= info.offset + l * info.arrayStride;
+				uniformsTable[elementName] = element;
 			}
+		}
 
-			valid = true;
-		}		
+		valid = true;
+		modificationCount++;
+		linkCount++;
 	}
 
 	/**
 	\fn    void HdlProgram::use(void)
-	\brief Start using the program with OpenGL.
+	\brief Start using the program with OpenGL. For a shared program, the values of the uniform variables of this object are loaded if another object used the program last.
 	**/
 	void HdlProgram::use(void)
 	{
-		glUseProgram(program);
+		HandleOpenGL::useProgram(program);
 
 		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
 			OPENGL_ERROR_TRACKER("HdlProgram::use", "glUseProgram()")
 		#endif
-	}
 
-	/**
-	\fn    const std::vector<std::string>& HdlProgram::getUniformsNames(void) const
-	\brief Get access to the list of uniform variables names of supported types managed by the program (GL based). 
+		acquire();
+		bindUniformBlocks();
+	}
 
-	Some variable reported by the Driver might not be accessible. You can use HdlProgram::isUniformVariableValid to detect such variables.
-	
-	\return Access to a string based vector.
-	**/
-	const std::vector<std::string>& HdlProgram::getUniformsNames(void) const
+	void HdlProgram::acquire(void)
 	{
-		return activeUniforms;
-	}
+		HdlProgram* root = (master!=NULL) ? master : this;
 
-	/**
-	\fn    const std::vector<GLenum>& HdlProgram::getUniformsTypes(void) const
-	\brief Get access to the list of uniform variables types corresponding to the names provided by HdlProgram::getUniformsNames (GL based).
+		if(root->shared==NULL || root->shared->owner==root)
+			return ;
 
-	Some variable reported by the Driver might not be accessible. You can use HdlProgram::isUniformVariableValid to detect such variables.
+		if(!isDirectAccessAvailable())
+			HandleOpenGL::useProgram(program);
 
-	\return Access to a GLenum based vector, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
-	**/
-	const std::vector<GLenum>& HdlProgram::getUniformsTypes(void) const
-	{
-		return activeTypes;
-	}
+		for(std::map<GLint, UniformValue>::const_iterator it=root->uniformsValues.begin(); it!=root->uniformsValues.end(); it++)
+			loadUniform(program, it->second.location, it->second.type, it->second.words);
 
-	/**
-	\fn    void HdlProgram::setFragmentLocation(const std::string& fragName, int frag)
-	\brief Link the name of a fragment output variable to a fragment unit.
-	\param fragName Name of the fragment output variable.
-	\param frag     Index of the desired fragment unit.
+		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+			OPENGL_ERROR_TRACKER("HdlProgram::acquire", "loadUniform()")
+		#endif
 
-	Note that the program should be linked after this call in order to push the changes.
-	**/
-	void HdlProgram::setFragmentLocation(const std::string& fragName, int frag)
+		root->shared->owner = root;
+	}
+
+	void HdlProgram::writeUniform(const std::string& varName, const UniformInfo& info, GLenum type, const void* values)
 	{
-		#ifdef GLIP_USE_GL
-			#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
-				std::cout << "HdlProgram::setFragmentLocation - FragName : " << fragName << std::endl;
-			#endif
-			glBindFragDataLocation(program, frag, fragName.c_str());
+		HdlProgram* root = (master!=NULL) ? master : this;
+		const GLint location = info.location;
 
-			const GLenum err = glGetError();
-			if(err!=GL_NO_ERROR)
-				throw Exception("HdlProgram::setFragmentLocation - Error while setting fragment location \"" + fragName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
-		#endif
-	}
+		// Same error as the one GL would raise, without leaving it in the queue (nor saving the value) :
+		if(!isCompatibleUniformType(info.type, type))
+			throw Exception("HdlProgram::setVar - An error occurred when loading data of type \"" + getGLEnumNameSafe(type) + "\" in variable \"" + varName + "\" : " + getGLEnumNameSafe(GL_INVALID_OPERATION) + " - " + getGLErrorDescription(GL_INVALID_OPERATION), __FILE__, __LINE__, Exception::GLException);
 
-	/**
-	\fn    void HdlProgram::setVar(const std::string& varName, GLenum type, int v0, int v1=0, int v2=0, int v3=0)
-	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
-	\param varName Name of the fragment output variable.
-	\param type    Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
-	\param v0      Corresponding value to assign.
-	\param v1      Corresponding value to assign.
-	\param v2      Corresponding value to assign.
-	\param v3      Corresponding value to assign.
-	**/
-	/**
-	\fn    void HdlProgram::setVar(const std::string& varName, GLenum type, unsigned int v0, unsigned int v1=0, unsigned int v2=0, unsigned int v3=0)
-	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
-	\param varName Name of the fragment output variable.
-	\param type    Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
-	\param v0      Corresponding value to assign.
-	\param v1      Corresponding value to assign.
-	\param v2      Corresponding value to assign.
-	\param v3      Corresponding value to assign.
-	**/
-	/**
-	\fn    void HdlProgram::setVar(const std::string& varName, GLenum type, float v0, float v1=0, float v2=0, float v3=0)
-	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
-	\param varName Name of the fragment output variable.
-	\param type    Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
-	\param v0      Corresponding value to assign.
-	\param v1      Corresponding value to assign.
-	\param v2      Corresponding value to assign.
-	\param v3      Corresponding value to assign.
-	**/
+		// The members of the blocks have no location :
+		if(location==-1)
+		{
+			if(info.block<0)
+				throw Exception("HdlProgram::setVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
 
-	/**
-	\fn    void HdlProgram::setVar(const std::string& varName, GLenum t, int* v)
-	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
-	\param varName Name of the fragment output variable.
-	\param t       Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
-	\param v       Pointer to the values to assign.
-	**/
-	/**
-	\fn    void HdlProgram::setVar(const std::string& varName, GLenum t, unsigned int* v)
-	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
-	\param varName Name of the fragment output variable.
-	\param t       Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
-	\param v       Pointer to the values to assign.
-	**/
-	/**
-	\fn    void HdlProgram::setVar(const std::string& varName, GLenum t, float* v)
-	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
-	\param varName Name of the fragment output variable.
-	\param t       Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
-	\param v       Pointer to the values to assign.
-	**/
+			writeBlockUniform(varName, info, type, values);
+			notifyModification();
+			return ;
+		}
 
-	#define GENsetVarA( argT1, argT2, argT3)   \
-		void HdlProgram::setVar(const std::string& varName, GLenum t, argT1 v0, argT1 v1, argT1 v2, argT1 v3) \
-		{ \
-			use(); \
-			GLint loc = glGetUniformLocation(program, varName.c_str()); \
-			\
-			if(loc==-1) \
-				throw Exception("HdlProgram::setVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException); \
-			\
-			switch(t) \
-			{ \
-				case GL_##argT2 : 		glUniform1##argT3 (loc, v0);			break; \
-				case GL_##argT2##_VEC2 : 	glUniform2##argT3 (loc, v0, v1);		break; \
-				case GL_##argT2##_VEC3 : 	glUniform3##argT3 (loc, v0, v1, v2);		break; \
-				case GL_##argT2##_VEC4 : 	glUniform4##argT3 (loc, v0, v1, v2, v3);	break; \
-				default :			throw Exception("HdlProgram::setVar - Unknown variable type or type mismatch for \"" + getGLEnumNameSafe(t) + "\" when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException); \
-			} \
-			\
-			const GLenum err = glGetError(); \
-			if(err!=GL_NO_ERROR) \
-				throw Exception("HdlProgram::setVar - An error occurred when loading data of type \"" + getGLEnumNameSafe(t) + "\" in variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException); \
-		} \
-
-	#define GENsetVarB( argT1, argT2, argT3)   \
-		void HdlProgram::setVar(const std::string& varName, GLenum t, argT1* v) \
-		{ \
-			use(); \
-			GLint loc = glGetUniformLocation(program, varName.c_str()); \
-			\
-			if(loc==-1) \
-				throw Exception("HdlProgram::setVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException); \
-			\
-			switch(t) \
-			{ \
-				case GL_##argT2 : 		glUniform1##argT3##v(loc, 1, v);			break; \
-				case GL_##argT2##_VEC2 : 	glUniform2##argT3##v(loc, 1, v);			break; \
-				case GL_##argT2##_VEC3 : 	glUniform3##argT3##v(loc, 1, v);			break; \
-				case GL_##argT2##_VEC4 : 	glUniform4##argT3##v(loc, 1, v);			break; \
-				default :			throw Exception("HdlProgram::setVar - Unknown variable type or type mismatch for \"" + getGLEnumNameSafe(t) + "\" when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException); \
-			} \
-			\
-			const GLenum err = glGetError(); \
-			if(err!=GL_NO_ERROR) \
-				throw Exception("HdlProgram::setVar - An error occurred when loading data of type \"" + getGLEnumNameSafe(t) + "\" in variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException); \
-		}
-
-	GENsetVarA( int, INT, i)
-	GENsetVarB( int, INT, i)
-	GENsetVarA( unsigned int, UNSIGNED_INT, ui)
-	GENsetVarB( unsigned int, UNSIGNED_INT, ui)
-	GENsetVarA( float, FLOAT, f)
-
-	#undef GENsetVar
-
-	// Last one, with matrices :
-	void HdlProgram::setVar(const std::string& varName, GLenum t, float* v)
-	{
-		use();
-		GLint loc = glGetUniformLocation(program, varName.c_str());
+		// The values of a shared program used by another object are only saved, they will be loaded by HdlProgram::use :
+		if(root->shared==NULL || root->shared->owner==root)
+		{
+			if(!isDirectAccessAvailable())
+				HandleOpenGL::useProgram(program);
 
-		if(loc==-1)
-			throw Exception("HdlProgram::setVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
+			loadUniform(program, location, type, values);
+		}
 
-		switch(t)
+		if(root->shared!=NULL)
 		{
-			case GL_FLOAT : 	glUniform1fv(loc, 1, v);			break;
-			case GL_FLOAT_VEC2 : 	glUniform2fv(loc, 1, v);			break;
-			case GL_FLOAT_VEC3 : 	glUniform3fv(loc, 1, v);			break;
-			case GL_FLOAT_VEC4 : 	glUniform4fv(loc, 1, v);			break;
-			case GL_FLOAT_MAT2 :	glUniformMatrix2fv(loc, 1, GL_FALSE, v);	break;
-			case GL_FLOAT_MAT3 :	glUniformMatrix3fv(loc, 1, GL_FALSE, v);	break;
-			case GL_FLOAT_MAT4 :	glUniformMatrix4fv(loc, 1, GL_FALSE, v);	break;
-			default :		throw Exception("HdlProgram::setVar - Unknown variable type or type mismatch for \"" + getGLEnumNameSafe(t) + "\" when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
+			// Keyed by location, so that all the names of the same variable share the same value :
+			UniformValue& v = root->uniformsValues[location];
+			v.type		= type;
+			v.location	= location;
+			std::memcpy(v.words, values, getNumWords(type)*sizeof(GLuint));
 		}
 
-		const GLenum err = glGetError();
-		if(err!=GL_NO_ERROR)
-			throw Exception("HdlProgram::setVar - An error occurred when loading data of type \"" + getGLEnumNameSafe(t) + "\" in variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		notifyModification();
+
+		if(errorChecking)
+		{
+			const GLenum err = glGetError();
+			if(err!=GL_NO_ERROR)
+				throw Exception("HdlProgram::setVar - An error occurred when loading data of type \"" + getGLEnumNameSafe(type) + "\" in variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		}
 	}
 
-	/**
-	\fn void HdlProgram::setVar(const std::string& varName, const HdlDynamicData& data)
-	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
-	\param varName Name of the fragment output variable.
-	\param data The dynamic object to be used as source.
-	**/
-	void HdlProgram::setVar(const std::string& varName, const HdlDynamicData& data)
+	void HdlProgram::writeUniform(const std::string& varName, const UniformInfo& info, const HdlDynamicData& data)
 	{
-		use();
-		GLint loc = glGetUniformLocation(program, varName.c_str());
-
-		if(loc==-1)
-			throw Exception("HdlProgram::setVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
-
 		switch(data.getGLType())
 		{
-			case GL_BYTE :			glUniform1i(loc, data.get(0));								break;
-			case GL_UNSIGNED_BYTE : 	glUniform1ui(loc, data.get(0));								break;
-			case GL_SHORT :			glUniform1i(loc, data.get(0));								break;
-			case GL_UNSIGNED_SHORT :	glUniform1ui(loc, data.get(0));								break;
-			case GL_FLOAT : 		glUniform1fv(loc, 1, reinterpret_cast<const GLfloat*>(data.getPtr()));			break;
-			case GL_FLOAT_VEC2 : 		glUniform2fv(loc, 1, reinterpret_cast<const GLfloat*>(data.getPtr()));			break;
-			case GL_FLOAT_VEC3 : 		glUniform3fv(loc, 1, reinterpret_cast<const GLfloat*>(data.getPtr()));			break;
-			case GL_FLOAT_VEC4 : 		glUniform4fv(loc, 1, reinterpret_cast<const GLfloat*>(data.getPtr()));			break;
+			case GL_BYTE :
+			case GL_SHORT :
+				{
+					const GLint value = data.get(0);
+					writeUniform(varName, info, GL_INT, &value);
+				}
+				break;
+			case GL_UNSIGNED_BYTE :
+			case GL_UNSIGNED_SHORT :
+				{
+					const GLuint value = data.get(0);
+					writeUniform(varName, info, GL_UNSIGNED_INT, &value);
+				}
+				break;
 			#ifdef GLIP_USE_GL
-			case GL_DOUBLE :		throw Exception("HdlProgram::setVar - Double type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
-			case GL_DOUBLE_VEC2 :		throw Exception("HdlProgram::setVar - Double type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
-			case GL_DOUBLE_VEC3 :		throw Exception("HdlProgram::setVar - Double type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
+			case GL_DOUBLE :
+			case GL_DOUBLE_VEC2 :
+			case GL_DOUBLE_VEC3 :
 			case GL_DOUBLE_VEC4 :		throw Exception("HdlProgram::setVar - Double type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
 			#endif
-			case GL_INT :			glUniform1iv(loc, 1, reinterpret_cast<const GLint*>(data.getPtr()));			break;
-			case GL_INT_VEC2 :		glUniform2iv(loc, 1, reinterpret_cast<const GLint*>(data.getPtr()));			break;
-			case GL_INT_VEC3 :		glUniform3iv(loc, 1, reinterpret_cast<const GLint*>(data.getPtr()));			break;
-			case GL_INT_VEC4 :		glUniform4iv(loc, 1, reinterpret_cast<const GLint*>(data.getPtr()));			break;
-			case GL_UNSIGNED_INT :		glUniform1uiv(loc, 1, reinterpret_cast<const GLuint*>(data.getPtr()));			break;
-			case GL_UNSIGNED_INT_VEC2 :	glUniform1uiv(loc, 1, reinterpret_cast<const GLuint*>(data.getPtr()));			break;
-			case GL_UNSIGNED_INT_VEC3 :	glUniform1uiv(loc, 1, reinterpret_cast<const GLuint*>(data.getPtr()));			break;
-			case GL_UNSIGNED_INT_VEC4 :	glUniform1uiv(loc, 1, reinterpret_cast<const GLuint*>(data.getPtr()));			break;
-			case GL_BOOL :			throw Exception("HdlProgram::setVar - Bool type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
-			case GL_BOOL_VEC2 :		throw Exception("HdlProgram::setVar - Bool type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
-			case GL_BOOL_VEC3 :		throw Exception("HdlProgram::setVar - Bool type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
+			case GL_BOOL :
+			case GL_BOOL_VEC2 :
+			case GL_BOOL_VEC3 :
 			case GL_BOOL_VEC4 :		throw Exception("HdlProgram::setVar - Bool type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
-			case GL_FLOAT_MAT2 :		glUniformMatrix2fv(loc, 1, GL_FALSE, reinterpret_cast<const GLfloat*>(data.getPtr()));	break;
-			case GL_FLOAT_MAT3 :		glUniformMatrix3fv(loc, 1, GL_FALSE, reinterpret_cast<const GLfloat*>(data.getPtr()));	break;
-			case GL_FLOAT_MAT4 :		glUniformMatrix4fv(loc, 1, GL_FALSE, reinterpret_cast<const GLfloat*>(data.getPtr()));	break;
-			default :			throw Exception("HdlProgram::setVar - Unknown variable type or type mismatch for \"" + getGLEnumNameSafe(data.getGLType()) + "\" when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
+			default :
+				if(getNumWords(data.getGLType())==0)
+					throw Exception("HdlProgram::setVar - Unknown variable type or type mismatch for \"" + getGLEnumNameSafe(data.getGLType()) + "\" when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
+				writeUniform(varName, info, data.getGLType(), data.getPtr());
 		}
-
-		const GLenum err = glGetError();
-		if(err!=GL_NO_ERROR)
-			throw Exception("HdlProgram::setVar - An error occurred when loading data of type \"" + getGLEnumNameSafe(data.getGLType()) + "\" in variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
 	}
 
-	/**
-	\fn    void HdlProgram::getVar(const std::string& varName, int* ptr)
-	\brief Read a uniform variable from a shader. Warning : this function does not perform any type or size check which might result in a buffer overflow if not used with care.
-	\param varName The name of the uniform variable to read from.
-	\param ptr A pointer to a buffer with sufficient size in order to contain the full object (scalar, vector, matrix...).
-	**/
-	void HdlProgram::getVar(const std::string& varName, int* ptr)
+	void HdlProgram::writeBlockUniform(const std::string& varName, const UniformInfo& info, GLenum type, const void* values)
 	{
-		use();
-		GLint loc = glGetUniformLocation(program, varName.c_str());
+		HdlProgram* root = (master!=NULL) ? master : this;
+		UniformBlock& b = root->uniformBlocks[info.block];
 
-		if(loc==-1)
-			throw Exception("HdlProgram::getVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
+		const bool	isBool = (info.type==GL_BOOL || info.type==GL_BOOL_VEC2 || info.type==GL_BOOL_VEC3 || info.type==GL_BOOL_VEC4);
+		const char	category = getTypeCategory(type);
+
+		if(getNumWords(type)!=getNumWords(info.type) || (category!=getTypeCategory(info.type) && !(isBool && category=='u')))
+			throw Exception("HdlProgram::setVar - Unknown variable type or type mismatch for \"" + getGLEnumNameSafe(type) + "\" when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
+
+		// Copy to the block, following its layout :
+		std::vector<unsigned char>& data = getBlockData(b);
+		const GLuint*	words	= reinterpret_cast<const GLuint*>(values);
+		const int	columns	= getNumColumns(info.type),
+				rows	= getNumWords(info.type) / columns;
+		GLint		end	= info.offset;
 
-		glGetUniformiv(program, loc, ptr);
+		for(int c=0; c<columns; c++)
+		{
+			for(int r=0; r<rows; r++)
+			{
+				const GLint o = info.offset + ((columns==1) ? r*4 : ((info.rowMajor!=0) ? (r*info.matrixStride + c*4) : (c*info.matrixStride + r*4)));
+				std::memcpy(&data[o], words + c*rows + r, sizeof(GLuint));
+				end = std::max(end, o + 4);
+			}
+		}
 
-		const GLenum err = glGetError();
-		if(err!=GL_NO_ERROR)
-			throw Exception("HdlProgram::getVar - An error occurred when reading variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		uploadBlockData(b, info.offset, end - info.offset);
 	}
 
-	/**
-	\fn    void HdlProgram::getVar(const std::string& varName, unsigned int* ptr)
-	\brief Read a uniform variable from a shader. Warning : this function does not perform any type or size check which might result in a buffer overflow if not used with care.
-	\param varName The name of the uniform variable to read from.
-	\param ptr A pointer to a buffer with sufficient size in order to contain the full object (scalar, vector, matrix...).
-	**/
-	void HdlProgram::getVar(const std::string& varName, unsigned int* ptr)
+	void HdlProgram::readBlockUniform(const UniformInfo& info, void* values) const
 	{
-		use();
-		GLint loc = glGetUniformLocation(program, varName.c_str());
+		const HdlProgram* root = (master!=NULL) ? master : this;
+		const std::vector<unsigned char>& data = getBlockData(root->uniformBlocks[info.block]);
 
-		if(loc==-1)
+		GLuint*		words	= reinterpret_cast<GLuint*>(values);
+		const int	columns	= getNumColumns(info.type),
+				rows	= getNumWords(info.type) / columns;
+
+		for(int c=0; c<columns; c++)
+		{
+			for(int r=0; r<rows; r++)
+			{
+				const GLint o = info.offset + ((columns==1) ? r*4 : ((info.rowMajor!=0) ? (r*info.matrixStride + c*4) : (c*info.matrixStride + r*4)));
+				std::memcpy(words + c*rows + r, &data[o], sizeof(GLuint));
+			}
+		}
+	}
+
+	HdlProgram::UniformBlock& HdlProgram::findUniformBlock(const std::string& blockName, const std::string& caller)
+	{
+		HdlProgram* root = (master!=NULL) ? master : this;
+
+		for(std::vector<UniformBlock>::iterator it=root->uniformBlocks.begin(); it!=root->uniformBlocks.end(); it++)
+		{
+			if(it->name==blockName)
+				return (*it);
+		}
+
+		throw Exception(caller + " - Unknown uniform block \"" + blockName + "\". Is it used in the program?", __FILE__, __LINE__, Exception::GLException);
+	}
+
+	void HdlProgram::bindUniformBlocks(void)
+	{
+		HdlProgram* root = (master!=NULL) ? master : this;
+
+		for(unsigned int k=0; k<root->uniformBlocks.size(); k++)
+		{
+			UniformBlock& b = root->uniformBlocks[k];
+
+			if(b.buffer==NULL)
+			{
+				b.buffer	= new HdlGeBO(b.size, GL_UNIFORM_BUFFER, GL_DYNAMIC_DRAW);
+				b.ownBuffer	= true;
+				b.deferred	= true;
+				b.modified	= true;
+			}
+
+			if(b.modified)
+			{
+				b.buffer->subWrite(&b.data[0], b.size, 0);
+				b.modified = false;
+			}
+
+			HandleOpenGL::bindUniformBuffer(k, b.buffer->getID());
+		}
+
+		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+			OPENGL_ERROR_TRACKER("HdlProgram::bindUniformBlocks", "glBindBufferBase()")
+		#endif
+	}
+
+	void HdlProgram::releaseUniformBlocks(void)
+	{
+		for(std::vector<UniformBlock>::iterator it=uniformBlocks.begin(); it!=uniformBlocks.end(); it++)
+		{
+			detachBlockBuffer(*it);
+
+			if(it->ownBuffer)
+				delete it->buffer;
+
+			it->buffer	= NULL;
+			it->ownBuffer	= false;
+			it->deferred	= false;
+			it->modified	= true;
+		}
+	}
+
+	void HdlProgram::attachBlockBuffer(UniformBlock& b)
+	{
+		HdlProgram* root = (master!=NULL) ? master : this;
+		std::map<const HdlGeBO*, SharedBlock*>::iterator it = sharedBlocks.find(b.buffer);
+		SharedBlock* s = NULL;
+
+		// The first program using the buffer provides the values :
+		if(it==sharedBlocks.end())
+		{
+			s = new SharedBlock;
+			s->data = b.data;
+			sharedBlocks[b.buffer] = s;
+		}
+		else
+			s = it->second;
+
+		if(s->data.size()<b.data.size())
+			s->data.resize(b.data.size(), 0);
+
+		s->programs.push_back(root);
+		b.store = s;
+	}
+
+	void HdlProgram::detachBlockBuffer(UniformBlock& b)
+	{
+		if(b.store==NULL)
+			return ;
+
+		HdlProgram* root = (master!=NULL) ? master : this;
+		std::vector<HdlProgram*>::iterator it = std::find(b.store->programs.begin(), b.store->programs.end(), root);
+		if(it!=b.store->programs.end())
+			b.store->programs.erase(it);
+
+		// Keep the last values :
+		b.data.assign(b.store->data.begin(), b.store->data.begin() + b.size);
+
+		if(b.store->programs.empty())
+		{
+			sharedBlocks.erase(b.buffer);
+			delete b.store;
+		}
+
+		b.store = NULL;
+	}
+
+	void HdlProgram::uploadBlockData(UniformBlock& b, int offset, int size)
+	{
+		// A private buffer is uploaded at once by HdlProgram::use, only the range is written to a shared buffer :
+		if(b.buffer!=NULL && !b.deferred)
+		{
+			b.buffer->subWrite(&getBlockData(b)[offset], size, offset);
+
+			// All the programs using the buffer see the new values :
+			if(b.store!=NULL)
+			{
+				for(std::vector<HdlProgram*>::iterator it=b.store->programs.begin(); it!=b.store->programs.end(); it++)
+					(*it)->notifyModification();
+			}
+		}
+		else
+			b.modified = true;
+	}
+
+	std::vector<unsigned char>& HdlProgram::getBlockData(UniformBlock& b)
+	{
+		return (b.store!=NULL) ? b.store->data : b.data;
+	}
+
+	const std::vector<unsigned char>& HdlProgram::getBlockData(const UniformBlock& b)
+	{
+		return (b.store!=NULL) ? b.store->data : b.data;
+	}
+
+	const HdlProgram::UniformInfo* HdlProgram::findUniform(const std::string& varName) const
+	{
+		const HdlProgram* root = (master!=NULL) ? master : this;
+		std::map<std::string, UniformInfo>::const_iterator it = root->uniformsTable.find(uniformsPrefix + varName);
+
+		if(it!=root->uniformsTable.end())
+			return &(it->second);
+		else
+			return NULL;
+	}
+
+	char HdlProgram::getTypeCategory(GLenum type)
+	{
+		switch(type)
+		{
+			case GL_FLOAT :
+			case GL_FLOAT_VEC2 :
+			case GL_FLOAT_VEC3 :
+			case GL_FLOAT_VEC4 :
+			case GL_FLOAT_MAT2 :
+			case GL_FLOAT_MAT3 :
+			case GL_FLOAT_MAT4 :		return 'f';
+			case GL_UNSIGNED_INT :
+			case GL_UNSIGNED_INT_VEC2 :
+			case GL_UNSIGNED_INT_VEC3 :
+			case GL_UNSIGNED_INT_VEC4 :	return 'u';
+			#ifdef GLIP_USE_GL
+			case GL_DOUBLE :
+			case GL_DOUBLE_VEC2 :
+			case GL_DOUBLE_VEC3 :
+			case GL_DOUBLE_VEC4 :		return 'd';
+			#endif
+			default :			return 'i';	// Integers, booleans and samplers.
+		}
+	}
+
+	bool HdlProgram::isDirectAccessAvailable(void)
+	{
+		#ifdef GLIP_USE_GL
+			return GLEW_VERSION_4_1 || GLEW_ARB_separate_shader_objects;
+		#elif defined(GL_ES_VERSION_3_1)
+			return true;
+		#else
+			return false;
+		#endif
+	}
+
+	int HdlProgram::getNumColumns(GLenum type)
+	{
+		switch(type)
+		{
+			case GL_FLOAT_MAT2 :		return 2;
+			case GL_FLOAT_MAT3 :		return 3;
+			case GL_FLOAT_MAT4 :		return 4;
+			default :			return 1;
+		}
+	}
+
+	bool HdlProgram::isUniformBufferAvailable(void)
+	{
+		#ifdef GLIP_USE_GL
+			return GLEW_VERSION_3_1 || GLEW_ARB_uniform_buffer_object;
+		#elif defined(GL_ES_VERSION_3_0)
+			return true;
+		#else
+			return false;
+		#endif
+	}
+
+	bool HdlProgram::isCompatibleUniformType(GLenum uniformType, GLenum type)
+	{
+		if(type==uniformType)
+			return true;
+		// The samplers and the images are written as integers :
+		else if(getNumWords(uniformType)==0)
+			return getTypeCategory(uniformType)=='i' && type==GL_INT;
+		// The booleans can also be written as integers :
+		else if(uniformType==GL_BOOL || uniformType==GL_BOOL_VEC2 || uniformType==GL_BOOL_VEC3 || uniformType==GL_BOOL_VEC4)
+			return getNumWords(type)==getNumWords(uniformType) && getTypeCategory(type)=='i';
+		else
+			return false;
+	}
+
+	int HdlProgram::getNumWords(GLenum type)
+	{
+		switch(type)
+		{
+			case GL_FLOAT :
+			case GL_INT :
+			case GL_UNSIGNED_INT :
+			case GL_BOOL :			return 1;
+			case GL_FLOAT_VEC2 :
+			case GL_INT_VEC2 :
+			case GL_UNSIGNED_INT_VEC2 :
+			case GL_BOOL_VEC2 :		return 2;
+			case GL_FLOAT_VEC3 :
+			case GL_INT_VEC3 :
+			case GL_UNSIGNED_INT_VEC3 :
+			case GL_BOOL_VEC3 :		return 3;
+			case GL_FLOAT_VEC4 :
+			case GL_INT_VEC4 :
+			case GL_UNSIGNED_INT_VEC4 :
+			case GL_BOOL_VEC4 :
+			case GL_FLOAT_MAT2 :		return 4;
+			case GL_FLOAT_MAT3 :		return 9;
+			case GL_FLOAT_MAT4 :		return 16;
+			default :			return 0;
+		}
+	}
+
+	void HdlProgram::loadUniform(GLuint program, GLint location, GLenum type, const void* values)
+	{
+		const GLfloat* f	= reinterpret_cast<const GLfloat*>(values);
+		const GLint* i		= reinterpret_cast<const GLint*>(values);
+		const GLuint* u		= reinterpret_cast<const GLuint*>(values);
+
+		const bool directAccess = isDirectAccessAvailable();
+
+		#define LOAD_UNIFORM( function, ptr ) \
+			if(directAccess) \
+				glProgram##function(program, location, 1, ptr); \
+			else \
+				gl##function(location, 1, ptr);
+		#define LOAD_UNIFORM_MATRIX( function, ptr ) \
+			if(directAccess) \
+				glProgram##function(program, location, 1, GL_FALSE, ptr); \
+			else \
+				gl##function(location, 1, GL_FALSE, ptr);
+
+		switch(type)
+		{
+			case GL_FLOAT :			LOAD_UNIFORM(Uniform1fv, f)			break;
+			case GL_FLOAT_VEC2 :		LOAD_UNIFORM(Uniform2fv, f)			break;
+			case GL_FLOAT_VEC3 :		LOAD_UNIFORM(Uniform3fv, f)			break;
+			case GL_FLOAT_VEC4 :		LOAD_UNIFORM(Uniform4fv, f)			break;
+			case GL_FLOAT_MAT2 :		LOAD_UNIFORM_MATRIX(UniformMatrix2fv, f)	break;
+			case GL_FLOAT_MAT3 :		LOAD_UNIFORM_MATRIX(UniformMatrix3fv, f)	break;
+			case GL_FLOAT_MAT4 :		LOAD_UNIFORM_MATRIX(UniformMatrix4fv, f)	break;
+			case GL_INT :
+			case GL_BOOL :			LOAD_UNIFORM(Uniform1iv, i)			break;
+			case GL_INT_VEC2 :
+			case GL_BOOL_VEC2 :		LOAD_UNIFORM(Uniform2iv, i)			break;
+			case GL_INT_VEC3 :
+			case GL_BOOL_VEC3 :		LOAD_UNIFORM(Uniform3iv, i)			break;
+			case GL_INT_VEC4 :
+			case GL_BOOL_VEC4 :		LOAD_UNIFORM(Uniform4iv, i)			break;
+			case GL_UNSIGNED_INT :		LOAD_UNIFORM(Uniform1uiv, u)			break;
+			case GL_UNSIGNED_INT_VEC2 :	LOAD_UNIFORM(Uniform2uiv, u)			break;
+			case GL_UNSIGNED_INT_VEC3 :	LOAD_UNIFORM(Uniform3uiv, u)			break;
+			case GL_UNSIGNED_INT_VEC4 :	LOAD_UNIFORM(Uniform4uiv, u)			break;
+			default :			break;
+		}
+
+		#undef LOAD_UNIFORM
+		#undef LOAD_UNIFORM_MATRIX
+	}
+
+	void HdlProgram::releaseSharedProgram(SharedProgram* s)
+	{
+		s->references--;
+
+		if(s->references>0)
+			return ;
+
+		std::map<unsigned long long, SharedProgram*>::iterator it = sharedPrograms.find(s->hash);
+		if(it!=sharedPrograms.end() && it->second==s)
+			sharedPrograms.erase(it);
+
+		for(int k=0; k<numShaderTypes; k++)
+		{
+			if(s->shaders[k]!=NULL)
+			{
+				if(s->program!=0)
+					glDetachShader(s->program, s->shaders[k]->getShaderID());
+				delete s->shaders[k];
+			}
+		}
+
+		if(s->program!=0)
+		{
+			HandleOpenGL::forgetProgram(s->program);
+			glDeleteProgram(s->program);
+
+			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+				OPENGL_ERROR_TRACKER("HdlProgram::releaseSharedProgram", "glDeleteProgram(program)")
+			#endif
+		}
+
+		delete s;
+	}
+
+	unsigned long long HdlProgram::getHash(const std::string& key)
+	{
+		// FNV-1a :
+		unsigned long long hash = 14695981039346656037ULL;
+		for(std::string::const_iterator it=key.begin(); it!=key.end(); it++)
+		{
+			hash ^= static_cast<unsigned char>(*it);
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	bool HdlProgram::isBinaryCacheAvailable(void)
+	{
+		if(binaryCacheDirectory.empty())
+			return false;
+
+		#ifdef GLIP_USE_GL
+			if(!GLEW_VERSION_4_1 && !GLEW_ARB_get_program_binary)
+				return false;
+		#endif
+
+		GLint numFormats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+
+		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+			OPENGL_ERROR_TRACKER("HdlProgram::isBinaryCacheAvailable", "glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS)")
+		#endif
+
+		return numFormats>0;
+	}
+
+	bool HdlProgram::loadBinary(const std::string& filename, const std::string& binaryKey)
+	{
+		std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+
+		if(!file.is_open())
+			return false;
+
+		// Header, key, format and data :
+		char signature[sizeof(binarySignature)];
+		unsigned int keyLength = 0;
+		GLenum format = GL_NONE;
+		GLint length = 0;
+
+		file.read(signature, sizeof(binarySignature));
+		file.read(reinterpret_cast<char*>(&keyLength), sizeof(keyLength));
+
+		if(!file.good() || std::memcmp(signature, binarySignature, sizeof(binarySignature))!=0 || keyLength!=binaryKey.size())
+			return false;
+
+		std::vector<char> buffer(keyLength);
+		file.read(&buffer[0], keyLength);
+
+		if(!file.good() || binaryKey.compare(0, std::string::npos, &buffer[0], keyLength)!=0)
+			return false;
+
+		file.read(reinterpret_cast<char*>(&format), sizeof(format));
+		file.read(reinterpret_cast<char*>(&length), sizeof(length));
+
+		if(!file.good() || length<=0)
+			return false;
+
+		buffer.resize(length);
+		file.read(&buffer[0], length);
+
+		if(!file.good())
+			return false;
+
+		glProgramBinary(program, format, &buffer[0], length);
+
+		// The driver can reject the binary (update, other hardware) :
+		GLint linkStatus = GL_FALSE;
+		glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+		while(glGetError()!=GL_NO_ERROR);
+
+		if(linkStatus!=GL_TRUE)
+			return false;
+
+		listActiveUniforms();
+		return true;
+	}
+
+	void HdlProgram::saveBinary(const std::string& filename, const std::string& binaryKey)
+	{
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+		if(length<=0)
+			return ;
+
+		std::vector<char> buffer(length);
+		GLenum format = GL_NONE;
+		glGetProgramBinary(program, length, &length, &format, &buffer[0]);
+
+		// The cache is optional, failures are ignored :
+		if(glGetError()!=GL_NO_ERROR || length<=0)
+			return ;
+
+		// Write to a temporary file first, for the other processes sharing the cache :
+		const std::string temporaryFilename = filename + ".tmp";
+		std::ofstream file(temporaryFilename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if(!file.is_open())
+			return ;
+
+		const unsigned int keyLength = binaryKey.size();
+		file.write(binarySignature, sizeof(binarySignature));
+		file.write(reinterpret_cast<const char*>(&keyLength), sizeof(keyLength));
+		file.write(binaryKey.c_str(), keyLength);
+		file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+		file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+		file.write(&buffer[0], length);
+		file.close();
+
+		if(file.fail() || std::rename(temporaryFilename.c_str(), filename.c_str())!=0)
+			std::remove(temporaryFilename.c_str());
+	}
+
+	/**
+	\fn    const std::vector<std::string>& HdlProgram::getUniformsNames(void) const
+	\brief Get access to the list of uniform variables names of supported types managed by the program (GL based). 
+
+	Some variable reported by the Driver might not be accessible. You can use HdlProgram::isUniformVariableValid to detect such variables.
+	
+	\return Access to a string based vector.
+	**/
+	const std::vector<std::string>& HdlProgram::getUniformsNames(void) const
+	{
+		return activeUniforms;
+	}
+
+	/**
+	\fn    const std::vector<GLenum>& HdlProgram::getUniformsTypes(void) const
+	\brief Get access to the list of uniform variables types corresponding to the names provided by HdlProgram::getUniformsNames (GL based).
+
+	Some variable reported by the Driver might not be accessible. You can use HdlProgram::isUniformVariableValid to detect such variables.
+
+	\return Access to a GLenum based vector, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
+	**/
+	const std::vector<GLenum>& HdlProgram::getUniformsTypes(void) const
+	{
+		return activeTypes;
+	}
+
+	/**
+	\fn    void HdlProgram::setFragmentLocation(const std::string& fragName, int frag)
+	\brief Link the name of a fragment output variable to a fragment unit.
+	\param fragName Name of the fragment output variable.
+	\param frag     Index of the desired fragment unit.
+
+	Note that the program should be linked after this call in order to push the changes.
+	**/
+	void HdlProgram::setFragmentLocation(const std::string& fragName, int frag)
+	{
+		if(shared!=NULL)
+			throw Exception("HdlProgram::setFragmentLocation - Cannot modify a shared program.", __FILE__, __LINE__, Exception::GLException);
+
+		#ifdef GLIP_USE_GL
+			#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
+				std::cout << "HdlProgram::setFragmentLocation - FragName : " << fragName << std::endl;
+			#endif
+			glBindFragDataLocation(program, frag, fragName.c_str());
+
+			const GLenum err = glGetError();
+			if(err!=GL_NO_ERROR)
+				throw Exception("HdlProgram::setFragmentLocation - Error while setting fragment location \"" + fragName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		#endif
+	}
+
+	/**
+	\fn    void HdlProgram::setVar(const std::string& varName, GLenum type, int v0, int v1=0, int v2=0, int v3=0)
+	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
+	\param varName Name of the fragment output variable.
+	\param type    Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
+	\param v0      Corresponding value to assign.
+	\param v1      Corresponding value to assign.
+	\param v2      Corresponding value to assign.
+	\param v3      Corresponding value to assign.
+	**/
+	/**
+	\fn    void HdlProgram::setVar(const std::string& varName, GLenum type, unsigned int v0, unsigned int v1=0, unsigned int v2=0, unsigned int v3=0)
+	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
+	\param varName Name of the fragment output variable.
+	\param type    Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
+	\param v0      Corresponding value to assign.
+	\param v1      Corresponding value to assign.
+	\param v2      Corresponding value to assign.
+	\param v3      Corresponding value to assign.
+	**/
+	/**
+	\fn    void HdlProgram::setVar(const std::string& varName, GLenum type, float v0, float v1=0, float v2=0, float v3=0)
+	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
+	\param varName Name of the fragment output variable.
+	\param type    Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
+	\param v0      Corresponding value to assign.
+	\param v1      Corresponding value to assign.
+	\param v2      Corresponding value to assign.
+	\param v3      Corresponding value to assign.
+	**/
+
+	/**
+	\fn    void HdlProgram::setVar(const std::string& varName, GLenum t, int* v)
+	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
+	\param varName Name of the fragment output variable.
+	\param t       Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
+	\param v       Pointer to the values to assign.
+	**/
+	/**
+	\fn    void HdlProgram::setVar(const std::string& varName, GLenum t, unsigned int* v)
+	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
+	\param varName Name of the fragment output variable.
+	\param t       Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
+	\param v       Pointer to the values to assign.
+	**/
+	/**
+	\fn    void HdlProgram::setVar(const std::string& varName, GLenum t, float* v)
+	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
+	\param varName Name of the fragment output variable.
+	\param t       Kind of variable in, see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for possible types.
+	\param v       Pointer to the values to assign.
+	**/
+
+	#define GENsetVarA( argT1, argT2 )   \
+		void HdlProgram::setVar(const std::string& varName, GLenum t, argT1 v0, argT1 v1, argT1 v2, argT1 v3) \
+		{ \
+			const argT1 values[4] = {v0, v1, v2, v3}; \
+			setUniform(varName, t, GL_##argT2, values, 4); \
+		}
+
+	#define GENsetVarB( argT1, argT2 )   \
+		void HdlProgram::setVar(const std::string& varName, GLenum t, argT1* v) \
+		{ \
+			setUniform(varName, t, GL_##argT2, v, 16); \
+		}
+
+	GENsetVarA( int, INT)
+	GENsetVarB( int, INT)
+	GENsetVarA( unsigned int, UNSIGNED_INT)
+	GENsetVarB( unsigned int, UNSIGNED_INT)
+	GENsetVarA( float, FLOAT)
+	GENsetVarB( float, FLOAT)
+
+	#undef GENsetVarA
+	#undef GENsetVarB
+
+	void HdlProgram::setUniform(const std::string& varName, GLenum t, GLenum scalarType, const void* values, int maxNumWords)
+	{
+		const int numWords = getNumWords(t);
+
+		if(numWords==0 || numWords>maxNumWords || getTypeCategory(t)!=getTypeCategory(scalarType) || (scalarType==GL_INT && (t==GL_BOOL || t==GL_BOOL_VEC2 || t==GL_BOOL_VEC3 || t==GL_BOOL_VEC4)))
+			throw Exception("HdlProgram::setVar - Unknown variable type or type mismatch for \"" + getGLEnumNameSafe(t) + "\" when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
+
+		const UniformInfo* info = findUniform(varName);
+
+		if(info==NULL || (info->location==-1 && info->block<0))
+			throw Exception("HdlProgram::setVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
+
+		writeUniform(varName, *info, t, values);
+	}
+
+	/**
+	\fn void HdlProgram::setVar(const std::string& varName, const HdlDynamicData& data)
+	\brief Change a uniform variable in a shader. Raise an exception if any error occur.
+	\param varName Name of the fragment output variable.
+	\param data The dynamic object to be used as source.
+	**/
+	void HdlProgram::setVar(const std::string& varName, const HdlDynamicData& data)
+	{
+		const UniformInfo* info = findUniform(varName);
+
+		if(info==NULL || (info->location==-1 && info->block<0))
+			throw Exception("HdlProgram::setVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
+
+		writeUniform(varName, *info, data);
+	}
+
+	/**
+	\fn    void HdlProgram::getVar(const std::string& varName, int* ptr)
+	\brief Read a uniform variable from a shader. Warning : this function does not perform any type or size check which might result in a buffer overflow if not used with care.
+	\param varName The name of the uniform variable to read from.
+	\param ptr A pointer to a buffer with sufficient size in order to contain the full object (scalar, vector, matrix...).
+	**/
+	void HdlProgram::getVar(const std::string& varName, int* ptr)
+	{
+		acquire();
+		const UniformInfo* info = findUniform(varName);
+
+		if(info==NULL || (info->location==-1 && info->block<0))
+			throw Exception("HdlProgram::getVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
+
+		if(info->block>=0)
+		{
+			readBlockUniform(*info, ptr);
+			return ;
+		}
+
+		glGetUniformiv(program, info->location, ptr);
+
+		if(errorChecking)
+		{
+			const GLenum err = glGetError();
+			if(err!=GL_NO_ERROR)
+				throw Exception("HdlProgram::getVar - An error occurred when reading variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		}
+	}
+
+	/**
+	\fn    void HdlProgram::getVar(const std::string& varName, unsigned int* ptr)
+	\brief Read a uniform variable from a shader. Warning : this function does not perform any type or size check which might result in a buffer overflow if not used with care.
+	\param varName The name of the uniform variable to read from.
+	\param ptr A pointer to a buffer with sufficient size in order to contain the full object (scalar, vector, matrix...).
+	**/
+	void HdlProgram::getVar(const std::string& varName, unsigned int* ptr)
+	{
+		acquire();
+		const UniformInfo* info = findUniform(varName);
+
+		if(info==NULL || (info->location==-1 && info->block<0))
 			throw Exception("HdlProgram::getVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
 
-		glGetUniformuiv(program, loc, ptr);
+		if(info->block>=0)
+		{
+			readBlockUniform(*info, ptr);
+			return ;
+		}
+
+		glGetUniformuiv(program, info->location, ptr);
 
-		const GLenum err = glGetError();
-		if(err!=GL_NO_ERROR)
-			throw Exception("HdlProgram::getVar - An error occurred when reading variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		if(errorChecking)
+		{
+			const GLenum err = glGetError();
+			if(err!=GL_NO_ERROR)
+				throw Exception("HdlProgram::getVar - An error occurred when reading variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		}
 	}
 
 	/**
@@ -674,16 +1525,26 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlProgram::getVar(const std::string& varName, float* ptr)
 	{
-		GLint loc = glGetUniformLocation(program, varName.c_str());
+		acquire();
+		const UniformInfo* info = findUniform(varName);
 
-		if (loc==-1)
+		if(info==NULL || (info->location==-1 && info->block<0))
 			throw Exception("HdlProgram::getVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
 
-		glGetUniformfv(program, loc, ptr);
+		if(info->block>=0)
+		{
+			readBlockUniform(*info, ptr);
+			return ;
+		}
+
+		glGetUniformfv(program, info->location, ptr);
 
-		const GLenum err = glGetError();
-		if(err!=GL_NO_ERROR)
-			throw Exception("HdlProgram::getVar - An error occurred when reading variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		if(errorChecking)
+		{
+			const GLenum err = glGetError();
+			if(err!=GL_NO_ERROR)
+				throw Exception("HdlProgram::getVar - An error occurred when reading variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		}
 	}
 
 	/**
@@ -694,11 +1555,21 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlProgram::getVar(const std::string& varName, HdlDynamicData& data)
 	{
-		GLint loc = glGetUniformLocation(program, varName.c_str());
+		acquire();
+		const UniformInfo* info = findUniform(varName);
 
-		if(loc==-1)
+		if(info==NULL || (info->location==-1 && info->block<0))
 			throw Exception("HdlProgram::getVar - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
 
+		if(info->block>=0)
+		{
+			if(getNumWords(data.getGLType())!=getNumWords(info->type) || getTypeCategory(data.getGLType())!=getTypeCategory(info->type))
+				throw Exception("HdlProgram::getVar - Unknown variable type or type mismatch for \"" + getGLEnumNameSafe(data.getGLType()) + "\" when reading uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
+
+			readBlockUniform(*info, data.getPtr());
+			return ;
+		}
+
 		switch(data.getGLType())
 		{
 			case GL_BYTE :			throw Exception("HdlProgram::getVar - Byte type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
@@ -708,7 +1579,7 @@ using namespace Glip::CoreGL;
 			case GL_FLOAT : 		
 			case GL_FLOAT_VEC2 : 		
 			case GL_FLOAT_VEC3 : 		
-			case GL_FLOAT_VEC4 : 		glGetUniformfv(program, loc, reinterpret_cast<GLfloat*>(data.getPtr()));	break;
+			case GL_FLOAT_VEC4 : 		glGetUniformfv(program, info->location, reinterpret_cast<GLfloat*>(data.getPtr()));	break;
 			#ifdef GLIP_USE_GL
 			case GL_DOUBLE :		throw Exception("HdlProgram::getVar - Double type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
 			case GL_DOUBLE_VEC2 :		throw Exception("HdlProgram::getVar - Double type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
@@ -718,24 +1589,43 @@ using namespace Glip::CoreGL;
 			case GL_INT :			
 			case GL_INT_VEC2 :		
 			case GL_INT_VEC3 :		
-			case GL_INT_VEC4 :		glGetUniformiv(program, loc, reinterpret_cast<GLint*>(data.getPtr()));		break;
+			case GL_INT_VEC4 :		glGetUniformiv(program, info->location, reinterpret_cast<GLint*>(data.getPtr()));		break;
 			case GL_UNSIGNED_INT :		
 			case GL_UNSIGNED_INT_VEC2 :	
 			case GL_UNSIGNED_INT_VEC3 :	
-			case GL_UNSIGNED_INT_VEC4 :	glGetUniformuiv(program, loc, reinterpret_cast<GLuint*>(data.getPtr()));	break;
+			case GL_UNSIGNED_INT_VEC4 :	glGetUniformuiv(program, info->location, reinterpret_cast<GLuint*>(data.getPtr()));	break;
 			case GL_BOOL :			throw Exception("HdlProgram::getVar - Bool type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
 			case GL_BOOL_VEC2 :		throw Exception("HdlProgram::getVar - Bool type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
 			case GL_BOOL_VEC3 :		throw Exception("HdlProgram::getVar - Bool type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
 			case GL_BOOL_VEC4 :		throw Exception("HdlProgram::getVar - Bool type not supported when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
 			case GL_FLOAT_MAT2 :		
 			case GL_FLOAT_MAT3 :		
-			case GL_FLOAT_MAT4 :		glGetUniformfv(program, loc, reinterpret_cast<GLfloat*>(data.getPtr()));	break;
+			case GL_FLOAT_MAT4 :		glGetUniformfv(program, info->location, reinterpret_cast<GLfloat*>(data.getPtr()));	break;
 			default :			throw Exception("HdlProgram::getVar - Unknown variable type or type mismatch for \"" + getGLEnumNameSafe(data.getGLType()) + "\" when modifying uniform variable \"" + varName + "\".", __FILE__, __LINE__, Exception::GLException);
 		}
 
-		const GLenum err = glGetError();
-		if(err!=GL_NO_ERROR)
-			throw Exception("HdlProgram::getVar - An error occurred when reading variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		if(errorChecking)
+		{
+			const GLenum err = glGetError();
+			if(err!=GL_NO_ERROR)
+				throw Exception("HdlProgram::getVar - An error occurred when reading variable \"" + varName + "\" : " + getGLEnumNameSafe(err) + " - " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		}
+	}
+
+	/**
+	\fn    HdlProgram::Uniform HdlProgram::getUniform(const std::string& varName)
+	\brief Get a handle on a uniform variable, for repeated writes (see HdlProgram::Uniform).
+	\param varName The name of the uniform variable.
+	\return The handle on the variable. Raise an exception if the variable does not exist.
+	**/
+	HdlProgram::Uniform HdlProgram::getUniform(const std::string& varName)
+	{
+		const UniformInfo* info = findUniform(varName);
+
+		if(info==NULL || (info->location==-1 && info->block<0))
+			throw Exception("HdlProgram::getUniform - Wrong location, does this var exist : \"" + varName + "\"? Is it used in the program? (May be the GLCompiler swapped it because it is unused).", __FILE__, __LINE__, Exception::GLException);
+
+		return Uniform(*this, varName, *info);
 	}
 
 	/**
@@ -746,12 +1636,296 @@ using namespace Glip::CoreGL;
 	**/
 	bool HdlProgram::isUniformVariableValid(const std::string& varName)
 	{
-		if(program==0)
-			return false;
-		else
-			return glGetUniformLocation(program, varName.c_str()) != -1;
+		const UniformInfo* info = findUniform(varName);
+		return (program!=0) && (info!=NULL) && (info->location!=-1 || info->block>=0);
 	}	
 
+	/**
+	\fn    int HdlProgram::copyVars(HdlProgram& source)
+	\brief Copy the current values of the uniform variables of another program, for instance a program rebuilt from modified sources. The variables which do not exist in this program, or with a different type, are ignored. For the arrays, the elements existing in both programs are copied.
+
+	The buffers of the uniform blocks which are visible to other programs (set with HdlProgram::setUniformBlockBuffer or obtained with HdlProgram::getUniformBlockBuffer) are also carried over to this program, which takes the ownership of the buffers owned by the source. An exception is raised if this program does not have a matching block.
+	\param source The program to read the values from.
+	\return The number of variables copied.
+	**/
+	int HdlProgram::copyVars(HdlProgram& source)
+	{
+		HdlProgram* root = (master!=NULL) ? master : this;
+		HdlProgram* sourceRoot = (source.master!=NULL) ? source.master : &source;
+
+		// Carry over the buffers first, the values below are then written to them :
+		for(std::vector<UniformBlock>::iterator it=sourceRoot->uniformBlocks.begin(); it!=sourceRoot->uniformBlocks.end(); it++)
+		{
+			if(it->buffer==NULL || it->deferred)
+				continue;
+
+			UniformBlock& b = root->findUniformBlock(it->name, "HdlProgram::copyVars");
+
+			if(!it->ownBuffer)
+				root->setUniformBlockBuffer(it->name, *it->buffer);
+			else if(b.buffer!=it->buffer)
+			{
+				if(it->buffer->getSize()<b.size)
+					throw Exception("HdlProgram::copyVars - The buffer of the uniform block \"" + it->name + "\" (" + toString(it->buffer->getSize()) + " bytes) is smaller than the block of this program (" + toString(b.size) + " bytes).", __FILE__, __LINE__, Exception::GLException);
+
+				root->detachBlockBuffer(b);
+				if(b.ownBuffer)
+					delete b.buffer;
+
+				b.buffer	= it->buffer;
+				b.ownBuffer	= true;
+				b.deferred	= false;
+				b.modified	= false;
+				root->attachBlockBuffer(b);
+
+				// The source does not own the buffer anymore :
+				sourceRoot->detachBlockBuffer(*it);
+				it->buffer	= NULL;
+				it->ownBuffer	= false;
+
+				root->notifyModification();
+			}
+		}
+
+		const std::vector<std::string>& names = source.getUniformsNames();
+		const std::vector<GLenum>& types = source.getUniformsTypes();
+		int numCopied = 0;
+
+		for(unsigned int k=0; k<names.size(); k++)
+		{
+			// The arrays are listed with their first element :
+			std::string name = names[k];
+			if(name.size()>3 && name.compare(name.size()-3, 3, "[0]")==0)
+				name = name.substr(0, name.size()-3);
+
+			const UniformInfo	*info = findUniform(name),
+						*sourceInfo = source.findUniform(name);
+
+			if(info==NULL || sourceInfo==NULL || info->type!=types[k])
+				continue;
+
+			const int numElements = std::min(info->size, sourceInfo->size);
+			bool copied = false;
+
+			for(int l=0; l<numElements; l++)
+			{
+				const std::string	elementName = (info->size>1) ? (name + "[" + toString(l) + "]") : name,
+							sourceElementName = (sourceInfo->size>1) ? (name + "[" + toString(l) + "]") : name;
+				const UniformInfo* element = findUniform(elementName);
+
+				if(element==NULL || (element->location==-1 && element->block<0))
+					continue;
+
+				GLuint words[16];
+				switch(getTypeCategory(types[k]))
+				{
+					case 'f' :	source.getVar(sourceElementName, reinterpret_cast<float*>(words));		break;
+					case 'u' :	source.getVar(sourceElementName, reinterpret_cast<unsigned int*>(words));	break;
+					case 'i' :	source.getVar(sourceElementName, reinterpret_cast<int*>(words));		break;
+					default :	continue; // Doubles are not supported.
+				}
+
+				writeUniform(elementName, *element, types[k], words);
+				copied = true;
+			}
+
+			if(copied)
+				numCopied++;
+		}
+
+		return numCopied;
+	}
+
+	/**
+	\fn    int HdlProgram::getUniformOffset(const std::string& varName)
+	\brief Get the offset of a member of a uniform block, in order to fill a buffer shared by several programs (see HdlProgram::setUniformBlockBuffer).
+	\param varName The name of the member (as listed by HdlProgram::getUniformsNames).
+	\return The offset of the member in the block, in bytes, or -1 if the variable is not a member of a block.
+	**/
+	int HdlProgram::getUniformOffset(const std::string& varName)
+	{
+		const UniformInfo* info = findUniform(varName);
+		return (info!=NULL && info->block>=0) ? info->offset : -1;
+	}
+
+	/**
+	\fn    const std::vector<std::string>& HdlProgram::getUniformBlocksNames(void) const
+	\brief Get the names of the active uniform blocks. Their members are listed with the other uniform variables (see HdlProgram::getUniformsNames).
+	\return A vector of standard string.
+	**/
+	const std::vector<std::string>& HdlProgram::getUniformBlocksNames(void) const
+	{
+		return ((master!=NULL) ? master : this)->uniformBlocksNames;
+	}
+
+	/**
+	\fn    int HdlProgram::getUniformBlockSize(const std::string& blockName)
+	\brief Get the size of a uniform block.
+	\param blockName The name of the block.
+	\return The minimum size of the buffer backing the block, in bytes.
+	**/
+	int HdlProgram::getUniformBlockSize(const std::string& blockName)
+	{
+		return findUniformBlock(blockName, "HdlProgram::getUniformBlockSize").size;
+	}
+
+	/**
+	\fn    HdlGeBO& HdlProgram::getUniformBlockBuffer(const std::string& blockName)
+	\brief Get the buffer backing a uniform block.
+	\param blockName The name of the block.
+	\return The buffer currently used for this block. It is created if needed and, in this case, it is owned by this object (it can be shared with other programs as long as this object exists, see HdlProgram::setUniformBlockBuffer).
+	**/
+	HdlGeBO& HdlProgram::getUniformBlockBuffer(const std::string& blockName)
+	{
+		UniformBlock& b = findUniformBlock(blockName, "HdlProgram::getUniformBlockBuffer");
+
+		if(b.buffer==NULL)
+		{
+			b.buffer	= new HdlGeBO(b.size, GL_UNIFORM_BUFFER, GL_DYNAMIC_DRAW);
+			b.ownBuffer	= true;
+			b.modified	= true;
+		}
+
+		if(b.modified)
+		{
+			b.buffer->subWrite(&b.data[0], b.size, 0);
+			b.modified = false;
+		}
+
+		// The buffer might be read by other programs, the writes are not deferred anymore :
+		b.deferred = false;
+
+		if(b.store==NULL)
+			attachBlockBuffer(b);
+
+		return *b.buffer;
+	}
+
+	/**
+	\fn    void HdlProgram::setUniformBlockBuffer(const std::string& blockName, HdlGeBO& buffer)
+	\brief Use a buffer for a uniform block, for instance a buffer shared by several programs. The content of the buffer is not modified.
+	\param blockName The name of the block.
+	\param buffer The buffer, it must be at least as large as the block (see HdlProgram::getUniformBlockSize) and it must outlive this object (or be replaced before).
+
+	In order to share the same layout between several programs, the block should be declared with the std140 layout qualifier. After this call, writing to a member of the block (HdlProgram::setVar) only writes this member to the buffer. All the programs using the same buffer share the values of the block : HdlProgram::getVar returns the last values written through any of them (or with HdlProgram::writeUniformBlockBuffer), and a write marks all of them as modified.
+	**/
+	void HdlProgram::setUniformBlockBuffer(const std::string& blockName, HdlGeBO& buffer)
+	{
+		UniformBlock& b = findUniformBlock(blockName, "HdlProgram::setUniformBlockBuffer");
+
+		if(buffer.getSize()<b.size)
+			throw Exception("HdlProgram::setUniformBlockBuffer - The buffer (" + toString(buffer.getSize()) + " bytes) is smaller than the uniform block \"" + blockName + "\" (" + toString(b.size) + " bytes).", __FILE__, __LINE__, Exception::GLException);
+
+		if(b.buffer==&buffer)
+			return ;
+
+		detachBlockBuffer(b);
+
+		if(b.ownBuffer)
+			delete b.buffer;
+
+		b.buffer	= &buffer;
+		b.ownBuffer	= false;
+		b.deferred	= false;
+		b.modified	= false;
+
+		attachBlockBuffer(b);
+		notifyModification();
+	}
+
+	/**
+	\fn    void HdlProgram::setUniformBlockData(const std::string& blockName, const void* data)
+	\brief Write all the members of a uniform block with a single call (glBufferSubData).
+	\param blockName The name of the block.
+	\param data Pointer to the data of the block, following its layout (see HdlProgram::getUniformBlockSize and HdlProgram::getUniformOffset).
+	**/
+	void HdlProgram::setUniformBlockData(const std::string& blockName, const void* data)
+	{
+		UniformBlock& b = findUniformBlock(blockName, "HdlProgram::setUniformBlockData");
+
+		std::memcpy(&getBlockData(b)[0], data, b.size);
+		uploadBlockData(b, 0, b.size);
+
+		notifyModification();
+	}
+
+	/**
+	\fn    void HdlProgram::writeUniformBlockBuffer(HdlGeBO& buffer, const void* data, int size, int offset)
+	\brief Write to a buffer backing uniform blocks (see HdlProgram::setUniformBlockBuffer) and mark all the programs using it as modified.
+	\param buffer The buffer.
+	\param data Pointer to the data, following the layout of the blocks (see HdlProgram::getUniformOffset).
+	\param size Size of the data, in bytes.
+	\param offset Offset of the data in the buffer, in bytes.
+	**/
+	void HdlProgram::writeUniformBlockBuffer(HdlGeBO& buffer, const void* data, int size, int offset)
+	{
+		if(offset<0 || size<0 || offset+size>buffer.getSize())
+			throw Exception("HdlProgram::writeUniformBlockBuffer - The range [" + toString(offset) + ", " + toString(offset+size) + "[ is outside of the buffer (" + toString(buffer.getSize()) + " bytes).", __FILE__, __LINE__, Exception::GLException);
+
+		buffer.subWrite(data, size, offset);
+
+		std::map<const HdlGeBO*, SharedBlock*>::iterator it = sharedBlocks.find(&buffer);
+		if(it!=sharedBlocks.end())
+		{
+			SharedBlock* s = it->second;
+
+			if(static_cast<int>(s->data.size())<offset+size)
+				s->data.resize(offset+size, 0);
+			std::memcpy(&s->data[offset], data, size);
+
+			for(std::vector<HdlProgram*>::iterator itProgram=s->programs.begin(); itProgram!=s->programs.end(); itProgram++)
+				(*itProgram)->notifyModification();
+		}
+	}
+
+	/**
+	\fn    bool HdlProgram::isView(void) const
+	\brief Check if this object is a view on the uniform variables of another program.
+	\return True if this object is a view.
+	**/
+	bool HdlProgram::isView(void) const
+	{
+		return master!=NULL;
+	}
+
+	/**
+	\fn    const std::string& HdlProgram::getUniformsPrefix(void) const
+	\brief Get the prefix added to the names of the uniform variables (empty if this object is not a view).
+	\return A standard string.
+	**/
+	const std::string& HdlProgram::getUniformsPrefix(void) const
+	{
+		return uniformsPrefix;
+	}
+
+	/**
+	\fn    bool HdlProgram::isShared(void) const
+	\brief Check if this object uses a shared program (see HdlProgram::HdlProgram(const std::map<GLenum, const ShaderSource*>&, const std::vector<std::string>&)).
+	\return True if the compiled program is shared.
+	**/
+	bool HdlProgram::isShared(void) const
+	{
+		return (master!=NULL) ? master->isShared() : (shared!=NULL);
+	}
+
+	/**
+	\fn    unsigned int HdlProgram::getModificationCount(void) const
+	\brief Get the number of modifications of the program (links and uniform variables changes through HdlProgram::setVar), which can be used to detect changes.
+	\return The number of modifications (might wrap around).
+	**/
+	unsigned int HdlProgram::getModificationCount(void) const
+	{
+		return modificationCount;
+	}
+
+	void HdlProgram::notifyModification(void)
+	{
+		modificationCount++;
+
+		if(master!=NULL)
+			master->notifyModification();
+	}
+
 // Static tools :
 	/**
 	\fn    int HdlProgram::maxVaryingVar(void)
@@ -781,6 +1955,271 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlProgram::stopProgram(void)
 	{
-		glUseProgram(0);
+		HandleOpenGL::useProgram(0);
+	}
+
+	/**
+	\fn    int HdlProgram::getNumSharedPrograms(void)
+	\brief Get the number of compiled programs currently shared.
+	\return The number of programs in the cache.
+	**/
+	int HdlProgram::getNumSharedPrograms(void)
+	{
+		return sharedPrograms.size();
+	}
+
+	/**
+	\fn    void HdlProgram::enableErrorChecking(void)
+	\brief Check the OpenGL errors after each access to a uniform variable (HdlProgram::setVar, HdlProgram::getVar). Disabled by default, as glGetError can synchronize with the driver.
+	**/
+	void HdlProgram::enableErrorChecking(void)
+	{
+		errorChecking = true;
+	}
+
+	/**
+	\fn    void HdlProgram::disableErrorChecking(void)
+	\brief Stop checking the OpenGL errors after each access to a uniform variable (default).
+	**/
+	void HdlProgram::disableErrorChecking(void)
+	{
+		errorChecking = false;
+	}
+
+	/**
+	\fn    bool HdlProgram::isErrorCheckingEnabled(void)
+	\brief Check if the OpenGL errors are checked after each access to a uniform variable.
+	\return True if the errors are checked.
+	**/
+	bool HdlProgram::isErrorCheckingEnabled(void)
+	{
+		return errorChecking;
+	}
+
+	/**
+	\fn    void HdlProgram::setBinaryCacheDirectory(const std::string& directory)
+	\brief Set the directory where the linked programs are stored (see glGetProgramBinary), to be reloaded by the next runs instead of compiling the shaders.
+
+	The binaries are identified by the sources, the fragment locations and the vendor, renderer and version of the driver. If the driver rejects a binary, the shaders are compiled. Only the programs built from sources are cached (see HdlProgram::HdlProgram(const std::map<GLenum, const ShaderSource*>&, const std::vector<std::string>&)). The directory must exist.
+	\param directory The cache directory, the cache is disabled if empty (default).
+	**/
+	void HdlProgram::setBinaryCacheDirectory(const std::string& directory)
+	{
+		binaryCacheDirectory = directory;
+	}
+
+	/**
+	\fn    const std::string& HdlProgram::getBinaryCacheDirectory(void)
+	\brief Get the directory of the binary cache.
+	\return The directory, empty if the cache is disabled.
+	**/
+	const std::string& HdlProgram::getBinaryCacheDirectory(void)
+	{
+		return binaryCacheDirectory;
+	}
+
+	/**
+	\fn    int HdlProgram::getNumBinaryCacheHits(void)
+	\brief Get the number of programs loaded from the binary cache.
+	\return The number of programs loaded.
+	**/
+	int HdlProgram::getNumBinaryCacheHits(void)
+	{
+		return binaryCacheHits;
+	}
+
+	/**
+	\fn    int HdlProgram::getNumBinaryCacheMisses(void)
+	\brief Get the number of programs compiled while the binary cache was enabled (missing or rejected binaries).
+	\return The number of programs compiled.
+	**/
+	int HdlProgram::getNumBinaryCacheMisses(void)
+	{
+		return binaryCacheMisses;
+	}
+
+	/**
+	\fn    void HdlProgram::resetBinaryCacheCounters(void)
+	\brief Reset the counters of hits and misses of the binary cache.
+	**/
+	void HdlProgram::resetBinaryCacheCounters(void)
+	{
+		binaryCacheHits		= 0;
+		binaryCacheMisses	= 0;
+	}
+
+// HdlProgram::Uniform :
+	HdlProgram::Uniform::Uniform(HdlProgram& _prgm, const std::string& _name, const UniformInfo& _info)
+	 :	prgm(&_prgm),
+		name(_name),
+		info(_info),
+		linkCount(((_prgm.master!=NULL) ? _prgm.master : &_prgm)->linkCount)
+	{ }
+
+	/**
+	\fn HdlProgram::Uniform::Uniform(void)
+	\brief Uniform constructor, the handle is invalid until assigned from HdlProgram::getUniform.
+	**/
+	HdlProgram::Uniform::Uniform(void)
+	 :	prgm(NULL),
+		linkCount(0)
+	{
+		info.location	= -1;
+		info.type	= GL_NONE;
+		info.size	= 0;
+		info.block	= -1;
+	}
+
+	void HdlProgram::Uniform::resolve(void)
+	{
+		if(prgm==NULL)
+			throw Exception("HdlProgram::Uniform::set - Invalid handle.", __FILE__, __LINE__, Exception::GLException);
+
+		// Look up the variable again only if the program was linked since the last write :
+		const HdlProgram* root = (prgm->master!=NULL) ? prgm->master : prgm;
+		if(linkCount==root->linkCount)
+			return ;
+
+		const UniformInfo* current = prgm->findUniform(name);
+		if(current==NULL || (current->location==-1 && current->block<0))
+			throw Exception("HdlProgram::Uniform::set - The variable \"" + name + "\" does not exist anymore in the program (linked again).", __FILE__, __LINE__, Exception::GLException);
+
+		info		= *current;
+		linkCount	= root->linkCount;
+	}
+
+	void HdlProgram::Uniform::write(char category, const void* values, int numValues)
+	{
+		resolve();
+
+		// The samplers are written as integers :
+		const GLenum t = (getNumWords(info.type)==0 && getTypeCategory(info.type)=='i') ? GL_INT : info.type;
+
+		if(getTypeCategory(t)!=category || getNumWords(t)==0 || getNumWords(t)>numValues)
+			throw Exception("HdlProgram::Uniform::set - Type mismatch for \"" + getGLEnumNameSafe(info.type) + "\" when modifying uniform variable \"" + name + "\".", __FILE__, __LINE__, Exception::GLException);
+
+		prgm->writeUniform(name, info, t, values);
+	}
+
+	/**
+	\fn bool HdlProgram::Uniform::isValid(void) const
+	\brief Check if the handle is valid.
+	\return True if the handle was obtained from HdlProgram::getUniform.
+	**/
+	bool HdlProgram::Uniform::isValid(void) const
+	{
+		return prgm!=NULL;
+	}
+
+	/**
+	\fn const std::string& HdlProgram::Uniform::getName(void) const
+	\brief Get the name of the variable.
+	\return The name of the variable.
+	**/
+	const std::string& HdlProgram::Uniform::getName(void) const
+	{
+		return name;
+	}
+
+	/**
+	\fn GLenum HdlProgram::Uniform::getType(void) const
+	\brief Get the type of the variable (see glGetActiveUniform).
+	\return The GL type of the variable.
+	**/
+	GLenum HdlProgram::Uniform::getType(void) const
+	{
+		return info.type;
+	}
+
+	/**
+	\fn int HdlProgram::Uniform::getSize(void) const
+	\brief Get the number of elements of the variable (greater than 1 for arrays).
+	\return The number of elements.
+	**/
+	int HdlProgram::Uniform::getSize(void) const
+	{
+		return info.size;
+	}
+
+	/**
+	\fn void HdlProgram::Uniform::set(int v0, int v1, int v2, int v3)
+	\brief Change the variable (integers, booleans or samplers).
+	\param v0 Corresponding value to assign.
+	\param v1 Corresponding value to assign.
+	\param v2 Corresponding value to assign.
+	\param v3 Corresponding value to assign.
+	**/
+	void HdlProgram::Uniform::set(int v0, int v1, int v2, int v3)
+	{
+		const GLint values[4] = {v0, v1, v2, v3};
+		write('i', values, 4);
+	}
+
+	/**
+	\fn void HdlProgram::Uniform::set(unsigned int v0, unsigned int v1, unsigned int v2, unsigned int v3)
+	\brief Change the variable (unsigned integers).
+	\param v0 Corresponding value to assign.
+	\param v1 Corresponding value to assign.
+	\param v2 Corresponding value to assign.
+	\param v3 Corresponding value to assign.
+	**/
+	void HdlProgram::Uniform::set(unsigned int v0, unsigned int v1, unsigned int v2, unsigned int v3)
+	{
+		const GLuint values[4] = {v0, v1, v2, v3};
+		write('u', values, 4);
+	}
+
+	/**
+	\fn void HdlProgram::Uniform::set(float v0, float v1, float v2, float v3)
+	\brief Change the variable (floats, except matrices).
+	\param v0 Corresponding value to assign.
+	\param v1 Corresponding value to assign.
+	\param v2 Corresponding value to assign.
+	\param v3 Corresponding value to assign.
+	**/
+	void HdlProgram::Uniform::set(float v0, float v1, float v2, float v3)
+	{
+		const GLfloat values[4] = {v0, v1, v2, v3};
+		write('f', values, 4);
+	}
+
+	/**
+	\fn void HdlProgram::Uniform::set(const int* v)
+	\brief Change the variable (integers, booleans or samplers).
+	\param v Pointer to the values to assign.
+	**/
+	void HdlProgram::Uniform::set(const int* v)
+	{
+		write('i', v, 16);
+	}
+
+	/**
+	\fn void HdlProgram::Uniform::set(const unsigned int* v)
+	\brief Change the variable (unsigned integers).
+	\param v Pointer to the values to assign.
+	**/
+	void HdlProgram::Uniform::set(const unsigned int* v)
+	{
+		write('u', v, 16);
+	}
+
+	/**
+	\fn void HdlProgram::Uniform::set(const float* v)
+	\brief Change the variable (floats, including matrices).
+	\param v Pointer to the values to assign.
+	**/
+	void HdlProgram::Uniform::set(const float* v)
+	{
+		write('f', v, 16);
 	}
 
+	/**
+	\fn void HdlProgram::Uniform::set(const HdlDynamicData& data)
+	\brief Change the variable.
+	\param data The dynamic object to be used as source.
+	**/
+	void HdlProgram::Uniform::set(const HdlDynamicData& data)
+	{
+		resolve();
+		prgm->writeUniform(name, info, data);
+	}
@@ -22,7 +22,9 @@
 **/
 
 #include <cstring>
+#include <algorithm>
 #include "Core/HdlTexture.hpp"
+#include "Core/HdlGeBO.hpp"
 #include "Core/Exception.hpp"
 
 using namespace Glip::CoreGL;
@@ -54,7 +56,9 @@ using namespace Glip::CoreGL;
 		wraps(_wraps), 
 		wrapt(_wrapt),
 		baseLevel(_baseLevel),
-		maxLevel(_maxLevel)	
+		maxLevel(_maxLevel),
+		target(GL_TEXTURE_2D),
+		numLayers(1)
 	{ }
 
 	/**
@@ -74,7 +78,9 @@ using namespace Glip::CoreGL;
 		wraps(copy.wraps),
 		wrapt(copy.wrapt),
 		baseLevel(copy.baseLevel),
-		maxLevel(copy.maxLevel)
+		maxLevel(copy.maxLevel),
+		target(copy.target),
+		numLayers(copy.numLayers)
 	{ }
 
 	HdlAbstractTextureFormat::~HdlAbstractTextureFormat(void)
@@ -114,7 +120,7 @@ using namespace Glip::CoreGL;
 	\fn     int HdlAbstractTextureFormat::getRowSize(void) const
 	\return The row size in bytes.
 	\fn     size_t HdlAbstractTextureFormat::getSize(void) const
-	\return The texture's size in bytes.
+	\return The texture's size in bytes (all the layers, packed one after the other).
 	\fn     GLenum HdlAbstractTextureFormat::getGLMode(void) const
 	\return The texture's mode.
 	\fn     GLenum HdlAbstractTextureFormat::getGLDepth(void) const
@@ -131,6 +137,12 @@ using namespace Glip::CoreGL;
 	\return The texture's S wrapping parameter.
 	\fn     GLenum HdlAbstractTextureFormat::getTWrapping(void) const
 	\return The texture's T wrapping parameter.
+	\fn     GLenum HdlAbstractTextureFormat::getGLTarget(void) const
+	\return The texture's target (GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY or GL_TEXTURE_3D).
+	\fn     int HdlAbstractTextureFormat::getNumLayers(void) const
+	\return The texture's number of layers (or slices for GL_TEXTURE_3D), 1 for GL_TEXTURE_2D.
+	\fn     bool HdlAbstractTextureFormat::isLayered(void) const
+	\return True if the texture is an array or a 3D texture (it is then rendered in one pass over all its layers, see Filter).
 	\fn     bool HdlAbstractTextureFormat::isCompressed(void) const
 	\return True if the texture is compressed.
 	\fn     bool HdlAbstractTextureFormat::isFloatingPoint(void) const
@@ -145,7 +157,7 @@ using namespace Glip::CoreGL;
 	int	HdlAbstractTextureFormat::getAlignment		(void) const { return alignment; }
 	int	HdlAbstractTextureFormat::getPixelSize		(void) const { return getFormatDescriptor().getPixelSize(getGLDepth());}
 	size_t	HdlAbstractTextureFormat::getRowSize		(void) const { return static_cast<size_t>(getWidth()*getPixelSize() + (alignment-1)) & ~static_cast<size_t>(alignment-1); }
-	size_t	HdlAbstractTextureFormat::getSize     		(void) const { return static_cast<size_t>(getHeight()) * getRowSize(); }
+	size_t	HdlAbstractTextureFormat::getSize     		(void) const { return static_cast<size_t>(getHeight()) * getRowSize() * static_cast<size_t>(numLayers); }
 	GLenum	HdlAbstractTextureFormat::getGLMode   		(void) const { return mode; }
 	GLenum	HdlAbstractTextureFormat::getGLDepth  		(void) const { return depth; }
 	GLenum	HdlAbstractTextureFormat::getMinFilter		(void) const { return minFilter; }
@@ -154,13 +166,16 @@ using namespace Glip::CoreGL;
 	int	HdlAbstractTextureFormat::getMaxLevel 		(void) const { return maxLevel; }
 	GLenum	HdlAbstractTextureFormat::getSWrapping		(void) const { return wraps; }
 	GLenum	HdlAbstractTextureFormat::getTWrapping		(void) const { return wrapt; }
+	GLenum	HdlAbstractTextureFormat::getGLTarget		(void) const { return target; }
+	int	HdlAbstractTextureFormat::getNumLayers		(void) const { return numLayers; }
+	bool	HdlAbstractTextureFormat::isLayered		(void) const { return target!=GL_TEXTURE_2D; }
 	bool	HdlAbstractTextureFormat::isCompressed		(void) const { return getFormatDescriptor().isCompressed; }
 	bool	HdlAbstractTextureFormat::isFloatingPoint	(void) const
 	{
 		#ifdef GLIP_USE_GL
-			return getFormatDescriptor().isFloatingPoint || depth==GL_FLOAT || depth==GL_DOUBLE;
+			return getFormatDescriptor().isFloatingPoint || depth==GL_HALF_FLOAT || depth==GL_FLOAT || depth==GL_DOUBLE;
 		#else
-			return getFormatDescriptor().isFloatingPoint || depth==GL_FLOAT;
+			return getFormatDescriptor().isFloatingPoint || depth==GL_HALF_FLOAT || depth==GL_FLOAT;
 		#endif
 	}
 
@@ -202,7 +217,9 @@ using namespace Glip::CoreGL;
 			(baseLevel		== f.baseLevel)		&&
 			(maxLevel		== f.maxLevel)		&&
 			(wraps			== f.wraps)		&&
-			(wrapt			== f.wrapt);
+			(wrapt			== f.wrapt)		&&
+			(target			== f.target)		&&
+			(numLayers		== f.numLayers);
 	}
 
 	/**
@@ -231,7 +248,9 @@ using namespace Glip::CoreGL;
 			(mode			== f.mode)		&&
 			(depth			== f.depth)		&&
 			(baseLevel		== f.baseLevel)		&&
-			(maxLevel		== f.maxLevel);
+			(maxLevel		== f.maxLevel)		&&
+			(target			== f.target)		&&
+			(numLayers		== f.numLayers);
 	}
 
 	/**
@@ -438,6 +457,20 @@ using namespace Glip::CoreGL;
 	\fn    void HdlTextureFormat::setTWrapping(GLenum m)
 	\brief Sets the texture's T wrapping parameter.
 	\param m The new T wrapping parameter (e.g. GL_CLAMP, GL_CLAMP_TO_BORDER, GL_CLAMP_TO_EDGE, GL_REPEAT, GL_MIRRORED_REPEAT)
+	\fn    void HdlTextureFormat::setGLTarget(GLenum t)
+	\brief Sets the texture's target.
+	\param t The new target (GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY or GL_TEXTURE_3D). A GL_TEXTURE_2D format must have a single layer.
+	\fn    void HdlTextureFormat::setNumLayers(int n)
+	\brief Sets the texture's number of layers (or slices for GL_TEXTURE_3D).
+	\param n The new number of layers (must be greater than 0).
+	\fn    void HdlTextureFormat::setLayers(GLenum t, int n)
+	\brief Sets the texture's target and number of layers. For instance, a batch of 8 frames :
+	\code
+		HdlTextureFormat fmt(640, 480, GL_RGB8, GL_UNSIGNED_BYTE);
+		fmt.setLayers(GL_TEXTURE_2D_ARRAY, 8);
+	\endcode
+	\param t The new target (GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY or GL_TEXTURE_3D).
+	\param n The new number of layers (must be greater than 0).
 	**/
 	void HdlTextureFormat::setWidth    (int w)		{ width		= w;  }
 	void HdlTextureFormat::setHeight   (int h)		{ height	= h;  }
@@ -451,6 +484,10 @@ using namespace Glip::CoreGL;
 	void HdlTextureFormat::setMaxLevel (int l)		{ maxLevel	= l;  }
 	void HdlTextureFormat::setSWrapping(GLenum m)		{ wraps		= m;  }
 	void HdlTextureFormat::setTWrapping(GLenum m)		{ wrapt		= m;  }
+	void HdlTextureFormat::setGLTarget (GLenum t)		{ target	= t;  }
+	void HdlTextureFormat::setNumLayers(int n)		{ numLayers	= n;  }
+	void HdlTextureFormat::setLayers   (GLenum t, int n)	{ target	= t;
+								  numLayers	= n;  }
 
 	/**
 	\fn const HdlAbstractTextureFormat& HdlTextureFormat::operator=(const HdlAbstractTextureFormat& copy)
@@ -470,6 +507,8 @@ using namespace Glip::CoreGL;
 		maxLevel  = copy.getMaxLevel();
 		wraps     = copy.getSWrapping();
 		wrapt     = copy.getTWrapping();
+		target    = copy.getGLTarget();
+		numLayers = copy.getNumLayers();
 
 		return *this;
 	}
@@ -550,7 +589,7 @@ using namespace Glip::CoreGL;
 				vSWrap		= GL_NONE, 
 				vTWrap		= GL_NONE;
 				 
-			glBindTexture(GL_TEXTURE_2D, texID);
+			HandleOpenGL::bindTexture(texID);
 			
 			// Test :
 			const GLenum err = glGetError();
@@ -592,7 +631,9 @@ using namespace Glip::CoreGL;
 	HdlTexture::HdlTexture(const HdlAbstractTextureFormat& fmt)
 	 : 	HdlAbstractTextureFormat(fmt), 
 		texID(0), 
-		proxy(false)
+		proxy(false),
+		immutable(false),
+		modificationCount(0)
 	{
 		if(!fmt.getFormatDescriptor().isSupported)
 			throw Exception("HdlTexture::HdlTexture - Format " + getGLEnumNameSafe(fmt.getGLMode()) + " is not supported.", __FILE__, __LINE__);
@@ -601,23 +642,39 @@ using namespace Glip::CoreGL;
 
 		// Testing hardware :
 		#ifdef GLIP_USE_GL
-		NEED_EXTENSION(GLEW_ARB_multitexture)
-		NEED_EXTENSION(GLEW_ARB_texture_border_clamp)
-		NEED_EXTENSION(GLEW_ARB_texture_non_power_of_two)
-		NEED_EXTENSION(GLEW_ARB_texture_rectangle)
+		// (The extensions are part of the core profile, where they are not listed anymore)
+		NEED_EXTENSION((GLEW_VERSION_1_3 || GLEW_ARB_multitexture))
+		NEED_EXTENSION((GLEW_VERSION_1_3 || GLEW_ARB_texture_border_clamp))
+		NEED_EXTENSION((GLEW_VERSION_2_0 || GLEW_ARB_texture_non_power_of_two))
+		NEED_EXTENSION((GLEW_VERSION_3_1 || GLEW_ARB_texture_rectangle))
 
 		if(isFloatingPoint())
-			NEED_EXTENSION(GLEW_ARB_texture_float)
+			NEED_EXTENSION((GLEW_VERSION_3_0 || GLEW_ARB_texture_float))
+
+		if(getGLDepth()==GL_HALF_FLOAT)
+			NEED_EXTENSION((GLEW_VERSION_3_0 || GLEW_ARB_half_float_pixel))
 
 		if(isCompressed())
-			NEED_EXTENSION(GLEW_ARB_texture_compression);
+			NEED_EXTENSION((GLEW_VERSION_1_3 || GLEW_ARB_texture_compression));
 		#endif
 
 		// Test :
 		if(getBaseLevel()>getMaxLevel())
 			throw Exception("HdlTexture::HdlTexture - Texture can't be created : Base mipmap level (" + toString(getBaseLevel()) + ") is greater than maximum mipmap level (" + toString(getMaxLevel()) + ").", __FILE__, __LINE__, Exception::GLException);
+		if(target!=GL_TEXTURE_2D && target!=GL_TEXTURE_2D_ARRAY && target!=GL_TEXTURE_3D)
+			throw Exception("HdlTexture::HdlTexture - Texture can't be created : Target " + getGLEnumNameSafe(target) + " is not supported (use GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY or GL_TEXTURE_3D).", __FILE__, __LINE__, Exception::GLException);
+		if(numLayers<1 || (target==GL_TEXTURE_2D && numLayers!=1))
+			throw Exception("HdlTexture::HdlTexture - Texture can't be created : Invalid number of layers (" + toString(numLayers) + ") for target " + getGLEnumNameSafe(target) + ".", __FILE__, __LINE__, Exception::GLException);
+		if(isLayered() && isCompressed())
+			throw Exception("HdlTexture::HdlTexture - Texture can't be created : Compressed textures cannot be layered.", __FILE__, __LINE__, Exception::GLException);
 
-		glEnable(GL_TEXTURE_2D);
+		#ifdef GLIP_USE_GL
+		if(target==GL_TEXTURE_2D_ARRAY)
+			NEED_EXTENSION((GLEW_VERSION_3_0 || GLEW_EXT_texture_array))
+
+		if(!HandleOpenGL::isCoreProfile() && !isLayered())
+			glEnable(GL_TEXTURE_2D);
+		#endif
 
 		// Create the texture :
 		glGenTextures(1, &texID);
@@ -634,19 +691,24 @@ using namespace Glip::CoreGL;
 		}
 
 		// Set it up :
-		glBindTexture(GL_TEXTURE_2D,texID);
+		HandleOpenGL::bindTextureTarget(target, texID);
+
+		glTexParameteri(target, GL_TEXTURE_MIN_FILTER, getMinFilter() );
+		glTexParameteri(target, GL_TEXTURE_MAG_FILTER, getMagFilter() );
+		glTexParameteri(target, GL_TEXTURE_WRAP_S,     getSWrapping() );
+		glTexParameteri(target, GL_TEXTURE_WRAP_T,     getTWrapping() );
+		glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, getBaseLevel() );
+		glTexParameteri(target, GL_TEXTURE_MAX_LEVEL,  getMaxLevel()  );
 
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, getMinFilter() );
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, getMagFilter() );
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,     getSWrapping() );
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,     getTWrapping() );
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, getBaseLevel() );
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL,  getMaxLevel()  );
+		if(target==GL_TEXTURE_3D)
+			glTexParameteri(target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
 
 		if( getMaxLevel()>0 )
 		{
 			#ifdef GLIP_USE_GL
-				glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
+				// (The mipmaps are generated by the writes in the core profile)
+				if(!HandleOpenGL::isCoreProfile())
+					glTexParameteri(target, GL_GENERATE_MIPMAP, GL_TRUE);
 			#else
 				throw Exception("HdlTexture::HdlTexture - Cannot generate mipmaps automatically on OpenGL ES.", __FILE__, __LINE__, Exception::GLException);
 			#endif
@@ -656,7 +718,38 @@ using namespace Glip::CoreGL;
 		if(err!=GL_NO_ERROR)
 			throw Exception("HdlTexture::HdlTexture - One or more texture parameter cannot be set among : MinFilter = " + getGLEnumNameSafe(getMinFilter()) + ", MagFilter = " + getGLEnumNameSafe(getMagFilter()) + ", SWrapping = " + getGLEnumNameSafe(getSWrapping()) + ", TWrapping = " + getGLEnumNameSafe(getTWrapping()) + ", BaseLevel = " + toString(getBaseLevel()) + ", MaxLevel = " + toString(getMaxLevel()) + ". Last OpenGL error : " + getGLEnumNameSafe(err) + " : " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
 
-		HdlTexture::unbind();
+		// Allocate the storage once, the writes will only update its content (the compressed textures are allocated at each write) :
+		if(!isCompressed())
+		{
+			// Mipmap chain, up to the maximum level :
+			int numLevels = 1;
+			for(int s=std::max(std::max(width, height), (target==GL_TEXTURE_3D) ? numLayers : 1)/2; s>0 && numLevels<=getMaxLevel(); s/=2)
+				numLevels++;
+
+			#ifdef GLIP_USE_GL
+			if(getFormatDescriptor().channelsSizeInBits[0]>0 && (GLEW_VERSION_4_2 || GLEW_ARB_texture_storage))
+			{
+				if(isLayered())
+					glTexStorage3D(target, numLevels, mode, width, height, numLayers);
+				else
+					glTexStorage2D(target, numLevels, mode, width, height);
+
+				// Some sized formats might be refused (legacy formats) :
+				immutable = (glGetError()==GL_NO_ERROR);
+			}
+			#endif
+
+			if(!immutable && isLayered())
+				glTexImage3D(target, 0, mode, width, height, numLayers, 0, getFormatDescriptor().aliasMode, depth, NULL);
+			else if(!immutable)
+				glTexImage2D(target, 0, mode, width, height, 0, getFormatDescriptor().aliasMode, depth, NULL);
+
+			err = glGetError();
+			if(err!=GL_NO_ERROR)
+				throw Exception("HdlTexture::HdlTexture - The storage of the texture cannot be allocated. Last OpenGL error : " + getGLEnumNameSafe(err) + " : " + getGLErrorDescription(err), __FILE__, __LINE__, Exception::GLException);
+		}
+
+		HandleOpenGL::bindTexture(0u, 0, target);
 	}
 
 	/**
@@ -670,7 +763,9 @@ using namespace Glip::CoreGL;
 	HdlTexture::HdlTexture(GLuint proxyTexID)
 	 :	HdlAbstractTextureFormat(HdlTextureFormat::getTextureFormat(proxyTexID)),
 		texID(proxyTexID), 
-		proxy(true)
+		proxy(true),
+		immutable(false),
+		modificationCount(0)
 	{
 		if(!getFormatDescriptor().isSupported)
 			throw Exception("HdlTexture::HdlTexture - Format " + getGLEnumNameSafe(getGLMode()) + " is not supported.", __FILE__, __LINE__);
@@ -679,16 +774,20 @@ using namespace Glip::CoreGL;
 
 		#ifdef GLIP_USE_GL
 		// Testing hardware :
-		NEED_EXTENSION(GLEW_ARB_multitexture)
-		NEED_EXTENSION(GLEW_ARB_texture_border_clamp)
-		NEED_EXTENSION(GLEW_ARB_texture_non_power_of_two)
-		NEED_EXTENSION(GLEW_ARB_texture_rectangle)
+		// (The extensions are part of the core profile, where they are not listed anymore)
+		NEED_EXTENSION((GLEW_VERSION_1_3 || GLEW_ARB_multitexture))
+		NEED_EXTENSION((GLEW_VERSION_1_3 || GLEW_ARB_texture_border_clamp))
+		NEED_EXTENSION((GLEW_VERSION_2_0 || GLEW_ARB_texture_non_power_of_two))
+		NEED_EXTENSION((GLEW_VERSION_3_1 || GLEW_ARB_texture_rectangle))
 
 		if(isFloatingPoint())
-			NEED_EXTENSION(GLEW_ARB_texture_float)
+			NEED_EXTENSION((GLEW_VERSION_3_0 || GLEW_ARB_texture_float))
+
+		if(getGLDepth()==GL_HALF_FLOAT)
+			NEED_EXTENSION((GLEW_VERSION_3_0 || GLEW_ARB_half_float_pixel))
 
 		if(isCompressed())
-			NEED_EXTENSION(GLEW_ARB_texture_compression);
+			NEED_EXTENSION((GLEW_VERSION_1_3 || GLEW_ARB_texture_compression));
 		#endif
 
 		// Test :
@@ -700,7 +799,9 @@ using namespace Glip::CoreGL;
 		if( getMaxLevel()>0 )
 		{
 			#ifdef GLIP_USE_GL
-				glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
+				// (The mipmaps are generated by the writes in the core profile)
+				if(!HandleOpenGL::isCoreProfile())
+					glTexParameteri(target, GL_GENERATE_MIPMAP, GL_TRUE);
 			#else
 				throw Exception("HdlTexture::HdlTexture - Cannot generate mipmaps automatically on OpenGL ES.", __FILE__, __LINE__, Exception::GLException);
 			#endif
@@ -716,6 +817,7 @@ using namespace Glip::CoreGL;
 		if(!proxy)
 		{
 			// delete the texture :
+			HandleOpenGL::forgetTexture(texID);
 			glDeleteTextures( 1, &texID);
 
 			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
@@ -745,6 +847,16 @@ using namespace Glip::CoreGL;
 		return proxy;
 	}
 
+	/**
+	\fn bool HdlTexture::isImmutable(void) const
+	\brief Test if the storage of the texture is immutable (allocated with glTexStorage2D or glTexStorage3D, requires OpenGL 4.2 or ARB_texture_storage and a sized format such as GL_RGB8 or GL_RGBA32F).
+	\return True if the storage of the texture is immutable.
+	**/
+	bool HdlTexture::isImmutable(void) const
+	{
+		return immutable;
+	}
+
 	/**
 	\fn void HdlTexture::getSizeOnGPU(int m)
 	\brief Returns the size of the texture in bytes for mipmap m.
@@ -763,22 +875,23 @@ using namespace Glip::CoreGL;
 			bind();
 
 			if(isCompressed())
-				glGetTexLevelParameteriv(GL_TEXTURE_2D, m, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &s);
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &s);
 			else
 			{
-				GLint rs, gs, bs, as, ls, is, ds, _w, _h, bytesPerPixel;
-				glGetTexLevelParameteriv(GL_TEXTURE_2D, m, GL_TEXTURE_WIDTH,		&_w );
-				glGetTexLevelParameteriv(GL_TEXTURE_2D, m, GL_TEXTURE_HEIGHT,		&_h );
-				glGetTexLevelParameteriv(GL_TEXTURE_2D, m, GL_TEXTURE_RED_SIZE,		&rs );
-				glGetTexLevelParameteriv(GL_TEXTURE_2D, m, GL_TEXTURE_GREEN_SIZE,	&gs );
-				glGetTexLevelParameteriv(GL_TEXTURE_2D, m, GL_TEXTURE_BLUE_SIZE,	&bs );
-				glGetTexLevelParameteriv(GL_TEXTURE_2D, m, GL_TEXTURE_ALPHA_SIZE,	&as );
-				glGetTexLevelParameteriv(GL_TEXTURE_2D, m, GL_TEXTURE_LUMINANCE_SIZE,	&ls );
-				glGetTexLevelParameteriv(GL_TEXTURE_2D, m, GL_TEXTURE_INTENSITY_SIZE,	&is );
-				glGetTexLevelParameteriv(GL_TEXTURE_2D, m, GL_TEXTURE_DEPTH_SIZE,	&ds );
+				GLint rs, gs, bs, as, ls, is, ds, _w, _h, _d, bytesPerPixel;
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_WIDTH,		&_w );
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_HEIGHT,		&_h );
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_DEPTH,		&_d );
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_RED_SIZE,		&rs );
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_GREEN_SIZE,	&gs );
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_BLUE_SIZE,	&bs );
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_ALPHA_SIZE,	&as );
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_LUMINANCE_SIZE,	&ls );
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_INTENSITY_SIZE,	&is );
+				glGetTexLevelParameteriv(target, m, GL_TEXTURE_DEPTH_SIZE,	&ds );
 
 				bytesPerPixel = (rs+gs+bs+as+ls+is+ds)/8;
-				s = _w*_h*bytesPerPixel;
+				s = _w*_h*_d*bytesPerPixel;
 			}
 
 			return static_cast<int>(s);
@@ -788,6 +901,25 @@ using namespace Glip::CoreGL;
 		#endif
 	}
 
+	/**
+	\fn unsigned int HdlTexture::getModificationCount(void) const
+	\brief Get the number of modifications of the content of this texture (writes and renderings), which can be used to detect changes.
+	\return The number of modifications (might wrap around).
+	**/
+	unsigned int HdlTexture::getModificationCount(void) const
+	{
+		return modificationCount;
+	}
+
+	/**
+	\fn void HdlTexture::markAsModified(void)
+	\brief Signal that the content of the texture was modified. This is done automatically by HdlTexture::write, HdlTexture::writeRegion, HdlTexture::writeLayer, HdlTexture::writeCompressed, HdlTexture::fill, the sampling setters (filters and wrapping), HdlPBO::copyToTexture, HdlFBO::endRendering and Modules::ImageBuffer::operator>> but must be called if the texture is modified by other means.
+	**/
+	void HdlTexture::markAsModified(void)
+	{
+		modificationCount++;
+	}
+
 	/**
 	\fn void HdlTexture::bind(GLenum unit)
 	\brief Bind the texture to a unit.
@@ -795,17 +927,16 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlTexture::bind(GLenum unit)
 	{
-		#ifdef GLIP_USE_GL
-		glActiveTextureARB(unit);
-		#else
-		UNUSED_PARAMETER(unit)
-		#endif
-		glBindTexture(GL_TEXTURE_2D, texID);
-
-		#ifdef GLIP_USE_GL
-		glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE_EXT);
-		glTexEnvf(GL_TEXTURE_ENV, GL_COMBINE_RGB_EXT,  GL_REPLACE);
-		#endif
+		if(HandleOpenGL::bindTexture(unit - GL_TEXTURE0, texID, target))
+		{
+			#ifdef GLIP_USE_GL
+			if(!HandleOpenGL::isCoreProfile())
+			{
+				glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE_EXT);
+				glTexEnvf(GL_TEXTURE_ENV, GL_COMBINE_RGB_EXT,  GL_REPLACE);
+			}
+			#endif
+		}
 	}
 
 	/**
@@ -831,11 +962,13 @@ using namespace Glip::CoreGL;
 	\fn    void HdlTexture::setTWrapping(GLenum m)
 	\brief Sets the texture's T wrapping parameter. WARNING : no error checking is performed within this function.
 	\param m The new T wrapping parameter (e.g. GL_CLAMP, GL_CLAMP_TO_BORDER, GL_CLAMP_TO_EDGE, GL_REPEAT, GL_MIRRORED_REPEAT)
+
+	These settings change the result of the filters sampling the texture : a new value marks the texture as modified (see HdlTexture::getModificationCount()).
 	**/
-	void HdlTexture::setMinFilter(GLenum mf)	{ minFilter = mf; bind(); glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, getMinFilter() );}
-	void HdlTexture::setMagFilter(GLenum mf)	{ magFilter = mf; bind(); glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, getMagFilter() );}
-	void HdlTexture::setSWrapping(GLenum m)		{ wraps     = m;  bind(); glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,     getSWrapping() );}
-	void HdlTexture::setTWrapping(GLenum m)		{ wrapt     = m;  bind(); glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,     getTWrapping() );}
+	void HdlTexture::setMinFilter(GLenum mf)	{ if(mf!=minFilter) markAsModified(); minFilter = mf; bind(); glTexParameteri(target, GL_TEXTURE_MIN_FILTER, getMinFilter() );}
+	void HdlTexture::setMagFilter(GLenum mf)	{ if(mf!=magFilter) markAsModified(); magFilter = mf; bind(); glTexParameteri(target, GL_TEXTURE_MAG_FILTER, getMagFilter() );}
+	void HdlTexture::setSWrapping(GLenum m)		{ if(m!=wraps) markAsModified(); wraps     = m;  bind(); glTexParameteri(target, GL_TEXTURE_WRAP_S,     getSWrapping() );}
+	void HdlTexture::setTWrapping(GLenum m)		{ if(m!=wrapt) markAsModified(); wrapt     = m;  bind(); glTexParameteri(target, GL_TEXTURE_WRAP_T,     getTWrapping() );}
 
 	/**
 	\fn void HdlTexture::setSetting(GLenum param, unsigned int value)
@@ -886,15 +1019,18 @@ using namespace Glip::CoreGL;
 	}
 
 	/**
-	\fn void HdlTexture::write(GLvoid *texData, GLenum pixelFormat, GLenum pixelDepth, int _alignment)
-	\brief Write data to a texture using classical glTexImage method. In the case that the texture is compressed and the input data is not of the compressed format, you MUST specify pixelFormat and pixelDepth. WARNING : this function does not perform error checking.
-	\param texData The pointer to the data.
+	\fn void HdlTexture::write(const GLvoid *texData, GLenum pixelFormat, GLenum pixelDepth, int _alignment)
+	\brief Write data to a texture. The storage is allocated when the texture is created, the data is written with glTexSubImage2D (glTexSubImage3D for all the layers of an array or 3D texture, packed one after the other, or glTexImage2D for compressed textures). In the case that the texture is compressed and the input data is not of the compressed format, you MUST specify pixelFormat and pixelDepth. WARNING : this function does not perform error checking.
+	\param texData The pointer to the data (if NULL and no pixel buffer is bound, nothing is written).
 	\param pixelFormat The pixel format of the input data (considered the same as the texture layout if not provided).
 	\param pixelDepth The depth of the input data (considered the same as the texture layout if not provided).
 	\param _alignment Byte alignment of the input data.
 	**/
-	void HdlTexture::write(GLvoid *texData, GLenum pixelFormat, GLenum pixelDepth, int _alignment)
+	void HdlTexture::write(const GLvoid *texData, GLenum pixelFormat, GLenum pixelDepth, int _alignment)
 	{
+		if(texData==NULL && !isCompressed() && !HdlGeBO::isBound(GL_PIXEL_UNPACK_BUFFER))
+			return ;
+
 		if(pixelFormat==GL_ZERO)
 			pixelFormat = mode;
 
@@ -907,7 +1043,7 @@ using namespace Glip::CoreGL;
 		pixelFormat = HdlTextureFormatDescriptorsList::get(pixelFormat).aliasMode;
 
 		// Bind it :
-		glBindTexture(GL_TEXTURE_2D, texID);
+		HandleOpenGL::bindTextureTarget(target, texID);
 
 		// Save the current packing alignment, and replace it with the desired value :
 		GLint originalAlignment = 0;
@@ -915,23 +1051,190 @@ using namespace Glip::CoreGL;
 		glPixelStorei(GL_UNPACK_ALIGNMENT, _alignment);
 
 		// Write :
-		glTexImage2D(GL_TEXTURE_2D, 0, mode, width, height, 0, pixelFormat, pixelDepth, texData);
+		if(isCompressed())
+		{
+			glTexImage2D(target, 0, mode, width, height, 0, pixelFormat, pixelDepth, texData);
+
+			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+				OPENGL_ERROR_TRACKER("HdlTexture::write", "glTexImage2D()")
+			#endif
+		}
+		else if(isLayered())
+		{
+			glTexSubImage3D(target, 0, 0, 0, 0, width, height, numLayers, pixelFormat, pixelDepth, texData);
+
+			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+				OPENGL_ERROR_TRACKER("HdlTexture::write", "glTexSubImage3D()")
+			#endif
+		}
+		else
+		{
+			glTexSubImage2D(target, 0, 0, 0, width, height, pixelFormat, pixelDepth, texData);
+
+			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+				OPENGL_ERROR_TRACKER("HdlTexture::write", "glTexSubImage2D()")
+			#endif
+		}
+
+		if( getMaxLevel()>0 )
+		{
+			glGenerateMipmap(target);
+
+			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+				OPENGL_ERROR_TRACKER("HdlTexture::write", "glGenerateMipmap()")
+			#endif
+		}
+
+		// Restore :
+		glPixelStorei(GL_UNPACK_ALIGNMENT, originalAlignment);
+
+		markAsModified();
+	}
+
+	/**
+	\fn void HdlTexture::writeRegion(int x, int y, int w, int h, const GLvoid *texData, int rowLength, GLenum pixelFormat, GLenum pixelDepth, int _alignment)
+	\brief Write data to a region of the texture (glTexSubImage2D), the rest of the texture is left unchanged. WARNING : this function does not perform error checking.
+	\param x Horizontal offset of the region.
+	\param y Vertical offset of the region.
+	\param w Width of the region.
+	\param h Height of the region.
+	\param texData The pointer to the first pixel of the data.
+	\param rowLength The number of pixels between the starts of two rows of the data (GL_UNPACK_ROW_LENGTH), the default is w.
+	\param pixelFormat The pixel format of the input data (considered the same as the texture layout if not provided).
+	\param pixelDepth The depth of the input data (considered the same as the texture layout if not provided).
+	\param _alignment Byte alignment of the rows of the input data.
+
+	A crop of a larger image can be uploaded without copy :
+	\code
+		// Write the region of the image starting at (x0, y0) into the texture :
+		const unsigned char* ptr = reinterpret_cast<const unsigned char*>(image.getRowPtr(y0)) + x0*image.getPixelSize();
+		texture.writeRegion(0, 0, texture.getWidth(), texture.getHeight(), ptr, image.getWidth(), image.getGLMode(), image.getGLDepth(), image.getAlignment());
+	\endcode
+	**/
+	void HdlTexture::writeRegion(int x, int y, int w, int h, const GLvoid *texData, int rowLength, GLenum pixelFormat, GLenum pixelDepth, int _alignment)
+	{
+		if(isCompressed())
+			throw Exception("HdlTexture::writeRegion - Cannot write a region of a compressed texture.", __FILE__, __LINE__, Exception::GLException);
+		if(isLayered())
+			throw Exception("HdlTexture::writeRegion - Cannot write a region of a layered texture (see HdlTexture::writeLayer).", __FILE__, __LINE__, Exception::GLException);
+		if(x<0 || y<0 || w<=0 || h<=0 || x+w>width || y+h>height)
+			throw Exception("HdlTexture::writeRegion - The region (" + toString(x) + ", " + toString(y) + ", " + toString(w) + "x" + toString(h) + ") is not inside the texture (" + toString(width) + "x" + toString(height) + ").", __FILE__, __LINE__, Exception::GLException);
+		if(rowLength>0 && rowLength<w)
+			throw Exception("HdlTexture::writeRegion - The row length (" + toString(rowLength) + ") is smaller than the width of the region (" + toString(w) + ").", __FILE__, __LINE__, Exception::GLException);
+
+		if(pixelFormat==GL_ZERO)
+			pixelFormat = mode;
+
+		if(pixelDepth==GL_ZERO)
+			pixelDepth = depth;
+
+		if(_alignment<0)
+			_alignment = getAlignment();
+
+		pixelFormat = HdlTextureFormatDescriptorsList::get(pixelFormat).aliasMode;
+
+		// Bind it :
+		HandleOpenGL::bindTextureTarget(target, texID);
+
+		// Save the current unpacking parameters, and replace them with the desired values :
+		GLint	originalAlignment = 0,
+			originalRowLength = 0;
+		glGetIntegerv(GL_UNPACK_ALIGNMENT, &originalAlignment);
+		glGetIntegerv(GL_UNPACK_ROW_LENGTH, &originalRowLength);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, _alignment);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, (rowLength>w) ? rowLength : 0);
+
+		// Write :
+		glTexSubImage2D(target, 0, x, y, w, h, pixelFormat, pixelDepth, texData);
 
 		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
-			OPENGL_ERROR_TRACKER("HdlTexture::write", "glTexImage2D()")
+			OPENGL_ERROR_TRACKER("HdlTexture::writeRegion", "glTexSubImage2D()")
 		#endif
 
 		if( getMaxLevel()>0 )
 		{
-			glGenerateMipmap(GL_TEXTURE_2D);
+			glGenerateMipmap(target);
 
 			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
-				OPENGL_ERROR_TRACKER("HdlTexture::write", "glGenerateMipmap()")
+				OPENGL_ERROR_TRACKER("HdlTexture::writeRegion", "glGenerateMipmap()")
+			#endif
+		}
+
+		// Restore :
+		glPixelStorei(GL_UNPACK_ALIGNMENT, originalAlignment);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, originalRowLength);
+
+		markAsModified();
+	}
+
+	/**
+	\fn void HdlTexture::writeLayer(int layer, const GLvoid *texData, GLenum pixelFormat, GLenum pixelDepth, int _alignment)
+	\brief Write data to a single layer of an array (or a single slice of a 3D texture) with glTexSubImage3D, the other layers are left unchanged. On a GL_TEXTURE_2D texture, the only layer is 0 and this is the same as HdlTexture::write. WARNING : this function does not perform error checking.
+	\param layer Index of the layer.
+	\param texData The pointer to the data of the layer (if NULL and no pixel buffer is bound, nothing is written).
+	\param pixelFormat The pixel format of the input data (considered the same as the texture layout if not provided).
+	\param pixelDepth The depth of the input data (considered the same as the texture layout if not provided).
+	\param _alignment Byte alignment of the input data.
+
+	A burst of frames can be gathered in an array and processed in a single pass :
+	\code
+		for(int k=0; k<batch.getNumLayers(); k++)
+			batch.writeLayer(k, frames[k].getPtr());
+	\endcode
+	**/
+	void HdlTexture::writeLayer(int layer, const GLvoid *texData, GLenum pixelFormat, GLenum pixelDepth, int _alignment)
+	{
+		if(isCompressed())
+			throw Exception("HdlTexture::writeLayer - Cannot write a layer of a compressed texture.", __FILE__, __LINE__, Exception::GLException);
+		if(layer<0 || layer>=numLayers)
+			throw Exception("HdlTexture::writeLayer - The layer " + toString(layer) + " is out of range (the texture has " + toString(numLayers) + " layer(s)).", __FILE__, __LINE__, Exception::GLException);
+		if(!isLayered())
+		{
+			write(texData, pixelFormat, pixelDepth, _alignment);
+			return ;
+		}
+		if(texData==NULL && !HdlGeBO::isBound(GL_PIXEL_UNPACK_BUFFER))
+			return ;
+
+		if(pixelFormat==GL_ZERO)
+			pixelFormat = mode;
+
+		if(pixelDepth==GL_ZERO)
+			pixelDepth = depth;
+
+		if(_alignment<0)
+			_alignment = getAlignment();
+
+		pixelFormat = HdlTextureFormatDescriptorsList::get(pixelFormat).aliasMode;
+
+		// Bind it :
+		HandleOpenGL::bindTextureTarget(target, texID);
+
+		// Save the current packing alignment, and replace it with the desired value :
+		GLint originalAlignment = 0;
+		glGetIntegerv(GL_UNPACK_ALIGNMENT, &originalAlignment);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, _alignment);
+
+		// Write :
+		glTexSubImage3D(target, 0, 0, 0, layer, width, height, 1, pixelFormat, pixelDepth, texData);
+
+		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+			OPENGL_ERROR_TRACKER("HdlTexture::writeLayer", "glTexSubImage3D()")
+		#endif
+
+		if( getMaxLevel()>0 )
+		{
+			glGenerateMipmap(target);
+
+			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+				OPENGL_ERROR_TRACKER("HdlTexture::writeLayer", "glGenerateMipmap()")
 			#endif
 		}
 
 		// Restore :
 		glPixelStorei(GL_UNPACK_ALIGNMENT, originalAlignment);
+
+		markAsModified();
 	}
 
 	/**
@@ -955,12 +1258,12 @@ using namespace Glip::CoreGL;
 			_alignment = getAlignment();
 
 		// Bind it
-		glBindTexture(GL_TEXTURE_2D, texID);
+		HandleOpenGL::bindTextureTarget(target, texID);
 
 		glPixelStorei(GL_UNPACK_ALIGNMENT, _alignment);
 
 		// Write
-		glCompressedTexImage2D(GL_TEXTURE_2D, 0, mode, width, height, 0,  static_cast<GLsizei>(size), texData);
+		glCompressedTexImage2D(target, 0, mode, width, height, 0,  static_cast<GLsizei>(size), texData);
 
 		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
 			OPENGL_ERROR_TRACKER("HdlTexture::writeCompressed", "glCompressedTexImage2D()")
@@ -968,12 +1271,14 @@ using namespace Glip::CoreGL;
 
 		if( getMaxLevel()>0 )
 		{
-			glGenerateMipmap(GL_TEXTURE_2D);
+			glGenerateMipmap(target);
 
 			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
 				OPENGL_ERROR_TRACKER("HdlTexture::writeCompressed", "glGenerateMipmap()")
 			#endif
 		}
+
+		markAsModified();
 	}
 
 	/**
@@ -1000,7 +1305,7 @@ using namespace Glip::CoreGL;
 
 	/**
 	\fn void HdlTexture::read(GLvoid *data, GLenum pixelFormat, GLenum pixelDepth, int _alignment)
-	\brief Read data from a classical texture using classical glGetTexImage method. 
+	\brief Read data from a classical texture using classical glGetTexImage method (all the layers of an array or 3D texture, packed one after the other, see HdlAbstractTextureFormat::getSize()). 
 	\param data The pointer to the data.
 	\param pixelFormat The pixel format of the input data (considered the same as the texture layout if not provided).
 	\param pixelDepth The depth of the input data (considered the same as the texture layout if not provided).
@@ -1025,12 +1330,12 @@ using namespace Glip::CoreGL;
 			pixelFormat = HdlTextureFormatDescriptorsList::get(pixelFormat).aliasMode;
 
 			// Bind it :
-			glBindTexture(GL_TEXTURE_2D, texID);
+			HandleOpenGL::bindTextureTarget(target, texID);
 
 			glPixelStorei(GL_PACK_ALIGNMENT, _alignment);
 
 			// Read :
-			glGetTexImage(GL_TEXTURE_2D, 0, pixelFormat, pixelDepth, data);
+			glGetTexImage(target, 0, pixelFormat, pixelDepth, data);
 
 			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
 				OPENGL_ERROR_TRACKER("HdlTexture::write", "glGetTexImage()")
@@ -1058,7 +1363,7 @@ using namespace Glip::CoreGL;
 			bind();
 
 			GLint param;
-			glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &param);
+			glGetTexLevelParameteriv(target, 0, GL_TEXTURE_INTERNAL_FORMAT, &param);
 
 			return param;
 		#else
@@ -1075,21 +1380,21 @@ using namespace Glip::CoreGL;
 
 			bind();
 
-			glGetIntegerv(GL_TEXTURE_BINDING_2D, &glId);
+			glGetIntegerv((target==GL_TEXTURE_3D) ? GL_TEXTURE_BINDING_3D : ((target==GL_TEXTURE_2D_ARRAY) ? GL_TEXTURE_BINDING_2D_ARRAY : GL_TEXTURE_BINDING_2D), &glId);
 
-			glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, 		&vMagFilter);	tMagFilter	= vMagFilter==static_cast<GLint>(getMagFilter());
-			glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, 		&vMinFilter);	tMinFilter	= vMinFilter==static_cast<GLint>(getMinFilter());
-			glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 		&vBaseLevel);	tBaseLevel	= vBaseLevel==getBaseLevel();
-			glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 		&vMaxLevel);	tMaxLevel	= vMaxLevel==getMaxLevel();
-			glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, 			&vSWrap);	tSWrap		= vSWrap==static_cast<GLint>(getSWrapping());
-			glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, 			&vTWrap);	tTWrap		= vTWrap==static_cast<GLint>(getTWrapping());
-			glGetTexParameteriv(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, 			&vMipmapGen);	tMipmapGen	= (vMipmapGen>0 && getBaseLevel()>0) || (vMipmapGen==0 && getBaseLevel()==0);
+			glGetTexParameteriv(target, GL_TEXTURE_MAG_FILTER, 		&vMagFilter);	tMagFilter	= vMagFilter==static_cast<GLint>(getMagFilter());
+			glGetTexParameteriv(target, GL_TEXTURE_MIN_FILTER, 		&vMinFilter);	tMinFilter	= vMinFilter==static_cast<GLint>(getMinFilter());
+			glGetTexParameteriv(target, GL_TEXTURE_BASE_LEVEL, 		&vBaseLevel);	tBaseLevel	= vBaseLevel==getBaseLevel();
+			glGetTexParameteriv(target, GL_TEXTURE_MAX_LEVEL, 		&vMaxLevel);	tMaxLevel	= vMaxLevel==getMaxLevel();
+			glGetTexParameteriv(target, GL_TEXTURE_WRAP_S, 			&vSWrap);	tSWrap		= vSWrap==static_cast<GLint>(getSWrapping());
+			glGetTexParameteriv(target, GL_TEXTURE_WRAP_T, 			&vTWrap);	tTWrap		= vTWrap==static_cast<GLint>(getTWrapping());
+			glGetTexParameteriv(target, GL_GENERATE_MIPMAP, 			&vMipmapGen);	tMipmapGen	= (vMipmapGen>0 && getBaseLevel()>0) || (vMipmapGen==0 && getBaseLevel()==0);
 
-			glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, 		&vWidth);	tWidth		= vWidth==getWidth();
-			glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, 		&vHeight);	tHeight		= vHeight==getHeight();
-			glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, 	&vMode);	tMode		= vMode==static_cast<GLint>(getGLMode());
-			glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_BORDER, 		&vBorder);	tBorder		= vBorder==0;
-			glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, 	&vCompressed);	tCompressed	= (vCompressed>0 && isCompressed()) || (vCompressed==0 && !isCompressed());
+			glGetTexLevelParameteriv(target, 0, GL_TEXTURE_WIDTH, 		&vWidth);	tWidth		= vWidth==getWidth();
+			glGetTexLevelParameteriv(target, 0, GL_TEXTURE_HEIGHT, 		&vHeight);	tHeight		= vHeight==getHeight();
+			glGetTexLevelParameteriv(target, 0, GL_TEXTURE_INTERNAL_FORMAT, 	&vMode);	tMode		= vMode==static_cast<GLint>(getGLMode());
+			glGetTexLevelParameteriv(target, 0, GL_TEXTURE_BORDER, 		&vBorder);	tBorder		= vBorder==0;
+			glGetTexLevelParameteriv(target, 0, GL_TEXTURE_COMPRESSED, 	&vCompressed);	tCompressed	= (vCompressed>0 && isCompressed()) || (vCompressed==0 && !isCompressed());
 
 			if(verbose)
 			{
@@ -1182,12 +1487,7 @@ using namespace Glip::CoreGL;
 	**/
 	void HdlTexture::unbind(GLenum unit)
 	{
-		#ifdef GLIP_USE_GL
-		glActiveTextureARB(unit);
-		#else
-		UNUSED_PARAMETER(unit)
-		#endif
-		glBindTexture(GL_TEXTURE_2D, 0); //unBind
+		HandleOpenGL::bindTexture(unit - GL_TEXTURE0, 0); //unBind
 	}
 
 	/**
@@ -1213,3 +1513,132 @@ using namespace Glip::CoreGL;
 		return maxTextureImageUnits;
 	}
 
+// HdlTexturePool :
+	std::list<HdlTexture*>	HdlTexturePool::idleTextures;
+	size_t			HdlTexturePool::budget		= 0;
+	size_t			HdlTexturePool::residentBytes	= 0;
+	unsigned int		HdlTexturePool::numHits		= 0;
+	unsigned int		HdlTexturePool::numMisses	= 0;
+
+	/**
+	\fn HdlTexture* HdlTexturePool::acquire(const HdlAbstractTextureFormat& fmt)
+	\brief Get a texture of the given format, from the pool if an idle texture matches (hit), or newly created otherwise (miss).
+	\param fmt The format of the texture (including filtering, wrapping and mipmap settings).
+	\return A pointer to the texture, to be given back with release() (or deleted).
+	**/
+	HdlTexture* HdlTexturePool::acquire(const HdlAbstractTextureFormat& fmt)
+	{
+		// Search from the most recently released :
+		for(std::list<HdlTexture*>::reverse_iterator it=idleTextures.rbegin(); it!=idleTextures.rend(); it++)
+		{
+			if((*it)->format()==fmt)
+			{
+				HdlTexture* texture = *it;
+				idleTextures.erase(--(it.base()));
+				residentBytes -= texture->getSize();
+				numHits++;
+				return texture;
+			}
+		}
+
+		numMisses++;
+		return new HdlTexture(fmt);
+	}
+
+	/**
+	\fn void HdlTexturePool::release(HdlTexture* texture)
+	\brief Give a texture back to the pool. It is deleted if the pool is disabled, or if it is a proxy. The least recently released textures are deleted if the budget is exceeded.
+	\param texture The texture (it must not be used by the caller anymore).
+	**/
+	void HdlTexturePool::release(HdlTexture* texture)
+	{
+		if(texture==NULL)
+			return ;
+
+		if(budget==0 || texture->isProxy() || texture->getSize()>budget)
+		{
+			delete texture;
+			return ;
+		}
+
+		idleTextures.push_back(texture);
+		residentBytes += texture->getSize();
+
+		trim(budget);
+	}
+
+	/**
+	\fn void HdlTexturePool::trim(size_t maxBytes)
+	\brief Delete the least recently released textures until the resident size is below a limit.
+	\param maxBytes The maximum size of the idle textures, in bytes.
+	**/
+	void HdlTexturePool::trim(size_t maxBytes)
+	{
+		while(residentBytes>maxBytes && !idleTextures.empty())
+		{
+			residentBytes -= idleTextures.front()->getSize();
+			delete idleTextures.front();
+			idleTextures.pop_front();
+		}
+	}
+
+	/**
+	\fn void HdlTexturePool::clear(void)
+	\brief Delete all the idle textures (must be done before the destruction of the context, see HandleOpenGL::deinit).
+	**/
+	void HdlTexturePool::clear(void)
+	{
+		trim(0);
+	}
+
+	/**
+	\fn void HdlTexturePool::setBudget(size_t bytes)
+	\brief Set the maximum size of the idle textures kept by the pool.
+	\param bytes The budget, in bytes (zero disables the pool).
+	**/
+	void HdlTexturePool::setBudget(size_t bytes)
+	{
+		budget = bytes;
+		trim(budget);
+	}
+
+	/**
+	\fn size_t HdlTexturePool::getBudget(void)
+	\return The maximum size of the idle textures kept by the pool, in bytes.
+	\fn size_t HdlTexturePool::getResidentBytes(void)
+	\return The size of the idle textures currently kept by the pool, in bytes.
+	\fn int HdlTexturePool::getNumResidentTextures(void)
+	\return The number of idle textures currently kept by the pool.
+	\fn unsigned int HdlTexturePool::getNumHits(void)
+	\return The number of acquisitions served by an idle texture.
+	\fn unsigned int HdlTexturePool::getNumMisses(void)
+	\return The number of acquisitions which created a new texture.
+	**/
+	size_t HdlTexturePool::getBudget(void)			{ return budget; }
+	size_t HdlTexturePool::getResidentBytes(void)		{ return residentBytes; }
+	int HdlTexturePool::getNumResidentTextures(void)	{ return idleTextures.size(); }
+	unsigned int HdlTexturePool::getNumHits(void)		{ return numHits; }
+	unsigned int HdlTexturePool::getNumMisses(void)		{ return numMisses; }
+
+	/**
+	\fn double HdlTexturePool::getHitRate(void)
+	\brief Get the ratio of acquisitions served by an idle texture.
+	\return The hit rate, between 0 and 1 (0 if no texture was acquired).
+	**/
+	double HdlTexturePool::getHitRate(void)
+	{
+		if(numHits+numMisses==0)
+			return 0.0;
+		else
+			return static_cast<double>(numHits)/static_cast<double>(numHits+numMisses);
+	}
+
+	/**
+	\fn void HdlTexturePool::resetStatistics(void)
+	\brief Reset the numbers of hits and misses.
+	**/
+	void HdlTexturePool::resetStatistics(void)
+	{
+		numHits		= 0;
+		numMisses	= 0;
+	}
@@ -62,20 +62,20 @@ const HdlTextureFormatDescriptor HdlTextureFormatDescriptorsList::textureFormatD
 {GL_GREEN, GL_RED, GL_GREEN, ALIAS_GL_COMPRESSED_RED, 1, {GL_GREEN, GL_NONE, GL_NONE, GL_NONE}, {-1, 0, 0, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_BLUE, GL_RED, GL_BLUE, ALIAS_GL_COMPRESSED_RED, 1, {GL_BLUE, GL_NONE, GL_NONE, GL_NONE}, {-1, 0, 0, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_R8,	GL_RED,	GL_R8,	ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {8, 0, 0, 0}, {GL_UNSIGNED_BYTE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
-{GL_R8I, GL_RED, GL_R8I, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {8, 0, 0, 0}, {GL_BYTE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
-{GL_R8UI, GL_RED, GL_R8UI, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {8, 0, 0, 0}, {GL_UNSIGNED_BYTE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
+{GL_R8I, GL_RED_INTEGER, GL_R8I, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {8, 0, 0, 0}, {GL_BYTE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
+{GL_R8UI, GL_RED_INTEGER, GL_R8UI, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {8, 0, 0, 0}, {GL_UNSIGNED_BYTE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_R8_SNORM, GL_RED, GL_R8_SNORM, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {8, 0, 0, 0}, {GL_BYTE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 #ifdef GLIP_USE_GL
 {GL_R16, GL_RED, GL_R16, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_UNSIGNED_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 #endif
-{GL_R16I, GL_RED, GL_R16I, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
-{GL_R16UI, GL_RED, GL_R16UI, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_UNSIGNED_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
+{GL_R16I, GL_RED_INTEGER, GL_R16I, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
+{GL_R16UI, GL_RED_INTEGER, GL_R16UI, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_UNSIGNED_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 #ifdef GLIP_USE_GL
 {GL_R16_SNORM, GL_RED, GL_R16_SNORM, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 #endif
-{GL_R16F, GL_RED, GL_R16F, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
-{GL_R32I, GL_RED, GL_R32I, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {32, 0, 0, 0}, {GL_INT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
-{GL_R32UI, GL_RED, GL_R32UI, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {32, 0, 0, 0}, {GL_UNSIGNED_INT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
+{GL_R16F, GL_RED, GL_R16F, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_HALF_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
+{GL_R32I, GL_RED_INTEGER, GL_R32I, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {32, 0, 0, 0}, {GL_INT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
+{GL_R32UI, GL_RED_INTEGER, GL_R32UI, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {32, 0, 0, 0}, {GL_UNSIGNED_INT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_R32F, GL_RED, GL_R32F, ALIAS_GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {32, 0, 0, 0}, {GL_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
 {GL_ALPHA, GL_ALPHA, GL_ALPHA, ALIAS_GL_COMPRESSED_ALPHA, 1, {GL_ALPHA, GL_NONE, GL_NONE, GL_NONE}, {-1, 0, 0, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 #ifdef GLIP_USE_GL
@@ -84,7 +84,7 @@ const HdlTextureFormatDescriptor HdlTextureFormatDescriptorsList::textureFormatD
 {GL_ALPHA8_SNORM, GL_ALPHA, GL_ALPHA8_SNORM, ALIAS_GL_COMPRESSED_ALPHA, 1, {GL_ALPHA, GL_NONE, GL_NONE, GL_NONE}, {8, 0, 0, 0}, {GL_BYTE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_ALPHA12, GL_ALPHA, GL_ALPHA12, ALIAS_GL_COMPRESSED_ALPHA, 1, {GL_ALPHA, GL_NONE, GL_NONE, GL_NONE}, {12, 0, 0, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, false},
 {GL_ALPHA16, GL_ALPHA, GL_ALPHA16, ALIAS_GL_COMPRESSED_ALPHA, 1, {GL_ALPHA, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_UNSIGNED_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
-{GL_ALPHA16F_ARB, GL_ALPHA, GL_ALPHA16F_ARB, ALIAS_GL_COMPRESSED_ALPHA, 1, {GL_ALPHA, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
+{GL_ALPHA16F_ARB, GL_ALPHA, GL_ALPHA16F_ARB, ALIAS_GL_COMPRESSED_ALPHA, 1, {GL_ALPHA, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_HALF_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
 {GL_ALPHA16_SNORM, GL_ALPHA, GL_ALPHA16_SNORM, ALIAS_GL_COMPRESSED_ALPHA, 1, {GL_ALPHA, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_ALPHA32F_ARB, GL_ALPHA, GL_ALPHA32F_ARB, ALIAS_GL_COMPRESSED_ALPHA, 1, {GL_ALPHA, GL_NONE, GL_NONE, GL_NONE}, {32, 0, 0, 0}, {GL_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
 #endif
@@ -95,7 +95,7 @@ const HdlTextureFormatDescriptor HdlTextureFormatDescriptorsList::textureFormatD
 {GL_LUMINANCE8_SNORM, GL_LUMINANCE, GL_LUMINANCE8_SNORM, ALIAS_GL_COMPRESSED_LUMINANCE, 1, {GL_LUMINANCE, GL_NONE, GL_NONE, GL_NONE}, {8, 0, 0, 0}, {GL_BYTE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_LUMINANCE12, GL_LUMINANCE, GL_LUMINANCE12, ALIAS_GL_COMPRESSED_LUMINANCE, 1, {GL_LUMINANCE, GL_NONE, GL_NONE, GL_NONE}, {12, 0, 0, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, false},
 {GL_LUMINANCE16, GL_LUMINANCE, GL_LUMINANCE16, ALIAS_GL_COMPRESSED_LUMINANCE, 1, {GL_LUMINANCE, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_UNSIGNED_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
-{GL_LUMINANCE16F_ARB, GL_LUMINANCE, GL_LUMINANCE16F_ARB, ALIAS_GL_COMPRESSED_LUMINANCE, 1, {GL_LUMINANCE, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
+{GL_LUMINANCE16F_ARB, GL_LUMINANCE, GL_LUMINANCE16F_ARB, ALIAS_GL_COMPRESSED_LUMINANCE, 1, {GL_LUMINANCE, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_HALF_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
 {GL_LUMINANCE16_SNORM, GL_LUMINANCE, GL_LUMINANCE16_SNORM, ALIAS_GL_COMPRESSED_LUMINANCE, 1, {GL_LUMINANCE, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_LUMINANCE32F_ARB, GL_LUMINANCE, GL_LUMINANCE32F_ARB, ALIAS_GL_COMPRESSED_LUMINANCE, 1, {GL_LUMINANCE, GL_NONE, GL_NONE, GL_NONE}, {32, 0, 0, 0}, {GL_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
 {GL_INTENSITY, GL_INTENSITY, GL_INTENSITY, ALIAS_GL_COMPRESSED_INTENSITY, 1, {GL_INTENSITY, GL_NONE, GL_NONE, GL_NONE}, {-1, 0, 0, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
@@ -104,26 +104,26 @@ const HdlTextureFormatDescriptor HdlTextureFormatDescriptorsList::textureFormatD
 {GL_INTENSITY8_SNORM, GL_INTENSITY, GL_INTENSITY8_SNORM, ALIAS_GL_COMPRESSED_INTENSITY, 1, {GL_INTENSITY, GL_NONE, GL_NONE, GL_NONE}, {8, 0, 0, 0}, {GL_BYTE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_INTENSITY12, GL_INTENSITY, GL_INTENSITY12, ALIAS_GL_COMPRESSED_INTENSITY, 1, {GL_INTENSITY, GL_NONE, GL_NONE, GL_NONE}, {12, 0, 0, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, false},
 {GL_INTENSITY16, GL_INTENSITY, GL_INTENSITY16, ALIAS_GL_COMPRESSED_INTENSITY, 1, {GL_INTENSITY, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_UNSIGNED_SHORT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
-{GL_INTENSITY16F_ARB, GL_INTENSITY, GL_INTENSITY16F_ARB, ALIAS_GL_COMPRESSED_INTENSITY, 1, {GL_INTENSITY, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
+{GL_INTENSITY16F_ARB, GL_INTENSITY, GL_INTENSITY16F_ARB, ALIAS_GL_COMPRESSED_INTENSITY, 1, {GL_INTENSITY, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_HALF_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
 {GL_INTENSITY16_SNORM, GL_INTENSITY, GL_INTENSITY16_SNORM, ALIAS_GL_COMPRESSED_INTENSITY, 1, {GL_INTENSITY, GL_NONE, GL_NONE, GL_NONE}, {16, 0, 0, 0}, {GL_FLOAT, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_INTENSITY32F_ARB, GL_INTENSITY, GL_INTENSITY32F_ARB, ALIAS_GL_COMPRESSED_INTENSITY, 1, {GL_INTENSITY, GL_NONE, GL_NONE, GL_NONE}, {32, 0, 0, 0}, {GL_FLOAT, GL_NONE, GL_NONE, GL_NONE}, true, false, true},
 #endif
 {GL_RG,	GL_RG, GL_RG, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {-1, -1, 0, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 {GL_RG8, GL_RG, GL_RG8, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {8, 8, 0, 0}, {GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_NONE, GL_NONE}, false, false, true},
-{GL_RG8I, GL_RG, GL_RG8I, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {8, 8, 0, 0}, {GL_BYTE, GL_BYTE, GL_NONE, GL_NONE}, false, false, true},
-{GL_RG8UI, GL_RG, GL_RG8UI, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {8, 8, 0, 0}, {GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_NONE, GL_NONE}, false, false, true},
+{GL_RG8I, GL_RG_INTEGER, GL_RG8I, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {8, 8, 0, 0}, {GL_BYTE, GL_BYTE, GL_NONE, GL_NONE}, false, false, true},
+{GL_RG8UI, GL_RG_INTEGER, GL_RG8UI, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {8, 8, 0, 0}, {GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_NONE, GL_NONE}, false, false, true},
 {GL_RG8_SNORM, GL_RG, GL_RG8_SNORM, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {8, 8, 0, 0}, {GL_BYTE, GL_BYTE, GL_NONE, GL_NONE}, false, false, true},
 #ifdef GLIP_USE_GL
 {GL_RG16, GL_RG, GL_RG16, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {16, 16, 0, 0}, {GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_NONE, GL_NONE}, false, false, true},
 #endif
-{GL_RG16I, GL_RG, GL_RG16I, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {16, 16, 0, 0}, {GL_SHORT, GL_SHORT, GL_NONE, GL_NONE}, false, false, true},
-{GL_RG16UI, GL_RG, GL_RG16UI, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {16, 16, 0, 0}, {GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_NONE, GL_NONE}, false, false, true},
-{GL_RG16F, GL_RG, GL_RG16F, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {16, 16, 0, 0}, {GL_FLOAT, GL_FLOAT, GL_NONE, GL_NONE}, true, false, true},
+{GL_RG16I, GL_RG_INTEGER, GL_RG16I, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {16, 16, 0, 0}, {GL_SHORT, GL_SHORT, GL_NONE, GL_NONE}, false, false, true},
+{GL_RG16UI, GL_RG_INTEGER, GL_RG16UI, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {16, 16, 0, 0}, {GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_NONE, GL_NONE}, false, false, true},
+{GL_RG16F, GL_RG, GL_RG16F, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {16, 16, 0, 0}, {GL_HALF_FLOAT, GL_HALF_FLOAT, GL_NONE, GL_NONE}, true, false, true},
 #ifdef GLIP_USE_GL
 {GL_RG16_SNORM,	GL_RG, GL_RG16_SNORM, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {16, 16, 0, 0}, {GL_SHORT, GL_SHORT, GL_NONE, GL_NONE}, false, false, true},
 #endif
-{GL_RG32I, GL_RG, GL_RG32I, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {32, 32, 0, 0}, {GL_INT, GL_INT, GL_NONE, GL_NONE}, false, false, true},
-{GL_RG32UI, GL_RG, GL_RG32UI, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {32, 32, 0, 0}, {GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_NONE, GL_NONE}, false, false, true},
+{GL_RG32I, GL_RG_INTEGER, GL_RG32I, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {32, 32, 0, 0}, {GL_INT, GL_INT, GL_NONE, GL_NONE}, false, false, true},
+{GL_RG32UI, GL_RG_INTEGER, GL_RG32UI, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {32, 32, 0, 0}, {GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_NONE, GL_NONE}, false, false, true},
 {GL_RG32F, GL_RG, GL_RG32F, ALIAS_GL_COMPRESSED_RG, 2, {GL_RED, GL_GREEN, GL_NONE, GL_NONE}, {32, 32, 0, 0}, {GL_FLOAT, GL_FLOAT, GL_NONE, GL_NONE}, true, false, true},
 {GL_LUMINANCE_ALPHA, GL_LUMINANCE_ALPHA, GL_LUMINANCE_ALPHA, ALIAS_GL_COMPRESSED_LUMINANCE_ALPHA, 2, {GL_LUMINANCE, GL_ALPHA, GL_NONE, GL_NONE}, {-1, -1, 0, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 #ifdef GLIP_USE_GL
@@ -142,8 +142,8 @@ const HdlTextureFormatDescriptor HdlTextureFormatDescriptorsList::textureFormatD
 {GL_RGB4, GL_RGB, GL_RGB4, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {4, 4, 4, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, false},
 #endif
 {GL_RGB8, GL_RGB, GL_RGB8, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {8, 8, 8, 0}, {GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_NONE}, false, false, true},
-{GL_RGB8I, GL_RGB, GL_RGB8I, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {8, 8, 8, 0}, {GL_BYTE, GL_BYTE, GL_BYTE, GL_NONE}, false, false, true},
-{GL_RGB8UI, GL_RGB, GL_RGB8UI, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {8, 8, 8, 0}, {GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_NONE}, false, false, true},
+{GL_RGB8I, GL_RGB_INTEGER, GL_RGB8I, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {8, 8, 8, 0}, {GL_BYTE, GL_BYTE, GL_BYTE, GL_NONE}, false, false, true},
+{GL_RGB8UI, GL_RGB_INTEGER, GL_RGB8UI, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {8, 8, 8, 0}, {GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_NONE}, false, false, true},
 {GL_RGB8_SNORM,	GL_RGB,	GL_RGB8_SNORM, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {8, 8, 8, 0}, {GL_BYTE, GL_BYTE, GL_BYTE, GL_NONE}, false, false, true},
 {GL_SRGB8, GL_RGB, GL_SRGB8, ALIAS_GL_COMPRESSED_SRGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {8, 8, 8, 0}, {GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_NONE}, false, false, true},
 #ifdef GLIP_USE_GL
@@ -151,14 +151,14 @@ const HdlTextureFormatDescriptor HdlTextureFormatDescriptorsList::textureFormatD
 {GL_RGB12, GL_RGB, GL_RGB12, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {12, 12, 12, 0}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, false},
 {GL_RGB16, GL_RGB, GL_RGB16, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {16, 16, 16, 0}, {GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_NONE}, false, false, true},
 #endif
-{GL_RGB16I, GL_RGB, GL_RGB16I, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {16, 16, 16, 0}, {GL_SHORT, GL_SHORT, GL_SHORT, GL_NONE}, false, false, true},
-{GL_RGB16UI, GL_RGB, GL_RGB16UI, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {16, 16, 16, 0}, {GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_NONE}, false, false, true},
+{GL_RGB16I, GL_RGB_INTEGER, GL_RGB16I, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {16, 16, 16, 0}, {GL_SHORT, GL_SHORT, GL_SHORT, GL_NONE}, false, false, true},
+{GL_RGB16UI, GL_RGB_INTEGER, GL_RGB16UI, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {16, 16, 16, 0}, {GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_NONE}, false, false, true},
 #ifdef GLIP_USE_GL
 {GL_RGB16_SNORM, GL_RGB, GL_RGB16_SNORM, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {16, 16, 16, 0}, {GL_SHORT, GL_SHORT, GL_SHORT, GL_NONE}, false, false, true},
 #endif
-{GL_RGB16F, GL_RGB, GL_RGB16F, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {16, 16, 16, 0}, {GL_FLOAT, GL_FLOAT, GL_FLOAT, GL_NONE}, true, false, true},
-{GL_RGB32I, GL_RGB, GL_RGB32I, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {32, 32, 32, 0}, {GL_INT, GL_INT, GL_INT, GL_NONE}, false, false, true},
-{GL_RGB32UI, GL_RGB, GL_RGB32UI, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {32, 32, 32, 0}, {GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_NONE}, false, false, true},
+{GL_RGB16F, GL_RGB, GL_RGB16F, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {16, 16, 16, 0}, {GL_HALF_FLOAT, GL_HALF_FLOAT, GL_HALF_FLOAT, GL_NONE}, true, false, true},
+{GL_RGB32I, GL_RGB_INTEGER, GL_RGB32I, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {32, 32, 32, 0}, {GL_INT, GL_INT, GL_INT, GL_NONE}, false, false, true},
+{GL_RGB32UI, GL_RGB_INTEGER, GL_RGB32UI, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {32, 32, 32, 0}, {GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_NONE}, false, false, true},
 {GL_RGB32F, GL_RGB, GL_RGB32F, ALIAS_GL_COMPRESSED_RGB, 3, {GL_RED, GL_GREEN, GL_BLUE, GL_NONE}, {32, 32, 32, 0}, {GL_FLOAT, GL_FLOAT, GL_FLOAT, GL_NONE}, true, false, true},
 {GL_RGBA, GL_RGBA, GL_RGBA, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {-1, -1, -1, -1}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, true},
 #ifdef GLIP_USE_GL
@@ -168,21 +168,21 @@ const HdlTextureFormatDescriptor HdlTextureFormatDescriptorsList::textureFormatD
 #endif
 {GL_RGBA4, GL_RGBA, GL_RGBA4, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {4, 4, 4, 4}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, false, false},
 {GL_RGBA8, GL_RGBA, GL_RGBA8, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {8, 8, 8, 8}, {GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE}, false, false, true},
-{GL_RGBA8I, GL_RGBA, GL_RGBA8I, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {8, 8, 8, 8}, {GL_BYTE, GL_BYTE, GL_BYTE, GL_BYTE}, false, false, true},
-{GL_RGBA8UI, GL_RGBA, GL_RGBA8UI, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {8, 8, 8, 8}, {GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE}, false, false, true},
+{GL_RGBA8I, GL_RGBA_INTEGER, GL_RGBA8I, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {8, 8, 8, 8}, {GL_BYTE, GL_BYTE, GL_BYTE, GL_BYTE}, false, false, true},
+{GL_RGBA8UI, GL_RGBA_INTEGER, GL_RGBA8UI, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {8, 8, 8, 8}, {GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE}, false, false, true},
 {GL_RGBA8_SNORM, GL_RGBA, GL_RGBA8_SNORM, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {8, 8, 8, 8}, {GL_BYTE, GL_BYTE, GL_BYTE, GL_BYTE}, false, false, true},
 {GL_SRGB8_ALPHA8, GL_RGBA, GL_SRGB8_ALPHA8, ALIAS_GL_COMPRESSED_SRGB_ALPHA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {8, 8, 8, 8}, {GL_BYTE, GL_BYTE, GL_BYTE, GL_BYTE}, false, false, true},
 #ifdef GLIP_USE_GL
 {GL_RGBA16, GL_RGBA, GL_RGBA16, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {16, 16, 16, 16}, {GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT}, false, false, true},
 #endif
-{GL_RGBA16I, GL_RGBA, GL_RGBA16I, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {16, 16, 16, 16}, {GL_SHORT, GL_SHORT, GL_SHORT, GL_SHORT}, false, false, true},
-{GL_RGBA16UI, GL_RGBA, GL_RGBA16UI, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {16, 16, 16, 16}, {GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT}, false, false, true},
-{GL_RGBA16F, GL_RGBA, GL_RGBA16F, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {16, 16, 16, 16}, {GL_FLOAT, GL_FLOAT, GL_FLOAT, GL_FLOAT}, true, false, true},
+{GL_RGBA16I, GL_RGBA_INTEGER, GL_RGBA16I, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {16, 16, 16, 16}, {GL_SHORT, GL_SHORT, GL_SHORT, GL_SHORT}, false, false, true},
+{GL_RGBA16UI, GL_RGBA_INTEGER, GL_RGBA16UI, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {16, 16, 16, 16}, {GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT}, false, false, true},
+{GL_RGBA16F, GL_RGBA, GL_RGBA16F, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {16, 16, 16, 16}, {GL_HALF_FLOAT, GL_HALF_FLOAT, GL_HALF_FLOAT, GL_HALF_FLOAT}, true, false, true},
 #ifdef GLIP_USE_GL
 {GL_RGBA16_SNORM, GL_RGBA, GL_RGBA16_SNORM, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {16, 16, 16, 16}, {GL_SHORT, GL_SHORT, GL_SHORT, GL_SHORT}, false, false, true},
 #endif
-{GL_RGBA32I, GL_RGBA, GL_RGBA32I, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {32, 32, 32, 32}, {GL_INT, GL_INT, GL_INT, GL_INT}, false, false, true},
-{GL_RGBA32UI, GL_RGBA, GL_RGBA32UI, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {32, 32, 32, 32}, {GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_NONE}, false, false, true},
+{GL_RGBA32I, GL_RGBA_INTEGER, GL_RGBA32I, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {32, 32, 32, 32}, {GL_INT, GL_INT, GL_INT, GL_INT}, false, false, true},
+{GL_RGBA32UI, GL_RGBA_INTEGER, GL_RGBA32UI, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {32, 32, 32, 32}, {GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_NONE}, false, false, true},
 {GL_RGBA32F, GL_RGBA, GL_RGBA32F, ALIAS_GL_COMPRESSED_RGBA, 4, {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA}, {32, 32, 32, 32}, {GL_FLOAT, GL_FLOAT, GL_FLOAT, GL_FLOAT}, true, false, true},
 #ifdef GLIP_USE_GL
 {GL_COMPRESSED_RED, GL_COMPRESSED_RED, GL_RED, GL_COMPRESSED_RED, 1, {GL_RED, GL_NONE, GL_NONE, GL_NONE}, {-1, -1, -1, -1}, {GL_NONE, GL_NONE, GL_NONE, GL_NONE}, false, true, true},
@@ -362,6 +362,7 @@ const HdlTextureFormatDescriptor HdlTextureFormatDescriptorsList::textureFormatD
 				TMP_SIZE(GL_UNSIGNED_SHORT,	GLushort )
 				TMP_SIZE(GL_INT,		GLint )
 				TMP_SIZE(GL_UNSIGNED_INT,	GLuint )
+				TMP_SIZE(GL_HALF_FLOAT,		GLhalf )
 				TMP_SIZE(GL_FLOAT,		GLfloat )
 				#ifdef GLIP_USE_GL
 				TMP_SIZE(GL_DOUBLE,		GLdouble )
@@ -389,6 +390,7 @@ const HdlTextureFormatDescriptor HdlTextureFormatDescriptorsList::textureFormatD
 				TMP_SIZE(GL_UNSIGNED_SHORT,	GLushort )
 				TMP_SIZE(GL_INT,		GLint )
 				TMP_SIZE(GL_UNSIGNED_INT,	GLuint )
+				TMP_SIZE(GL_HALF_FLOAT,		GLhalf )
 				TMP_SIZE(GL_FLOAT,		GLfloat )
 				#ifdef GLIP_USE_GL
 				TMP_SIZE(GL_DOUBLE,		GLdouble )
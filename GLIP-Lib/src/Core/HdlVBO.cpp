@@ -27,6 +27,11 @@
 
 using namespace Glip::CoreGL;
 
+// Static data :
+	const std::string	HdlVBO::positionAttributeName	= "vertexPosition",
+				HdlVBO::normalAttributeName	= "vertexNormal",
+				HdlVBO::texCoordAttributeName	= "vertexTexCoord";
+
 // Tools
 	/**
 	\fn HdlVBO::HdlVBO(int _nVert, int _dim, GLenum freq, const GLfloat* _vertices, int _nElements, int _nIndPerElement, const GLuint* _elements, GLenum _type, const GLfloat* _normals, int _dimTexCoords, const GLfloat* _texcoords)
@@ -55,7 +60,8 @@ using namespace Glip::CoreGL;
 		offsetVertices(0),
 		offsetNormals(0),
 		offsetTexCoords(0),
-		type(_type)
+		type(_type),
+		vertexArray(0)
 	{
 		if(dimTexCoords!=0 && _texcoords==NULL)
 			throw Exception("HdlVBO::HdlVBO - attempt to create texcoords without any data", __FILE__, __LINE__, Exception::GLException);
@@ -91,14 +97,124 @@ using namespace Glip::CoreGL;
 		}
 
 		HdlVBO::unbind();
+
+		// Record the arrays once in a vertex array object :
+		if(isVertexArrayAvailable())
+		{
+			glGenVertexArrays(1, &vertexArray);
+			glBindVertexArray(vertexArray);
+
+			#ifdef GLIP_USE_GL
+				setArrays(!HandleOpenGL::isCoreProfile());
+			#else
+				setArrays(false);
+			#endif
+
+			// The element buffer binding is part of the vertex array state, it must be unbound first :
+			glBindVertexArray(0);
+			HdlVBO::unbind();
+
+			#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+				OPENGL_ERROR_TRACKER("HdlVBO::HdlVBO", "glBindVertexArray()")
+			#endif
+		}
+	}
+
+	/**
+	\fn HdlVBO::HdlVBO(int _nVert)
+	\brief HdlVBO constructor, for an attribute-less object : no buffer is allocated and the vertex shader has to compute the position of each point from gl_VertexID.
+	\param _nVert Number of points drawn.
+	**/
+	HdlVBO::HdlVBO(int _nVert)
+	 :	nVert(_nVert),
+		nElements(0),
+		dim(0),
+		nIndPerElement(0),
+		dimTexCoords(0),
+		hasNormals(false),
+		vertices(NULL),
+		elements(NULL),
+		offsetVertices(0),
+		offsetNormals(0),
+		offsetTexCoords(0),
+		type(GL_POINTS),
+		vertexArray(0)
+	{
+		if(nVert<=0)
+			throw Exception("HdlVBO::HdlVBO - Invalid number of vertices : " + toString(nVert) + ".", __FILE__, __LINE__, Exception::GLException);
+
+		// An empty vertex array object is still required to draw in a core profile :
+		if(isVertexArrayAvailable())
+			glGenVertexArrays(1, &vertexArray);
 	}
 
 	HdlVBO::~HdlVBO(void)
 	{
+		if(vertexArray!=0)
+			glDeleteVertexArrays(1, &vertexArray);
+
 		delete vertices;
 		delete elements;
 	}
 
+	/**
+	\fn void HdlVBO::setArrays(bool legacy)
+	\brief Bind the buffers and describe the arrays as generic vertex attributes (at the locations HdlVBO::positionLocation, HdlVBO::normalLocation and HdlVBO::texCoordLocation).
+	\param legacy If true, also describe the legacy arrays of the fixed pipeline (gl_Vertex, gl_Normal and gl_MultiTexCoord0).
+	**/
+	void HdlVBO::setArrays(bool legacy)
+	{
+		vertices->bind(GL_ARRAY_BUFFER);
+
+		glVertexAttribPointer(positionLocation, dim, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void*>(offsetVertices));
+		glEnableVertexAttribArray(positionLocation);
+
+		if(hasNormals)
+		{
+			glVertexAttribPointer(normalLocation, dim, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void*>(offsetNormals));
+			glEnableVertexAttribArray(normalLocation);
+		}
+		if(dimTexCoords>0)
+		{
+			glVertexAttribPointer(texCoordLocation, dimTexCoords, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void*>(offsetTexCoords));
+			glEnableVertexAttribArray(texCoordLocation);
+		}
+
+		#ifdef GLIP_USE_GL
+		if(legacy)
+		{
+			glVertexPointer(dim, GL_FLOAT, 0, reinterpret_cast<void*>(offsetVertices));
+			glEnableClientState(GL_VERTEX_ARRAY);
+
+			if(hasNormals)
+			{
+				glNormalPointer(GL_FLOAT, 0, reinterpret_cast<void*>(offsetNormals));
+				glEnableClientState(GL_NORMAL_ARRAY);
+			}
+			if(dimTexCoords>0)
+			{
+				glTexCoordPointer(dimTexCoords, GL_FLOAT, 0, reinterpret_cast<void*>(offsetTexCoords));
+				glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+			}
+		}
+		#endif
+
+		if(elements!=NULL)
+			elements->bind(GL_ELEMENT_ARRAY_BUFFER);
+	}
+
+	void HdlVBO::drawElements(int numInstances)
+	{
+		if(elements==NULL && numInstances==1)
+			glDrawArrays(GL_POINTS, 0, nVert);
+		else if(elements==NULL)
+			glDrawArraysInstanced(GL_POINTS, 0, nVert, numInstances);
+		else if(numInstances==1)
+			glDrawElements(type, nElements*nIndPerElement, GL_UNSIGNED_INT, 0);
+		else
+			glDrawElementsInstanced(type, nElements*nIndPerElement, GL_UNSIGNED_INT, 0, numInstances);
+	}
+
 	/**
 	\fn int HdlVBO::getVerticesCount(void)
 	\return The number of vertices.
@@ -114,12 +230,43 @@ using namespace Glip::CoreGL;
 	int HdlVBO::getElementsCount(void)  { return nElements; }
 	GLenum HdlVBO::getType(void)        { return type; }
 
+	/**
+	\fn bool HdlVBO::hasVertexArray(void) const
+	\return True if the arrays are recorded in a vertex array object (they are otherwise set through the legacy arrays at each draw call).
+	**/
+	bool HdlVBO::hasVertexArray(void) const
+	{
+		return vertexArray!=0;
+	}
+
+	/**
+	\fn bool HdlVBO::isAttributeLess(void) const
+	\return True if the object holds no vertex data (see HdlVBO::HdlVBO(int)).
+	**/
+	bool HdlVBO::isAttributeLess(void) const
+	{
+		return vertices==NULL;
+	}
+
 	/**
 	\fn void HdlVBO::draw(void)
 	\brief Draw the VBO according to its data.
 	**/
 	void HdlVBO::draw(void)
 	{
+		if(vertexArray!=0)
+		{
+			glBindVertexArray(vertexArray);
+			drawElements(1);
+			glBindVertexArray(0);
+			return ;
+		}
+		else if(vertices==NULL)
+		{
+			glDrawArrays(GL_POINTS, 0, nVert);
+			return ;
+		}
+
 		#ifdef GLIP_USE_GL
 			// First, bind the data
 			vertices->bind(GL_ARRAY_BUFFER);
@@ -155,6 +302,28 @@ using namespace Glip::CoreGL;
 		#endif
 	}
 
+	/**
+	\fn void HdlVBO::drawInstanced(int numInstances)
+	\brief Draw several instances of the VBO in a single call (the shaders can read the index of the instance in gl_InstanceID).
+	\param numInstances Number of instances to draw.
+	**/
+	void HdlVBO::drawInstanced(int numInstances)
+	{
+		if(numInstances<=0)
+			throw Exception("HdlVBO::drawInstanced - Invalid number of instances : " + toString(numInstances) + ".", __FILE__, __LINE__, Exception::GLException);
+		if(numInstances==1)
+		{
+			draw();
+			return ;
+		}
+		if(vertexArray==0 || !isInstancingAvailable())
+			throw Exception("HdlVBO::drawInstanced - Instanced drawing is not supported by the hardware or the driver.", __FILE__, __LINE__, Exception::GLException);
+
+		glBindVertexArray(vertexArray);
+		drawElements(numInstances);
+		glBindVertexArray(0);
+	}
+
 // Static tools :
 	/**
 	\fn void HdlVBO::unbind(void)
@@ -176,3 +345,35 @@ using namespace Glip::CoreGL;
 		HdlGeBO::unmap(GL_ELEMENT_ARRAY_BUFFER);
 	}
 
+	/**
+	\fn bool HdlVBO::isVertexArrayAvailable(void)
+	\brief Check if the vertex array objects are supported.
+	\return True if the arrays can be recorded in a vertex array object.
+	**/
+	bool HdlVBO::isVertexArrayAvailable(void)
+	{
+		#ifdef GLIP_USE_GL
+			return GLEW_VERSION_3_0 || GLEW_ARB_vertex_array_object;
+		#elif defined(GL_ES_VERSION_3_0)
+			return true;
+		#else
+			return false;
+		#endif
+	}
+
+	/**
+	\fn bool HdlVBO::isInstancingAvailable(void)
+	\brief Check if the instanced drawing is supported.
+	\return True if HdlVBO::drawInstanced can be used.
+	**/
+	bool HdlVBO::isInstancingAvailable(void)
+	{
+		#ifdef GLIP_USE_GL
+			return isVertexArrayAvailable() && (GLEW_VERSION_3_1 || GLEW_ARB_draw_instanced);
+		#elif defined(GL_ES_VERSION_3_0)
+			return true;
+		#else
+			return false;
+		#endif
+	}
+
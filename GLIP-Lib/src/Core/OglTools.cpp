@@ -40,6 +40,11 @@ using namespace Glip::CoreGL;
 		#endif
 		HandleOpenGL* 			HandleOpenGL::instance = NULL;
 		HandleOpenGL::SupportedVendor 	HandleOpenGL::vendor = vd_UNKNOWN;
+		HandleOpenGL::StateCache	HandleOpenGL::stateCache;
+		bool				HandleOpenGL::coreProfile = false;
+
+		// Name of an object whose binding is not known by the state tracker :
+		static const GLuint		unknownName = static_cast<GLuint>(-1);
 
 	// Functions
 		/**
@@ -53,6 +58,8 @@ using namespace Glip::CoreGL;
 			if(instance==NULL)
 			{
 				#ifdef GLIP_USE_GL
+				// Load all the entry points, the extensions are not listed by glGetString in a core profile :
+				glewExperimental = GL_TRUE;
 				GLenum err = glewInit();
 				if(err!=GLEW_OK)
 				{
@@ -60,6 +67,17 @@ using namespace Glip::CoreGL;
 					std::string error((str==NULL) ? "" : str);
 					throw Exception("HandleOpenGL::HandleOpenGL - Failed to init GLEW with the following error : " + error, __FILE__, __LINE__, Exception::GLException);
 				}
+
+				// Discard the error raised by glGetString(GL_EXTENSIONS) in a core profile :
+				glGetError();
+
+				coreProfile = false;
+				if(GLEW_VERSION_3_2)
+				{
+					GLint mask = 0;
+					glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &mask);
+					coreProfile = (mask & GL_CONTEXT_CORE_PROFILE_BIT)!=0;
+				}
 				#endif
 
 				// Update vendor :
@@ -110,6 +128,9 @@ using namespace Glip::CoreGL;
 		{
 			if(instance!=NULL)
 			{
+				// Release the idle textures while the context is still alive :
+				HdlTexturePool::clear();
+
 				delete instance;
 				instance = NULL;
 			}
@@ -249,6 +270,561 @@ using namespace Glip::CoreGL;
 			throw Exception("HdlProgram::getShaderIndex - Unknown shader type : " + getGLEnumNameSafe(shaderType) + ".", __FILE__, __LINE__, Exception::GLException);
 		}
 
+		/**
+		\fn bool HandleOpenGL::isCoreProfile(void)
+		\brief Test if the context is a core profile (without the fixed pipeline and the legacy vertex arrays).
+		\return True if the context was created with a core profile.
+		**/
+		bool HandleOpenGL::isCoreProfile(void)
+		{
+			return coreProfile;
+		}
+
+// State tracker
+	HandleOpenGL::StateCache::StateCache(void)
+	 :	depth(0),
+		issuedCalls(0),
+		skippedCalls(0)
+	{
+		invalidate();
+	}
+
+	void HandleOpenGL::StateCache::invalidate(void)
+	{
+		program		= unknownName;
+		framebuffer	= unknownName;
+		activeUnit	= unknownName;
+		textures.clear();
+		textureTargets.clear();
+		uniformBuffers.clear();
+		drawBuffers.clear();
+		for(int k=0; k<4; k++)
+			viewport[k] = -1;
+		depthTest	= -1;
+		blend		= -1;
+		depthFunction	= GL_INVALID_ENUM;
+		blendSFactor	= GL_INVALID_ENUM;
+		blendDFactor	= GL_INVALID_ENUM;
+		blendEquation	= GL_INVALID_ENUM;
+		clearColorKnown	= false;
+		identityLoaded	= false;
+	}
+
+	/**
+	\fn void HandleOpenGL::beginStateTracking(void)
+	\brief Start a state tracking scope. The current OpenGL state is considered unknown, then the calls made through the tracker are only issued if they change the state. Scopes can be nested.
+	**/
+	void HandleOpenGL::beginStateTracking(void)
+	{
+		if(stateCache.depth==0)
+			stateCache.invalidate();
+
+		stateCache.depth++;
+	}
+
+	/**
+	\fn void HandleOpenGL::endStateTracking(void)
+	\brief End a state tracking scope. When leaving the outermost scope, the deferred unbinding calls are issued : no program, framebuffer or texture stays bound and the first texture unit is active.
+	**/
+	void HandleOpenGL::endStateTracking(void)
+	{
+		if(stateCache.depth==0)
+			return ;
+
+		stateCache.depth--;
+
+		if(stateCache.depth>0)
+			return ;
+
+		for(unsigned int k=0; k<stateCache.textures.size(); k++)
+		{
+			if(stateCache.textures[k]!=0 && stateCache.textures[k]!=unknownName)
+			{
+				#ifdef GLIP_USE_GL
+				glActiveTextureARB(GL_TEXTURE0 + k);
+				#endif
+				glBindTexture(stateCache.textureTargets[k], 0);
+				stateCache.activeUnit = k;
+				stateCache.issuedCalls += 2;
+			}
+		}
+
+		#ifdef GLIP_USE_GL
+		if(stateCache.activeUnit!=0 && stateCache.activeUnit!=unknownName)
+		{
+			glActiveTextureARB(GL_TEXTURE0);
+			stateCache.issuedCalls++;
+		}
+		#endif
+
+		if(stateCache.program!=0 && stateCache.program!=unknownName)
+		{
+			glUseProgram(0);
+			stateCache.issuedCalls++;
+		}
+
+		if(stateCache.framebuffer!=0 && stateCache.framebuffer!=unknownName)
+		{
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			stateCache.issuedCalls++;
+		}
+
+		stateCache.invalidate();
+
+		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+			OPENGL_ERROR_TRACKER("HandleOpenGL::endStateTracking", "glBindFramebuffer()")
+		#endif
+	}
+
+	/**
+	\fn bool HandleOpenGL::isStateTrackingEnabled(void)
+	\brief Test if a state tracking scope is opened.
+	\return True if the calls made through the tracker are filtered.
+	**/
+	bool HandleOpenGL::isStateTrackingEnabled(void)
+	{
+		return stateCache.depth>0;
+	}
+
+	/**
+	\fn void HandleOpenGL::useProgram(GLuint program)
+	\brief Use a program (glUseProgram). Inside a tracking scope, stopping the program (0) is deferred to the end of the scope.
+	\param program The program name (or 0).
+	**/
+	void HandleOpenGL::useProgram(GLuint program)
+	{
+		if(stateCache.depth>0)
+		{
+			if(stateCache.program==program || (program==0 && stateCache.program!=unknownName))
+			{
+				stateCache.skippedCalls++;
+				return ;
+			}
+
+			stateCache.program = program;
+		}
+
+		glUseProgram(program);
+		stateCache.issuedCalls++;
+	}
+
+	/**
+	\fn void HandleOpenGL::bindFramebuffer(GLuint framebuffer)
+	\brief Bind a framebuffer (glBindFramebuffer on GL_FRAMEBUFFER). Inside a tracking scope, unbinding (0) is deferred to the end of the scope.
+	\param framebuffer The framebuffer name (or 0).
+	**/
+	void HandleOpenGL::bindFramebuffer(GLuint framebuffer)
+	{
+		if(stateCache.depth>0)
+		{
+			if(stateCache.framebuffer==framebuffer || (framebuffer==0 && stateCache.framebuffer!=unknownName))
+			{
+				stateCache.skippedCalls++;
+				return ;
+			}
+
+			stateCache.framebuffer = framebuffer;
+		}
+
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		stateCache.issuedCalls++;
+	}
+
+	/**
+	\fn void HandleOpenGL::setDrawBuffers(GLuint framebuffer, int count)
+	\brief Set the draw buffers of the framebuffer currently bound to the first color attachments (glDrawBuffers).
+	\param framebuffer The framebuffer currently bound.
+	\param count The number of color attachments to draw to.
+	**/
+	void HandleOpenGL::setDrawBuffers(GLuint framebuffer, int count)
+	{
+		static const GLenum attachmentsList[] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3, GL_COLOR_ATTACHMENT4,
+							GL_COLOR_ATTACHMENT5, GL_COLOR_ATTACHMENT6, GL_COLOR_ATTACHMENT7, GL_COLOR_ATTACHMENT8, GL_COLOR_ATTACHMENT9,
+							GL_COLOR_ATTACHMENT10, GL_COLOR_ATTACHMENT11, GL_COLOR_ATTACHMENT12, GL_COLOR_ATTACHMENT13,GL_COLOR_ATTACHMENT14, GL_COLOR_ATTACHMENT15};
+
+		if(stateCache.depth>0)
+		{
+			std::map<GLuint, int>::iterator it = stateCache.drawBuffers.find(framebuffer);
+
+			if(it!=stateCache.drawBuffers.end() && it->second==count)
+			{
+				stateCache.skippedCalls++;
+				return ;
+			}
+
+			stateCache.drawBuffers[framebuffer] = count;
+		}
+
+		glDrawBuffers(count, attachmentsList);
+		stateCache.issuedCalls++;
+	}
+
+	/**
+	\fn void HandleOpenGL::setViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+	\brief Set the viewport (glViewport).
+	\param x Lower left corner, horizontal coordinate.
+	\param y Lower left corner, vertical coordinate.
+	\param width Width of the viewport.
+	\param height Height of the viewport.
+	**/
+	void HandleOpenGL::setViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		if(stateCache.depth>0)
+		{
+			if(stateCache.viewport[0]==x && stateCache.viewport[1]==y && stateCache.viewport[2]==width && stateCache.viewport[3]==height)
+			{
+				stateCache.skippedCalls++;
+				return ;
+			}
+
+			stateCache.viewport[0] = x;
+			stateCache.viewport[1] = y;
+			stateCache.viewport[2] = width;
+			stateCache.viewport[3] = height;
+		}
+
+		glViewport(x, y, width, height);
+		stateCache.issuedCalls++;
+	}
+
+	/**
+	\fn bool HandleOpenGL::bindTexture(unsigned int unit, GLuint texture, GLenum target)
+	\brief Bind a texture to a unit. Inside a tracking scope, unbinding (0) is deferred to the end of the scope.
+	\param unit The index of the unit (0 for GL_TEXTURE0).
+	\param texture The texture name (or 0).
+	\param target The texture target (GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY or GL_TEXTURE_3D).
+	\return True if the binding was issued.
+	**/
+	bool HandleOpenGL::bindTexture(unsigned int unit, GLuint texture, GLenum target)
+	{
+		GLenum previousTarget = GL_NONE;
+
+		if(stateCache.depth>0)
+		{
+			if(unit>=stateCache.textures.size())
+			{
+				stateCache.textures.resize(unit+1, unknownName);
+				stateCache.textureTargets.resize(unit+1, GL_TEXTURE_2D);
+			}
+
+			if((stateCache.textures[unit]==texture && (texture==0 || stateCache.textureTargets[unit]==target)) || (texture==0 && stateCache.textures[unit]!=unknownName))
+			{
+				stateCache.skippedCalls++;
+				return false;
+			}
+
+			// A texture bound on another target of the same unit would stay bound after the scope :
+			if(texture!=0 && stateCache.textures[unit]!=0 && stateCache.textures[unit]!=unknownName && stateCache.textureTargets[unit]!=target)
+				previousTarget = stateCache.textureTargets[unit];
+
+			stateCache.textures[unit] = texture;
+			if(texture!=0)
+				stateCache.textureTargets[unit] = target;
+		}
+
+		#ifdef GLIP_USE_GL
+		if(stateCache.depth==0 || stateCache.activeUnit!=unit)
+		{
+			glActiveTextureARB(GL_TEXTURE0 + unit);
+			stateCache.issuedCalls++;
+			if(stateCache.depth>0)
+				stateCache.activeUnit = unit;
+		}
+		else
+			stateCache.skippedCalls++;
+		#endif
+
+		if(previousTarget!=GL_NONE)
+		{
+			glBindTexture(previousTarget, 0);
+			stateCache.issuedCalls++;
+		}
+
+		glBindTexture(target, texture);
+		stateCache.issuedCalls++;
+
+		return true;
+	}
+
+	/**
+	\fn bool HandleOpenGL::bindTexture(GLuint texture)
+	\brief Bind a texture (GL_TEXTURE_2D) to the active unit (to the first unit if it is not known, inside a tracking scope).
+	\param texture The texture name (or 0).
+	\return True if the binding was issued.
+	**/
+	bool HandleOpenGL::bindTexture(GLuint texture)
+	{
+		return bindTextureTarget(GL_TEXTURE_2D, texture);
+	}
+
+	/**
+	\fn bool HandleOpenGL::bindTextureTarget(GLenum target, GLuint texture)
+	\brief Bind a texture to the active unit (to the first unit if it is not known, inside a tracking scope).
+	\param target The texture target (GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY or GL_TEXTURE_3D).
+	\param texture The texture name (or 0).
+	\return True if the binding was issued.
+	**/
+	bool HandleOpenGL::bindTextureTarget(GLenum target, GLuint texture)
+	{
+		if(stateCache.depth>0)
+			return bindTexture((stateCache.activeUnit!=unknownName) ? stateCache.activeUnit : 0, texture, target);
+
+		glBindTexture(target, texture);
+		stateCache.issuedCalls++;
+
+		return true;
+	}
+
+	/**
+	\fn void HandleOpenGL::setCapability(GLenum capability, bool enabled)
+	\brief Enable or disable a capability (glEnable/glDisable). Only GL_DEPTH_TEST and GL_BLEND are tracked.
+	\param capability The capability.
+	\param enabled The new state.
+	**/
+	void HandleOpenGL::setCapability(GLenum capability, bool enabled)
+	{
+		int* state = NULL;
+
+		if(capability==GL_DEPTH_TEST)
+			state = &stateCache.depthTest;
+		else if(capability==GL_BLEND)
+			state = &stateCache.blend;
+
+		if(stateCache.depth>0 && state!=NULL)
+		{
+			if(*state==(enabled ? 1 : 0))
+			{
+				stateCache.skippedCalls++;
+				return ;
+			}
+
+			*state = enabled ? 1 : 0;
+		}
+
+		if(enabled)
+			glEnable(capability);
+		else
+			glDisable(capability);
+		stateCache.issuedCalls++;
+	}
+
+	/**
+	\fn void HandleOpenGL::setDepthFunction(GLenum function)
+	\brief Set the depth comparison function (glDepthFunc).
+	\param function The comparison function.
+	**/
+	void HandleOpenGL::setDepthFunction(GLenum function)
+	{
+		if(stateCache.depth>0)
+		{
+			if(stateCache.depthFunction==function)
+			{
+				stateCache.skippedCalls++;
+				return ;
+			}
+
+			stateCache.depthFunction = function;
+		}
+
+		glDepthFunc(function);
+		stateCache.issuedCalls++;
+	}
+
+	/**
+	\fn void HandleOpenGL::setBlending(GLenum sFactor, GLenum dFactor, GLenum equation)
+	\brief Set the blending function and equation (glBlendFunc and glBlendEquation).
+	\param sFactor Source factor.
+	\param dFactor Destination factor.
+	\param equation Blending equation.
+	**/
+	void HandleOpenGL::setBlending(GLenum sFactor, GLenum dFactor, GLenum equation)
+	{
+		if(stateCache.depth>0 && stateCache.blendSFactor==sFactor && stateCache.blendDFactor==dFactor)
+			stateCache.skippedCalls++;
+		else
+		{
+			glBlendFunc(sFactor, dFactor);
+			stateCache.issuedCalls++;
+		}
+
+		if(stateCache.depth>0 && stateCache.blendEquation==equation)
+			stateCache.skippedCalls++;
+		else
+		{
+			glBlendEquation(equation);
+			stateCache.issuedCalls++;
+		}
+
+		if(stateCache.depth>0)
+		{
+			stateCache.blendSFactor		= sFactor;
+			stateCache.blendDFactor		= dFactor;
+			stateCache.blendEquation	= equation;
+		}
+	}
+
+	/**
+	\fn void HandleOpenGL::setClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+	\brief Set the clear color (glClearColor).
+	\param red Red component.
+	\param green Green component.
+	\param blue Blue component.
+	\param alpha Alpha component.
+	**/
+	void HandleOpenGL::setClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+	{
+		if(stateCache.depth>0)
+		{
+			if(stateCache.clearColorKnown && stateCache.clearColor[0]==red && stateCache.clearColor[1]==green && stateCache.clearColor[2]==blue && stateCache.clearColor[3]==alpha)
+			{
+				stateCache.skippedCalls++;
+				return ;
+			}
+
+			stateCache.clearColorKnown	= true;
+			stateCache.clearColor[0]	= red;
+			stateCache.clearColor[1]	= green;
+			stateCache.clearColor[2]	= blue;
+			stateCache.clearColor[3]	= alpha;
+		}
+
+		glClearColor(red, green, blue, alpha);
+		stateCache.issuedCalls++;
+	}
+
+	/**
+	\fn void HandleOpenGL::loadIdentity(void)
+	\brief Load the identity in the current matrix (glLoadIdentity, no effect if the fixed pipeline is not available).
+	**/
+	void HandleOpenGL::loadIdentity(void)
+	{
+		#ifdef GLIP_USE_GL
+		if(coreProfile)
+			return ;
+
+		if(stateCache.depth>0)
+		{
+			if(stateCache.identityLoaded)
+			{
+				stateCache.skippedCalls++;
+				return ;
+			}
+
+			stateCache.identityLoaded = true;
+		}
+
+		glLoadIdentity();
+		stateCache.issuedCalls++;
+		#endif
+	}
+
+	/**
+	\fn void HandleOpenGL::bindUniformBuffer(unsigned int index, GLuint buffer)
+	\brief Bind a buffer to a uniform block binding point (glBindBufferBase with GL_UNIFORM_BUFFER).
+	\param index The index of the binding point.
+	\param buffer The buffer name.
+	**/
+	void HandleOpenGL::bindUniformBuffer(unsigned int index, GLuint buffer)
+	{
+		if(stateCache.depth>0)
+		{
+			if(index>=stateCache.uniformBuffers.size())
+				stateCache.uniformBuffers.resize(index+1, unknownName);
+
+			if(stateCache.uniformBuffers[index]==buffer)
+			{
+				stateCache.skippedCalls++;
+				return ;
+			}
+
+			stateCache.uniformBuffers[index] = buffer;
+		}
+
+		glBindBufferBase(GL_UNIFORM_BUFFER, index, buffer);
+		stateCache.issuedCalls++;
+	}
+
+	/**
+	\fn void HandleOpenGL::forgetProgram(GLuint program)
+	\brief Notify the tracker that a program is about to be deleted.
+	\param program The program name.
+	**/
+	void HandleOpenGL::forgetProgram(GLuint program)
+	{
+		if(stateCache.program==program)
+			stateCache.program = unknownName;
+	}
+
+	/**
+	\fn void HandleOpenGL::forgetFramebuffer(GLuint framebuffer)
+	\brief Notify the tracker that a framebuffer is about to be deleted.
+	\param framebuffer The framebuffer name.
+	**/
+	void HandleOpenGL::forgetFramebuffer(GLuint framebuffer)
+	{
+		if(stateCache.framebuffer==framebuffer)
+			stateCache.framebuffer = unknownName;
+		stateCache.drawBuffers.erase(framebuffer);
+	}
+
+	/**
+	\fn void HandleOpenGL::forgetTexture(GLuint texture)
+	\brief Notify the tracker that a texture is about to be deleted.
+	\param texture The texture name.
+	**/
+	void HandleOpenGL::forgetTexture(GLuint texture)
+	{
+		for(std::vector<GLuint>::iterator it=stateCache.textures.begin(); it!=stateCache.textures.end(); it++)
+		{
+			if((*it)==texture)
+				(*it) = unknownName;
+		}
+	}
+
+	/**
+	\fn void HandleOpenGL::forgetBuffer(GLuint buffer)
+	\brief Notify the tracker that a buffer object is about to be deleted.
+	\param buffer The buffer name.
+	**/
+	void HandleOpenGL::forgetBuffer(GLuint buffer)
+	{
+		for(std::vector<GLuint>::iterator it=stateCache.uniformBuffers.begin(); it!=stateCache.uniformBuffers.end(); it++)
+		{
+			if((*it)==buffer)
+				(*it) = unknownName;
+		}
+	}
+
+	/**
+	\fn unsigned int HandleOpenGL::getNumIssuedStateCalls(void)
+	\brief Get the number of OpenGL calls issued through the state tracker since the last reset.
+	\return The number of calls issued.
+	**/
+	unsigned int HandleOpenGL::getNumIssuedStateCalls(void)
+	{
+		return stateCache.issuedCalls;
+	}
+
+	/**
+	\fn unsigned int HandleOpenGL::getNumSkippedStateCalls(void)
+	\brief Get the number of OpenGL calls skipped (redundant or deferred) by the state tracker since the last reset.
+	\return The number of calls skipped.
+	**/
+	unsigned int HandleOpenGL::getNumSkippedStateCalls(void)
+	{
+		return stateCache.skippedCalls;
+	}
+
+	/**
+	\fn void HandleOpenGL::resetStateCallsCounters(void)
+	\brief Reset the counters of the state tracker.
+	**/
+	void HandleOpenGL::resetStateCallsCounters(void)
+	{
+		stateCache.issuedCalls	= 0;
+		stateCache.skippedCalls	= 0;
+	}
+
 // Errors Monitoring
 	/**
 	\fn std::string Glip::CoreGL::getGLErrorDescription(const GLenum& e)
@@ -295,7 +871,7 @@ using namespace Glip::CoreGL;
 	/**
 	\fn void Glip::CoreGL::debugGL(void)
 	\related HandleOpenGL
-	\brief Print the current binding points state on std::cout (GL_TEXTURE_BINDING_1D, GL_TEXTURE_BINDING_2D, GL_TEXTURE_BINDING_3D, GL_ARRAY_BUFFER_BINDING, GL_ELEMENT_ARRAY_BUFFER_BINDING, GL_PIXEL_PACK_BUFFER_BINDING, GL_PIXEL_UNPACK_BUFFER_BINDING, GL_FRAMEBUFFER_BINDING, GL_TEXTURE_BUFFER_EXT, GL_CURRENT_PROGRAM).
+	\brief Print the current binding points state on std::cout (GL_TEXTURE_BINDING_1D, GL_TEXTURE_BINDING_2D, GL_TEXTURE_BINDING_2D_ARRAY, GL_TEXTURE_BINDING_3D, GL_ARRAY_BUFFER_BINDING, GL_ELEMENT_ARRAY_BUFFER_BINDING, GL_PIXEL_PACK_BUFFER_BINDING, GL_PIXEL_UNPACK_BUFFER_BINDING, GL_FRAMEBUFFER_BINDING, GL_TEXTURE_BUFFER_EXT, GL_CURRENT_PROGRAM).
 	**/
 	void Glip::CoreGL::debugGL(void)
 	{
@@ -312,6 +888,9 @@ using namespace Glip::CoreGL;
 		glGetIntegerv(GL_TEXTURE_BINDING_2D, &param);
 		if(param!=0) std::cout << "  Binding - Texture 2D     : " << param << std::endl;
 
+		glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY, &param);
+		if(param!=0) std::cout << "  Binding - Texture 2D Ar. : " << param << std::endl;
+
 		glGetIntegerv(GL_TEXTURE_BINDING_3D, &param);
 		if(param!=0) std::cout << "  Binding - Texture 3D     : " << param << std::endl;
 
@@ -376,6 +955,7 @@ using namespace Glip::CoreGL;
 		KEYWORD_PAIR( GL_TEXTURE_1D )
 		#endif
 		KEYWORD_PAIR( GL_TEXTURE_2D )
+		KEYWORD_PAIR( GL_TEXTURE_2D_ARRAY )
 		KEYWORD_PAIR( GL_TEXTURE_3D )
 		KEYWORD_PAIR( GL_TEXTURE_CUBE_MAP_POSITIVE_X )
 		KEYWORD_PAIR( GL_TEXTURE_CUBE_MAP_NEGATIVE_X )
@@ -592,6 +1172,7 @@ using namespace Glip::CoreGL;
 		KEYWORD_PAIR( GL_SHORT )
 		KEYWORD_PAIR( GL_UNSIGNED_INT )
 		KEYWORD_PAIR( GL_INT )
+		KEYWORD_PAIR( GL_HALF_FLOAT )
 		KEYWORD_PAIR( GL_FLOAT )
 		#ifdef GLIP_USE_GL
 		KEYWORD_PAIR( GL_DOUBLE )
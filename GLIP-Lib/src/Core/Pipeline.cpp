@@ -22,12 +22,17 @@
 **/
 
 #include <limits>
+#include <algorithm>
 #include <map>
+#include <fstream>
+#include <sstream>
 #include "Core/Exception.hpp"
 #include "Core/Pipeline.hpp"
 #include "Core/Component.hpp"
 #include "Core/HdlFBO.hpp"
 #include "Core/ShaderSource.hpp"
+#include "Core/HdlShader.hpp"
+#include "Core/Geometry.hpp"
 #include "devDebugTools.hpp"
 
 	using namespace Glip::CoreGL;
@@ -870,9 +875,12 @@
 
 // Pipeline::BuffersCell
 	Pipeline::BuffersCell::BuffersCell(const BufferFormatsCell& bufferFormats)
+	 :	generationCounter(0)
 	{
 		for(unsigned int k=0; k<bufferFormats.formats.size(); k++)
 			buffersList.push_back( new HdlFBO(bufferFormats.formats[k], bufferFormats.outputCounts[k]) );
+
+		buffersOwners.assign(buffersList.size(), -1);
 	}
 
 	Pipeline::BuffersCell::~BuffersCell(void)
@@ -892,46 +900,117 @@
 		AbstractPipelineLayout(p), 
 		Component(p, "(Intermediate : " + name + ")"), 
 		currentCell(NULL),
+		buildFlags(DefaultBuild),
 		perfsMonitoring(false), 	
-		queryObject(0)
+		incrementalProcessing(false),
+		numProcessedActions(0),
+		queryCurrentSlot(0),
+		perfsReady(false),
+		timelineRecording(false),
+		timelineMaxFrames(0),
+		timelineFrame(0),
+		ticketsCounter(1)
 	{
 		UNUSED_PARAMETER(fake)
 	}
 
 	/**
-	\fn Pipeline::Pipeline(const AbstractPipelineLayout& p, const std::string& name)
+	\fn Pipeline::Pipeline(const AbstractPipelineLayout& p, const std::string& name, int buildOptions)
 	\brief Pipeline constructor.
 	\param p Pipeline layout.
 	\param name Name of the pipeline.
+	\param buildOptions Combination of Pipeline::BuildOption flags.
 	**/
-	Pipeline::Pipeline(const AbstractPipelineLayout& p, const std::string& name)
+	Pipeline::Pipeline(const AbstractPipelineLayout& p, const std::string& name, int buildOptions)
 	 :	AbstractComponentLayout(p), 
 		AbstractPipelineLayout(p), 
 		Component(p, name),
 		currentCell(NULL), 
+		buildFlags(buildOptions),
 		perfsMonitoring(false), 
-		queryObject(0) 
+		incrementalProcessing(false),
+		numProcessedActions(0),
+		queryCurrentSlot(0),
+		perfsReady(false),
+		timelineRecording(false),
+		timelineMaxFrames(0),
+		timelineFrame(0),
+		ticketsCounter(1)
 	{
 		cleanInput();
 
 		firstRun 	= true;
 		broken		= true; // Wait for complete initialization.
 
+		std::vector<AbstractFilterLayout*> 	filterLayouts;
+		std::vector<std::string>		filterNames;
+		std::vector<FusedFilterMember>		fusedMembers;
+
 		try
 		{
 			std::vector<Connection> connections;
 			int idx = THIS_PIPELINE;
-			build(idx, filtersList, filtersGlobalIDsList, connections, *this);
+			build(idx, filterLayouts, filterNames, filtersGlobalIDsList, connections, *this);
+
+			if((buildOptions & PruneUnusedFilters)!=0)
+				pruneFilters(filterLayouts, filterNames, connections);
+
+			if((buildOptions & FusePointwiseFilters)!=0)
+				fuseFilters(idx, filterLayouts, filterNames, connections, fusedMembers);
+
+			// Create the filters (compile the shaders) :
+			for(unsigned int k=0; k<filterLayouts.size(); k++)
+			{
+				try
+				{
+					filtersList.push_back(new Filter(*filterLayouts[k], filterNames[k]));
+				}
+				catch(Exception& e)
+				{
+					Exception m("Pipeline::Pipeline - Error while building the filter " + filterNames[k] + " : ", __FILE__, __LINE__, Exception::CoreException);
+					m << e;
+					throw m;
+				}
+			}
+
+			// Give access to the uniform variables of the filters which were fused :
+			for(std::vector<FusedFilterMember>::const_iterator it=fusedMembers.begin(); it!=fusedMembers.end(); it++)
+			{
+				fusedMembersList.push_back(new Filter(*it->layout, it->name, *filtersList[it->hostIdx], it->uniformsPrefix));
+				fusedMembersGlobalIDsList[it->globalID] = fusedMembersList.size()-1;
+				fusedMembersHostsList.push_back(it->hostIdx);
+			}
+
 			allocateBuffers(connections);
+
+			// Create the first cell and link it :
+			changeTargetBuffersCell(createBuffersCell());
 		}
 		catch(Exception& e)
 		{
+			for(std::vector<AbstractFilterLayout*>::iterator it=filterLayouts.begin(); it!=filterLayouts.end(); it++)
+				delete (*it);
+			for(std::vector<FusedFilterMember>::iterator it=fusedMembers.begin(); it!=fusedMembers.end(); it++)
+				delete it->layout;
+			for(std::vector<Filter*>::iterator it=fusedMembersList.begin(); it!=fusedMembersList.end(); it++)
+				delete (*it);
+			fusedMembersList.clear();
+			fusedMembersHostsList.clear();
+			for(std::vector<Filter*>::iterator it=filtersList.begin(); it!=filtersList.end(); it++)
+				delete (*it);
+			filtersList.clear();
+
 			//std::cout << "in Pipeline : " << std::endl << e.what() << std::endl;
 			Exception m("Exception caught while building Pipeline " + getFullName() + " : ", __FILE__, __LINE__, Exception::CoreException);
 			m << e;
 			throw m;
 		}
 
+		for(std::vector<AbstractFilterLayout*>::iterator it=filterLayouts.begin(); it!=filterLayouts.end(); it++)
+			delete (*it);
+		for(std::vector<FusedFilterMember>::iterator it=fusedMembers.begin(); it!=fusedMembers.end(); it++)
+			delete it->layout;
+
 		broken		= false;
 	}
 
@@ -947,12 +1026,18 @@
 		}		
 		cells.clear();
 
+		// The views on the programs must be deleted first :
+		for(std::vector<Filter*>::iterator it = fusedMembersList.begin(); it!=fusedMembersList.end(); it++)
+			delete (*it);
+		fusedMembersList.clear();
+
 		for(std::vector<Filter*>::iterator it = filtersList.begin(); it!=filtersList.end(); it++)
 			delete (*it);
 		filtersList.clear();
 
-		if(queryObject>0)
-			glDeleteQueries(1, &queryObject);
+		releasePerfsQueries();
+		clearTimeline();
+		releaseTickets();
 	}
 
 	/**
@@ -964,7 +1049,11 @@
 		inputsList.clear();
 	}
 
-	void Pipeline::build(int& currentIdx, std::vector<Filter*>& filters, std::map<int, int>& filtersGlobalID, std::vector<Connection>& connections, AbstractPipelineLayout& originalLayout)
+	/**
+	\fn void Pipeline::build(int& currentIdx, std::vector<AbstractFilterLayout*>& filterLayouts, std::vector<std::string>& filterNames, std::map<int, int>& filtersGlobalID, std::vector<Connection>& connections, AbstractPipelineLayout& originalLayout)
+	\brief Flatten the layout : list all the filters (the filters are not created at this point) and shorten all the connections.
+	**/
+	void Pipeline::build(int& currentIdx, std::vector<AbstractFilterLayout*>& filterLayouts, std::vector<std::string>& filterNames, std::map<int, int>& filtersGlobalID, std::vector<Connection>& connections, AbstractPipelineLayout& originalLayout)
 	{
 		#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
 			std::cout << "BUILD" << std::endl;
@@ -995,14 +1084,15 @@
 					originalLayout.setElementID(k, currentIdx);
 					localToGlobalIdx.push_back(currentIdx);
 
-					filters.push_back(new Filter(filterLayout(k), getElementName(k)));
+					filterLayouts.push_back(new AbstractFilterLayout(filterLayout(k)));
+					filterNames.push_back(getElementName(k));
 
 					// Save the link to the global ID :
-					filtersGlobalID[currentIdx] = filters.size()-1;
+					filtersGlobalID[currentIdx] = filterLayouts.size()-1;
 
 					currentIdx++;
 					#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
-						std::cout << "    Adding : " << filters.back()->getFullName() << std::endl;
+						std::cout << "    Adding : " << filterNames.back() << std::endl;
 						std::cout << "    ID     : " << originalLayout.getElementID(k) << std::endl;
 					#endif
 				}
@@ -1016,7 +1106,7 @@
 
 					// Create a sub-pipeline :
 					Pipeline tmpPipeline( pipelineLayout(k), getElementName(k), false);
-					tmpPipeline.build(currentIdx, filters, filtersGlobalID, localConnections, pipelineLayout(k));
+					tmpPipeline.build(currentIdx, filterLayouts, filterNames, filtersGlobalID, localConnections, pipelineLayout(k));
 
 					currentIdx++;
 					#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
@@ -1148,6 +1238,451 @@
 		#endif
 	}
 
+	/**
+	\fn void Pipeline::pruneFilters(std::vector<AbstractFilterLayout*>& filterLayouts, std::vector<std::string>& filterNames, std::vector<Connection>& connections)
+	\brief Remove the filters whose outputs do not reach any output port of this pipeline (directly or through other filters).
+	**/
+	void Pipeline::pruneFilters(std::vector<AbstractFilterLayout*>& filterLayouts, std::vector<std::string>& filterNames, std::vector<Connection>& connections)
+	{
+		const int 		numFilters = filterLayouts.size();
+		std::vector<bool> 	alive(numFilters, false);
+		std::vector<int>	stack,
+					newIndex(numFilters, -1);
+
+		// Walk back from the outputs of the pipeline :
+		for(std::vector<Connection>::const_iterator it=connections.begin(); it!=connections.end(); it++)
+		{
+			if(it->idIn==THIS_PIPELINE && it->idOut!=THIS_PIPELINE && !alive[ filtersGlobalIDsList[it->idOut] ])
+			{
+				alive[ filtersGlobalIDsList[it->idOut] ] = true;
+				stack.push_back( filtersGlobalIDsList[it->idOut] );
+			}
+		}
+
+		while(!stack.empty())
+		{
+			const int fIdx = stack.back();
+			stack.pop_back();
+
+			for(std::vector<Connection>::const_iterator it=connections.begin(); it!=connections.end(); it++)
+			{
+				if(it->idIn!=THIS_PIPELINE && it->idOut!=THIS_PIPELINE && filtersGlobalIDsList[it->idIn]==fIdx && !alive[ filtersGlobalIDsList[it->idOut] ])
+				{
+					alive[ filtersGlobalIDsList[it->idOut] ] = true;
+					stack.push_back( filtersGlobalIDsList[it->idOut] );
+				}
+			}
+		}
+
+		// Remove the connections feeding the dead filters (no connection can leave a dead filter to a living one) :
+		for(std::vector<Connection>::iterator it=connections.begin(); it!=connections.end(); )
+		{
+			if(it->idIn!=THIS_PIPELINE && !alive[ filtersGlobalIDsList[it->idIn] ])
+				it = connections.erase(it);
+			else
+				it++;
+		}
+
+		// Compact the lists :
+		int count = 0;
+		for(int k=0; k<numFilters; k++)
+		{
+			if(alive[k])
+			{
+				filterLayouts[count] 	= filterLayouts[k];
+				filterNames[count]	= filterNames[k];
+				newIndex[k]		= count;
+				count++;
+			}
+			else
+			{
+				#ifdef __GLIPLIB_VERBOSE__
+					std::cout << "Pipeline::pruneFilters - Removing filter " << filterNames[k] << " from pipeline " << getFullName() << "." << std::endl;
+				#endif
+
+				prunedFiltersList.push_back(filterNames[k]);
+				delete filterLayouts[k];
+			}
+		}
+		filterLayouts.resize(count);
+		filterNames.resize(count);
+
+		for(std::map<int, int>::iterator it=filtersGlobalIDsList.begin(); it!=filtersGlobalIDsList.end(); )
+		{
+			if(newIndex[it->second]<0)
+				filtersGlobalIDsList.erase(it++);
+			else
+			{
+				it->second = newIndex[it->second];
+				it++;
+			}
+		}
+	}
+
+	/**
+	\fn bool Pipeline::isFusableFilterLayout(const AbstractFilterLayout& layout)
+	\brief Test if a filter layout can be merged with other ones (fragment shader only, standard geometry drawn once, single layer output, no blending and no depth testing).
+	\param layout The filter layout.
+	\return True if the filter can be merged.
+	**/
+	bool Pipeline::isFusableFilterLayout(const AbstractFilterLayout& layout)
+	{
+		#ifdef GLIP_USE_GL
+			const GLenum otherShaderTypes[] = {GL_VERTEX_SHADER, GL_COMPUTE_SHADER, GL_TESS_CONTROL_SHADER, GL_TESS_EVALUATION_SHADER, GL_GEOMETRY_SHADER};
+		#else
+			const GLenum otherShaderTypes[] = {GL_VERTEX_SHADER, GL_COMPUTE_SHADER};
+		#endif
+		const ShaderSource* fragmentSource = layout.getShaderSource(GL_FRAGMENT_SHADER);
+
+		if(fragmentSource==NULL || fragmentSource->requiresCompatibility())
+			return false;
+
+		for(unsigned int k=0; k<(sizeof(otherShaderTypes)/sizeof(GLenum)); k++)
+		{
+			if(layout.getShaderSource(otherShaderTypes[k])!=NULL)
+				return false;
+		}
+
+		return layout.isStandardGeometryModel() && layout.getNumInstances()==1 && !layout.isLayered() && !layout.isBlendingEnabled() && !layout.isDepthTestingEnabled();
+	}
+
+	/**
+	\fn bool Pipeline::haveSameSources(const AbstractFilterLayout& a, const AbstractFilterLayout& b)
+	\brief Test if two filter layouts have the same shaders (thus the same program).
+	\param a The first filter layout.
+	\param b The second filter layout.
+	\return True if all the shaders sources are identical.
+	**/
+	bool Pipeline::haveSameSources(const AbstractFilterLayout& a, const AbstractFilterLayout& b)
+	{
+		#ifdef GLIP_USE_GL
+			const GLenum shaderTypes[] = {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_COMPUTE_SHADER, GL_TESS_CONTROL_SHADER, GL_TESS_EVALUATION_SHADER, GL_GEOMETRY_SHADER};
+		#else
+			const GLenum shaderTypes[] = {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_COMPUTE_SHADER};
+		#endif
+
+		for(unsigned int k=0; k<(sizeof(shaderTypes)/sizeof(GLenum)); k++)
+		{
+			const ShaderSource	*sa = a.getShaderSource(shaderTypes[k]),
+						*sb = b.getShaderSource(shaderTypes[k]);
+
+			if((sa==NULL)!=(sb==NULL) || (sa!=NULL && sa->getSource()!=sb->getSource()))
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	\fn bool Pipeline::haveSameSettings(const AbstractFilterLayout& a, const AbstractFilterLayout& b)
+	\brief Test if two filter layouts have the same ports, geometry and rendering settings (their output formats are not compared).
+	\param a The first filter layout.
+	\param b The second filter layout.
+	\return True if the filters only differ by their shaders or their output formats.
+	**/
+	bool Pipeline::haveSameSettings(const AbstractFilterLayout& a, const AbstractFilterLayout& b)
+	{
+		if(a.getNumInputPort()!=b.getNumInputPort() || a.getNumOutputPort()!=b.getNumOutputPort())
+			return false;
+
+		for(int k=0; k<a.getNumInputPort(); k++)
+		{
+			if(a.getInputPortName(k)!=b.getInputPortName(k))
+				return false;
+		}
+
+		for(int k=0; k<a.getNumOutputPort(); k++)
+		{
+			if(a.getOutputPortName(k)!=b.getOutputPortName(k))
+				return false;
+		}
+
+		if(a.isClearingEnabled()!=b.isClearingEnabled() || a.isBlendingEnabled()!=b.isBlendingEnabled() || a.isDepthTestingEnabled()!=b.isDepthTestingEnabled())
+			return false;
+
+		if(a.isBlendingEnabled() && (a.getSFactor()!=b.getSFactor() || a.getDFactor()!=b.getDFactor() || a.getBlendingEquation()!=b.getBlendingEquation()))
+			return false;
+
+		if(a.isDepthTestingEnabled() && a.getDepthTestingFunction()!=b.getDepthTestingFunction())
+			return false;
+
+		if(a.getComputeDomain()!=b.getComputeDomain() || a.getNumInstances()!=b.getNumInstances())
+			return false;
+
+		if(a.isComputeFilter())
+			return a.getGLMode()==b.getGLMode();
+		else
+			return a.isStandardGeometryModel()==b.isStandardGeometryModel() && a.getGeometryModel()==b.getGeometryModel();
+	}
+
+	/**
+	\fn std::string Pipeline::getStoreConversion(const HdlAbstractTextureFormat& format)
+	\brief Get the GLSL expression emulating the storage of a vec4 v in a texture of the given format (clamping, quantization of the normalized formats and missing channels).
+	\param format The format of the texture.
+	\return The expression or an empty string if the format is not supported (integer or compressed formats).
+	**/
+	std::string Pipeline::getStoreConversion(const HdlAbstractTextureFormat& format)
+	{
+		const GLenum supportedModes[] = {	GL_RED, GL_RG, GL_RGB, GL_RGBA, GL_R8, GL_RG8, GL_RGB8, GL_RGBA8, GL_R16, GL_RG16, GL_RGB16, GL_RGBA16, 
+							GL_R16F, GL_RG16F, GL_RGB16F, GL_RGBA16F, GL_R32F, GL_RG32F, GL_RGB32F, GL_RGBA32F};
+		const GLenum* supportedModesEnd = supportedModes + sizeof(supportedModes)/sizeof(GLenum);
+
+		if(std::find(supportedModes, supportedModesEnd, format.getGLMode())==supportedModesEnd)
+			return "";
+
+		// Normalized formats are clamped and quantized :
+		const HdlTextureFormatDescriptor& descriptor = format.getFormatDescriptor();
+		int bits = descriptor.channelsSizeInBits[0];
+		if(bits<=0)
+			bits = (format.getGLDepth()==GL_UNSIGNED_BYTE) ? 8 : ((format.getGLDepth()==GL_UNSIGNED_SHORT) ? 16 : 0);
+
+		const std::string	maxValue	= toString((1 << bits) - 1) + ".0",
+					value		= descriptor.isFloatingPoint ? "v" : ((bits>0) ? ("(floor(clamp(v, 0.0, 1.0)*" + maxValue + " + 0.5)/" + maxValue + ")") : "clamp(v, 0.0, 1.0)");
+
+		switch(descriptor.numChannels)
+		{
+			case 1 :	return "vec4(" + value + ".r, 0.0, 0.0, 1.0)";
+			case 2 :	return "vec4(" + value + ".rg, 0.0, 1.0)";
+			case 3 :	return "vec4(" + value + ".rgb, 1.0)";
+			case 4 :	return value;
+			default :	return "";
+		}
+	}
+
+	/**
+	\fn void Pipeline::fuseFilters(int& currentIdx, std::vector<AbstractFilterLayout*>& filterLayouts, std::vector<std::string>& filterNames, std::vector<Connection>& connections, std::vector<FusedFilterMember>& members)
+	\brief Merge the chains of filters reading their input only at the current fragment. The layouts of the merged filters are moved to the members list.
+	**/
+	void Pipeline::fuseFilters(int& currentIdx, std::vector<AbstractFilterLayout*>& filterLayouts, std::vector<std::string>& filterNames, std::vector<Connection>& connections, std::vector<FusedFilterMember>& members)
+	{
+		const int 			numFilters = filterLayouts.size();
+		std::vector<int>		globalIDs(numFilters, THIS_PIPELINE),
+						numOutputConnections(numFilters, 0),
+						consumers(numFilters, -1),		// The filter reading the output of a filter which can be merged.
+						roots(numFilters, -1);			// The last filter of the group.
+		std::vector<std::string>	consumedInputs(numFilters);
+		std::vector<bool>		fusable(numFilters, false),
+						removed(numFilters, false);
+
+		for(std::map<int, int>::const_iterator it=filtersGlobalIDsList.begin(); it!=filtersGlobalIDsList.end(); it++)
+			globalIDs[it->second] = it->first;
+
+		for(int k=0; k<numFilters; k++)
+			fusable[k] = isFusableFilterLayout(*filterLayouts[k]);
+
+		for(std::vector<Connection>::const_iterator it=connections.begin(); it!=connections.end(); it++)
+		{
+			if(it->idOut!=THIS_PIPELINE)
+				numOutputConnections[ filtersGlobalIDsList[it->idOut] ]++;
+		}
+
+		// Find the links which can be merged :
+		for(std::vector<Connection>::const_iterator it=connections.begin(); it!=connections.end(); it++)
+		{
+			if(it->idOut==THIS_PIPELINE || it->idIn==THIS_PIPELINE)
+				continue;
+
+			const int 			p = filtersGlobalIDsList[it->idOut],
+							q = filtersGlobalIDsList[it->idIn];
+			const AbstractFilterLayout	&producer = *filterLayouts[p],
+							&consumer = *filterLayouts[q];
+
+			if(	fusable[p] && fusable[q] && numOutputConnections[p]==1 && producer.getNumOutputPort()==1 &&
+				producer.getWidth()==consumer.getWidth() && producer.getHeight()==consumer.getHeight() && 
+				producer.getGLMode()==consumer.getGLMode() && producer.getGLDepth()==consumer.getGLDepth() &&
+				!getStoreConversion(producer).empty() &&
+				producer.getShaderSource(GL_FRAGMENT_SHADER)->getOutputTypes().front()==GL_FLOAT_VEC4 &&
+				consumer.getShaderSource(GL_FRAGMENT_SHADER)->isPointwiseInput(consumer.getInputPortName(it->portIn), consumer.getWidth(), consumer.getHeight()))
+			{
+				consumers[p]		= q;
+				consumedInputs[p]	= consumer.getInputPortName(it->portIn);
+			}
+		}
+
+		for(int k=0; k<numFilters; k++)
+		{
+			if(consumers[k]>=0)
+			{
+				int r = k;
+				while(consumers[r]>=0)
+					r = consumers[r];
+				roots[k] = r;
+				roots[r] = r;
+			}
+		}
+
+		// Build the groups :
+		for(int r=0; r<numFilters; r++)
+		{
+			if(roots[r]!=r)
+				continue;
+
+			// List the members, the producers before their consumer : 
+			std::vector<int> 	order,
+						stack(1, r),
+						expanded(1, 0);
+			while(!stack.empty())
+			{
+				const int x = stack.back();
+
+				if(expanded.back()==0)
+				{
+					expanded.back() = 1;
+					for(int k=numFilters-1; k>=0; k--)
+					{
+						if(consumers[k]==x)
+						{
+							stack.push_back(k);
+							expanded.push_back(0);
+						}
+					}
+				}
+				else
+				{
+					order.push_back(x);
+					stack.pop_back();
+					expanded.pop_back();
+				}
+			}
+
+			std::vector<const ShaderSource*>	sources;
+			std::vector<std::string>		prefixes,
+								inputs;
+			std::vector<int>			orderedConsumers,
+								position(numFilters, -1);
+			std::string				name;
+			int					numInputs = 0;
+
+			for(unsigned int i=0; i<order.size(); i++)
+				position[order[i]] = i;
+
+			for(unsigned int i=0; i<order.size(); i++)
+			{
+				const int k = order[i];
+				sources.push_back(filterLayouts[k]->getShaderSource(GL_FRAGMENT_SHADER));
+				prefixes.push_back("f" + toString(i) + "_");
+				orderedConsumers.push_back((k==r) ? -1 : position[consumers[k]]);
+				inputs.push_back(consumedInputs[k]);
+				name += ((i>0) ? "+" : "") + filterNames[k];
+				numInputs += filterLayouts[k]->getNumInputPort() - ((k==r) ? 0 : 1);
+			}
+
+			if(numInputs>HdlTexture::getMaxImageUnits())
+				continue;
+
+			FilterLayout* layout = NULL;
+			try
+			{
+				const ShaderSource fusedSource = ShaderSource::fuse(sources, prefixes, orderedConsumers, inputs, filterLayouts[r]->getWidth(), filterLayouts[r]->getHeight(), getStoreConversion(*filterLayouts[r]), name);
+				layout = new FilterLayout(name, *filterLayouts[r], fusedSource);
+
+				if(filterLayouts[r]->isClearingEnabled())
+					layout->enableClearing();
+				else
+					layout->disableClearing();
+
+				// The generated code is only compiled once, with the filter (see Pipeline::Pipeline).
+			}
+			catch(Exception& e)
+			{
+				#ifdef __GLIPLIB_VERBOSE__
+					std::cout << "Pipeline::fuseFilters - Cannot merge the filters " << name << " in pipeline " << getFullName() << " : " << std::endl;
+					std::cout << e.what() << std::endl;
+				#endif
+
+				delete layout;
+				continue;
+			}
+
+			#ifdef __GLIPLIB_VERBOSE__
+				std::cout << "Pipeline::fuseFilters - Merging filters " << name << " in pipeline " << getFullName() << "." << std::endl;
+			#endif
+
+			// Register the new filter :
+			const int 	fusedIdx	= filterLayouts.size(),
+					fusedID		= currentIdx++;
+			filterLayouts.push_back(layout);
+			filterNames.push_back(name);
+			filtersGlobalIDsList[fusedID] = fusedIdx;
+
+			// Rewire the connections :
+			for(std::vector<Connection>::iterator it=connections.begin(); it!=connections.end(); )
+			{
+				const int 	p = (it->idOut!=THIS_PIPELINE) ? filtersGlobalIDsList[it->idOut] : -1,
+						q = (it->idIn!=THIS_PIPELINE) ? filtersGlobalIDsList[it->idIn] : -1;
+				const bool	inP = (p>=0 && p<numFilters && roots[p]==r),
+						inQ = (q>=0 && q<numFilters && roots[q]==r);
+
+				if(inP && inQ)
+				{
+					it = connections.erase(it);
+					continue;
+				}
+				
+				if(inQ)
+				{
+					it->portIn	= layout->getInputPortID(prefixes[position[q]] + filterLayouts[q]->getInputPortName(it->portIn));
+					it->idIn	= fusedID;
+				}
+
+				if(inP)
+				{
+					it->portOut	= layout->getOutputPortID(filterLayouts[p]->getOutputPortName(it->portOut));
+					it->idOut	= fusedID;
+				}
+
+				it++;
+			}
+
+			// Move the members :
+			for(unsigned int i=0; i<order.size(); i++)
+			{
+				const int k = order[i];
+				FusedFilterMember member;
+
+				member.layout		= filterLayouts[k];
+				member.name		= filterNames[k];
+				member.uniformsPrefix	= prefixes[i];
+				member.hostIdx		= fusedIdx;
+				member.globalID		= globalIDs[k];
+				members.push_back(member);
+
+				filterLayouts[k]	= NULL;
+				removed[k]		= true;
+			}
+		}
+
+		// Compact the lists :
+		std::vector<int> newIndex(filterLayouts.size(), -1);
+		int count = 0;
+		for(unsigned int k=0; k<filterLayouts.size(); k++)
+		{
+			if(k<removed.size() && removed[k])
+				continue;
+
+			filterLayouts[count] 	= filterLayouts[k];
+			filterNames[count]	= filterNames[k];
+			newIndex[k]		= count;
+			count++;
+		}
+		filterLayouts.resize(count);
+		filterNames.resize(count);
+
+		for(std::map<int, int>::iterator it=filtersGlobalIDsList.begin(); it!=filtersGlobalIDsList.end(); )
+		{
+			if(newIndex[it->second]<0)
+				filtersGlobalIDsList.erase(it++);
+			else
+			{
+				it->second = newIndex[it->second];
+				it++;
+			}
+		}
+
+		for(std::vector<FusedFilterMember>::iterator it=members.begin(); it!=members.end(); it++)
+			it->hostIdx = newIndex[it->hostIdx];
+	}
+
 	void Pipeline::allocateBuffers(std::vector<Connection>& connections)
 	{
 		#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
@@ -1193,220 +1728,204 @@
 		try
 		{
 			// The input is a list of all the connections, untangle, where the ID -1 is reserved for this pipeline.
-			std::vector<Connection> 	remainingConnections = connections;	// The remaining (not processed) connections.
-			std::vector<int>		requestedInputConnections;		// The number of connections not satisfied for this filter.
-			std::vector<int>		bufferOccupancy;			// The number of filter which will use the buffer as inputs.
-			std::vector<ActionHub>		tmpActions;				// The temporary actions list.
-			bool allProcessed = false;
+			// The allocation is made in three steps :
+			// 1 - Choose an execution order which keeps the memory in use as low as possible (greedy, on the bytes allocated and released by each filter).
+			// 2 - Compute the live range of the outputs of each filter over this order (from its own action to the last action reading it, or the end if it is an output of the pipeline).
+			// 3 - Pack the outputs in the buffers with an interval colouring (per format), a buffer being free once the live range of its last content has ended.
+			const int 			numFilters = filtersList.size();
+			std::vector< std::vector<Connection> > inputConnections(numFilters),		// The connections feeding each filter.
+							outputConnections(numFilters);		// The connections leaving each filter (to other filters).
+			std::vector<int>		requestedInputConnections(numFilters, 0),	// The number of connections not satisfied for this filter.
+							remainingUses(numFilters, 0),			// The number of connections reading the outputs of a filter which were not scheduled yet.
+							order,						// The execution order.
+							position(numFilters, -1),			// The position of a filter in the execution order.
+							lastUse(numFilters, -1),			// The last position where the outputs of a filter are read.
+							filterBuffer(numFilters, -1);			// The buffer holding the outputs of a filter.
+			std::vector<bool>		isPipelineOutput(numFilters, false);
+			std::vector<double>		outputSize(numFilters, 0.0);
 
 			// Initialize the outputs :
 			OutputHub blankOutput;
 			blankOutput.bufferIdx = -1;
 			blankOutput.outputIdx = -1;
+			blankOutput.actionIdx = -1;
 			outputsList.assign( getNumOutputPort(), blankOutput );
 
-			// Setup the requirements counters :
-			for(unsigned int k=0; k<filtersList.size(); k++)
+			for(int k=0; k<numFilters; k++)
 			{
-				ActionHub hub;
-
-				hub.inputBufferIdx.assign( filtersList[k]->getNumInputPort(), -1);
-				hub.inputArgumentIdx.assign( filtersList[k]->getNumInputPort(), -1);
-				hub.bufferIdx		= -1;
-				hub.filterIdx 		= k;
-
-				tmpActions.push_back(hub);
-
-				// Set the number of inputs not satisfied to be equal to the number of inputs :
-				requestedInputConnections.push_back( filtersList[k]->getNumInputPort() );
+				requestedInputConnections[k] 	= filtersList[k]->getNumInputPort();
+				outputSize[k]			= static_cast<double>(filtersList[k]->getSize()) * filtersList[k]->getNumOutputPort();
 			}
 
-			// Initialize by decrementing the connections to this pipeline inputs :
-			for(unsigned int k=0; k<remainingConnections.size(); k++)
+			// Sort the connections :
+			for(std::vector<Connection>::const_iterator it=connections.begin(); it!=connections.end(); it++)
 			{
-				if(remainingConnections[k].idOut==THIS_PIPELINE)
+				if(it->idIn==THIS_PIPELINE)
 				{
-					// Set up the links :
-					const int fid = filtersGlobalIDsList[remainingConnections[k].idIn];
+					if(it->idOut!=THIS_PIPELINE)
+						isPipelineOutput[ filtersGlobalIDsList[it->idOut] ] = true;
+				}
+				else
+				{
+					const int fid = filtersGlobalIDsList[it->idIn];
 
-					tmpActions[fid].inputBufferIdx[ remainingConnections[k].portIn ] 	= THIS_PIPELINE;
-					tmpActions[fid].inputArgumentIdx[ remainingConnections[k].portIn ]	= remainingConnections[k].portOut;
-					requestedInputConnections[fid]--;
+					inputConnections[fid].push_back(*it);
 
-					// Remove :
-					remainingConnections.erase( remainingConnections.begin() + k );
-					k--;
+					if(it->idOut==THIS_PIPELINE)
+						requestedInputConnections[fid]--;	// The inputs of this pipeline are always available.
+					else
+					{
+						outputConnections[ filtersGlobalIDsList[it->idOut] ].push_back(*it);
+						remainingUses[ filtersGlobalIDsList[it->idOut] ]++;
+					}
 				}
 			}
 
-			// Generate the final actions list and buffers :
-			do
+			// 1 - Execution order :
+			while(static_cast<int>(order.size())<numFilters)
 			{
+				int 	fIdx		= -1;
+				double 	bestBalance	= 0.0;
 
 				#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
 					std::cout << "    Finding candidates : " << std::endl;
 				#endif
-				// Explore the list to find the possibles solutions :
-				std::vector<int> candidatesIdx;
-				for(unsigned int k=0; k<requestedInputConnections.size(); k++)
+
+				for(int k=0; k<numFilters; k++)
 				{
-					if(requestedInputConnections[k]==0)
+					if(requestedInputConnections[k]!=0)
+						continue;
+
+					// Bytes allocated by this filter minus the bytes released by the buffers it reads for the last time :
+					std::map<int, int> uses;
+					for(std::vector<Connection>::const_iterator it=inputConnections[k].begin(); it!=inputConnections[k].end(); it++)
 					{
-						candidatesIdx.push_back(k);
-						#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
-							std::cout << "        Adding : " << filtersList[k]->getFullName() << std::endl;
-						#endif
+						if(it->idOut!=THIS_PIPELINE)
+							uses[ filtersGlobalIDsList[it->idOut] ]++;
 					}
-				}
-
-				if(candidatesIdx.empty())
-					throw Exception("No available filter matches input conditions.", __FILE__, __LINE__, Exception::CoreException);
 
-				// Find best candidate along the priority order (from highest to lowest) :
-				// 1 - A filter that has exactly the same format as a buffer which is currently unused, this buffer must as large as possible.
-				// 2 - A filter that has the largest format which is not allocated yet.
-				// 3 - A filter that has the smallest format already allocated (but not available).
-				// 4 - (reserved)
-				// 5 - No decision.
-
-				HdlTextureFormat fmt(0,0,GL_RGB,GL_UNSIGNED_BYTE);	// A format (in case we need to create one).
-				int fIdx = -1;						// The index of the filter chosen.
-				int bIdx = -1;						// The buffer index (if one already exists).
-				int currentDecision = 5;				// No decision.
-
-				for(unsigned int k=0; k<candidatesIdx.size(); k++)
-				{
-					// Try to find a match in the buffers :
-					bool noMatch = true;
-					for(int l=0; l<bufferFormats.size(); l++)
+					double balance = outputSize[k];
+					for(std::map<int, int>::const_iterator it=uses.begin(); it!=uses.end(); it++)
 					{
-						// If this buffer is a match :
-						if( *filtersList[ candidatesIdx[k] ] == bufferFormats.formats[l] )
-						{
-							noMatch = false;
-
-							// If this buffer is free :
-							if(bufferOccupancy[l]==0)
-							{
-								// If the current choice is lower in priority or larger in buffer size :
-								if( currentDecision>1 || ((currentDecision==1) && fmt.getSize()<bufferFormats.formats[l].getSize()) )
-								{
-									fIdx = candidatesIdx[k];
-									bIdx = l;
-									currentDecision = 1;
-									fmt = bufferFormats.formats[l];
-								}
-							}
-							else // The buffer is not free :
-							{
-								// If no other choices were made :
-								if(currentDecision>3 || ( (currentDecision==3) && (fmt.getSize()<bufferFormats.formats[l].getSize()) ) )
-								{
-									fIdx = candidatesIdx[k];
-									bIdx = -1;
-									currentDecision = 3;
-									fmt = bufferFormats.formats[l];
-								}
-							}
-						}
+						if(!isPipelineOutput[it->first] && remainingUses[it->first]==it->second)
+							balance -= outputSize[it->first];
 					}
 
-					if(noMatch && currentDecision>=2 && filtersList[ candidatesIdx[k] ]->getSize() > fmt.getSize())
+					#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
+						std::cout << "        Candidate : " << filtersList[k]->getFullName() << " (balance : " << balance << " bytes)" << std::endl;
+					#endif
+
+					if(fIdx<0 || balance<bestBalance)
 					{
-						fIdx = candidatesIdx[k];
-						bIdx = -1;
-						currentDecision = 2;
-						fmt = *filtersList[ candidatesIdx[k] ];
+						fIdx 		= k;
+						bestBalance	= balance;
 					}
 				}
 
-				#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
-					std::cout << "    Decision : " << currentDecision << std::endl;
-					std::cout << "    Filter   : " << filtersList[fIdx]->getFullName() << std::endl;
-					std::cout << "    Buffer   : " << bIdx << std::endl;
-				#endif
+				if(fIdx<0)
+				{
+					if(order.empty())
+						throw Exception("No available filter matches input conditions.", __FILE__, __LINE__, Exception::CoreException);
+					else
+						throw Exception("The pipeline building process is stuck as some elements remains but cannot be integrated as they lack input.", __FILE__, __LINE__, Exception::CoreException);
+				}
 
-				if(currentDecision>=5)
-					throw Exception("No correct decision was made.", __FILE__, __LINE__, Exception::CoreException);
+				// Lock down this filter as "done" :
+				position[fIdx] = order.size();
+				order.push_back(fIdx);
+				requestedInputConnections[fIdx] = -1;
 
-				// Create the action :
-				if(currentDecision==1)
+				for(std::vector<Connection>::const_iterator it=inputConnections[fIdx].begin(); it!=inputConnections[fIdx].end(); it++)
 				{
-					tmpActions[ fIdx ].bufferIdx = bIdx;
-
-					// Push :
-					actionsList.push_back( tmpActions[ fIdx ] );
+					if(it->idOut!=THIS_PIPELINE)
+						remainingUses[ filtersGlobalIDsList[it->idOut] ]--;
 				}
-				else if(currentDecision==2 || currentDecision==3)
-				{
-					// Create a new buffer :
-					bufferFormats.append( fmt, filtersList[ fIdx ]->getNumOutputPort() );
-					bufferOccupancy.push_back(0);
 
-					bIdx = bufferFormats.size()-1;
-					tmpActions[ fIdx ].bufferIdx = bIdx;
+				for(std::vector<Connection>::const_iterator it=outputConnections[fIdx].begin(); it!=outputConnections[fIdx].end(); it++)
+					requestedInputConnections[ filtersGlobalIDsList[it->idIn] ]--;
+			}
 
-					// Push :
-					actionsList.push_back( tmpActions[ fIdx ] );
-				}
+			// 2 - Live ranges :
+			for(int k=0; k<numFilters; k++)
+			{
+				if(isPipelineOutput[k])
+					lastUse[k] = std::numeric_limits<int>::max();
 				else
-					throw Exception("Internal error : Unkown action decision (" + toString(currentDecision) + ").", __FILE__, __LINE__, Exception::CoreException);
-
-				// Find all the buffers read by the current actions and decrease their occupancy :
-				for(unsigned int k=0; k<actionsList.back().inputBufferIdx.size(); k++)
 				{
-					if( actionsList.back().inputBufferIdx[k]!=THIS_PIPELINE )
-						bufferOccupancy[ actionsList.back().inputBufferIdx[k] ]--;
+					lastUse[k] = position[k];
+					for(std::vector<Connection>::const_iterator it=outputConnections[k].begin(); it!=outputConnections[k].end(); it++)
+						lastUse[k] = std::max(lastUse[k], position[ filtersGlobalIDsList[it->idIn] ]);
 				}
+			}
 
-				// Lock down this filter as "done" :
-				requestedInputConnections[fIdx] = -1;
+			// 3 - Interval colouring :
+			std::vector<int> bufferLastUse;	// The last position where the current content of the buffer is read.
+			for(int p=0; p<numFilters; p++)
+			{
+				const int fIdx 		= order[p];
+				const int numOutputs	= filtersList[fIdx]->getNumOutputPort();
+				int bIdx		= -1;
 
-				// Update the buffer occupancy to the new number of output and at the same time decrease the number of requests :
-				for(unsigned int k=0; k<remainingConnections.size(); k++)
+				// Find a free buffer with the same format, preferably one having enough targets :
+				for(int l=0; l<bufferFormats.size(); l++)
 				{
-					if(filtersGlobalIDsList[remainingConnections[k].idOut]==fIdx)
+					if(bufferLastUse[l]<p && *filtersList[fIdx]==bufferFormats.formats[l])
 					{
-						if(remainingConnections[k].idIn==THIS_PIPELINE)
-						{
-							outputsList[ remainingConnections[k].portIn ].bufferIdx 	= bIdx;
-							outputsList[ remainingConnections[k].portIn ].outputIdx		= remainingConnections[k].portOut;
+						if(bIdx<0 || (bufferFormats.outputCounts[bIdx]<numOutputs && bufferFormats.outputCounts[l]>bufferFormats.outputCounts[bIdx]))
+							bIdx = l;
+					}
+				}
 
-							bufferOccupancy[bIdx] = std::numeric_limits<int>::max();
-						}
-						else
-						{
-							// Set up the links :
-							const int fid = filtersGlobalIDsList[remainingConnections[k].idIn];
+				if(bIdx<0)
+				{
+					bufferFormats.append( *filtersList[fIdx], numOutputs );
+					bufferLastUse.push_back(0);
+					bIdx = bufferFormats.size()-1;
+				}
+				else
+					bufferFormats.outputCounts[bIdx] = std::max(bufferFormats.outputCounts[bIdx], numOutputs);
 
-							tmpActions[fid].inputBufferIdx[ remainingConnections[k].portIn ] 	= bIdx;
-							tmpActions[fid].inputArgumentIdx[ remainingConnections[k].portIn ]	= remainingConnections[k].portOut;
-							requestedInputConnections[fid]--;
+				bufferLastUse[bIdx] 	= lastUse[fIdx];
+				filterBuffer[fIdx]	= bIdx;
 
-							// Remove :
-							remainingConnections.erase( remainingConnections.begin() + k );
-							k--;
+				#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
+					std::cout << "    Filter   : " << filtersList[fIdx]->getFullName() << std::endl;
+					std::cout << "    Buffer   : " << bIdx << " (live until action " << lastUse[fIdx] << ")" << std::endl;
+				#endif
 
-							bufferOccupancy[bIdx]++;
-						}
-					}
-				}
+				// Create the action :
+				ActionHub hub;
+
+				hub.inputBufferIdx.assign( filtersList[fIdx]->getNumInputPort(), -1);
+				hub.inputArgumentIdx.assign( filtersList[fIdx]->getNumInputPort(), -1);
+				hub.inputActionIdx.assign( filtersList[fIdx]->getNumInputPort(), THIS_PIPELINE);
+				hub.bufferIdx		= bIdx;
+				hub.filterIdx 		= fIdx;
 
-				// Test if all were processed :
-				allProcessed 	= true;
-				bool noNextStep = true;
-				for(unsigned int k=0; k<requestedInputConnections.size(); k++)
+				for(std::vector<Connection>::const_iterator it=inputConnections[fIdx].begin(); it!=inputConnections[fIdx].end(); it++)
 				{
-					if(requestedInputConnections[k]>=0)
-						allProcessed = false;
-					if(requestedInputConnections[k]==0)
-						noNextStep = false;
+					hub.inputBufferIdx[ it->portIn ]	= (it->idOut==THIS_PIPELINE) ? THIS_PIPELINE : filterBuffer[ filtersGlobalIDsList[it->idOut] ];
+					hub.inputArgumentIdx[ it->portIn ]	= it->portOut;
+					hub.inputActionIdx[ it->portIn ]	= (it->idOut==THIS_PIPELINE) ? THIS_PIPELINE : position[ filtersGlobalIDsList[it->idOut] ];
 				}
 
-				if(noNextStep && !allProcessed)
-					throw Exception("The pipeline building process is stuck as some elements remains but cannot be integrated as they lack input.", __FILE__, __LINE__, Exception::CoreException);
+				actionsList.push_back(hub);
+			}
+
+			// Set up the outputs :
+			for(std::vector<Connection>::const_iterator it=connections.begin(); it!=connections.end(); it++)
+			{
+				if(it->idIn==THIS_PIPELINE && it->idOut!=THIS_PIPELINE)
+				{
+					outputsList[ it->portIn ].bufferIdx = filterBuffer[ filtersGlobalIDsList[it->idOut] ];
+					outputsList[ it->portIn ].outputIdx = it->portOut;
+					outputsList[ it->portIn ].actionIdx = position[ filtersGlobalIDsList[it->idOut] ];
+				}
 			}
-			while(!allProcessed);
+
+			#ifdef __GLIPLIB_VERBOSE__
+				std::cout << "Pipeline::allocateBuffers - " << getFullName() << " : " << bufferFormats.size() << " buffers for " << numFilters << " filters (" << getSize()/(1024.0*1024.0) << "MB instead of " << getNaiveSize()/(1024.0*1024.0) << "MB)." << std::endl;
+			#endif
 
 			// Final tests :
 			if(filtersList.size()!=actionsList.size())
@@ -1426,12 +1945,6 @@
 			throw m;
 		}
 
-		// Create the first cell : 
-		int cellID = createBuffersCell();
-
-		// Link it : 
-		changeTargetBuffersCell(cellID);
-
 		#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
 			std::cout << "END ALLOCATE" << std::endl;
 		#endif
@@ -1447,9 +1960,186 @@
 		return actionsList.size();
 	}
 
+	/**
+	\fn const std::vector<std::string>& Pipeline::getPrunedFilters(void) const
+	\brief Get the names of the filters which were removed at construction (see Pipeline::PruneUnusedFilters).
+	\return The names of the filter instances which were removed.
+	**/
+	const std::vector<std::string>& Pipeline::getPrunedFilters(void) const
+	{
+		return prunedFiltersList;
+	}
+
+	/**
+	\fn int Pipeline::reformat(const AbstractPipelineLayout& p)
+	\brief Adapt the pipeline to a new version of its layout which only differs by its formats (and by the shaders depending on them), without building it again.
+	\param p The new layout. It must have the same elements, ports and connections than the current one, once built with the same options.
+	\return The number of filters whose shaders changed and which were compiled again (see Pipeline::getRecompiledFilters).
+
+	The filters whose shaders are unchanged keep their program and their uniform variables. The other filters are rebuilt, the values of their uniform variables are copied from their previous program (the references to these Filter objects are no longer valid). All the buffers cells are reallocated for the new formats, with the same IDs, and their content is lost. Raise an exception if the layout has a different structure, the pipeline is then not modified.
+	**/
+	int Pipeline::reformat(const AbstractPipelineLayout& p)
+	{
+		std::vector<AbstractFilterLayout*> 	filterLayouts;
+		std::vector<std::string>		filterNames;
+		std::vector<FusedFilterMember>		fusedMembers;
+		std::vector<Connection>			connections;
+		std::vector<Filter*>			newFilters;
+		std::vector<std::string>		recompiled;
+		Pipeline				tmp(p, getName(), false);
+
+		try
+		{
+			// Flatten the new layout, as the constructor would : 
+			int idx = THIS_PIPELINE;
+			tmp.build(idx, filterLayouts, filterNames, tmp.filtersGlobalIDsList, connections, tmp);
+
+			if((buildFlags & PruneUnusedFilters)!=0)
+				tmp.pruneFilters(filterLayouts, filterNames, connections);
+
+			if((buildFlags & FusePointwiseFilters)!=0)
+				tmp.fuseFilters(idx, filterLayouts, filterNames, connections, fusedMembers);
+
+			// Check the structure : 
+			bool sameStructure = 	tmp.getNumInputPort()==getNumInputPort() && tmp.getNumOutputPort()==getNumOutputPort() && 
+						filterLayouts.size()==filtersList.size() && fusedMembers.size()==fusedMembersList.size() &&
+						tmp.filtersGlobalIDsList==filtersGlobalIDsList && tmp.prunedFiltersList==prunedFiltersList;
+
+			for(unsigned int k=0; sameStructure && k<filterLayouts.size(); k++)
+				sameStructure = (filterNames[k]==filtersList[k]->getName());
+
+			for(unsigned int k=0; sameStructure && k<fusedMembers.size(); k++)
+				sameStructure = (fusedMembers[k].hostIdx==fusedMembersHostsList[k] && fusedMembers[k].uniformsPrefix==fusedMembersList[k]->program().getUniformsPrefix());
+
+			if(!sameStructure)
+				throw Exception("Pipeline::reformat - The new layout " + p.getFullName() + " does not have the same structure than the pipeline " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+
+			// Build the filters whose shaders or settings changed :
+			newFilters.assign(filtersList.size(), reinterpret_cast<Filter*>(NULL));
+			for(unsigned int k=0; k<filterLayouts.size(); k++)
+			{
+				const bool sameSources = haveSameSources(*filterLayouts[k], *filtersList[k]);
+
+				if(sameSources && haveSameSettings(*filterLayouts[k], *filtersList[k]))
+					continue;
+
+				newFilters[k] = new Filter(*filterLayouts[k], filterNames[k]);
+
+				if(!sameSources)
+					recompiled.push_back(filterNames[k]);
+			}
+		}
+		catch(Exception& e)
+		{
+			for(std::vector<Filter*>::iterator it=newFilters.begin(); it!=newFilters.end(); it++)
+				delete (*it);
+			for(std::vector<AbstractFilterLayout*>::iterator it=filterLayouts.begin(); it!=filterLayouts.end(); it++)
+				delete (*it);
+			for(std::vector<FusedFilterMember>::iterator it=fusedMembers.begin(); it!=fusedMembers.end(); it++)
+				delete it->layout;
+
+			Exception m("Pipeline::reformat - Exception caught while reformatting the pipeline " + getFullName() + " : ", __FILE__, __LINE__, Exception::CoreException);
+			m << e;
+			throw m;
+		}
+
+		// From here, the pipeline is modified : 
+		broken = true;
+		cleanInput();
+
+		try
+		{
+			// The views on the programs must be deleted first :
+			for(std::vector<Filter*>::iterator it=fusedMembersList.begin(); it!=fusedMembersList.end(); it++)
+				delete (*it);
+			fusedMembersList.clear();
+
+			for(unsigned int k=0; k<filtersList.size(); k++)
+			{
+				if(newFilters[k]!=NULL)
+				{
+					newFilters[k]->program().copyVars(filtersList[k]->program());
+					delete filtersList[k];
+					filtersList[k] = newFilters[k];
+					newFilters[k] = NULL;
+				}
+				else
+					filtersList[k]->changeFormat(*filterLayouts[k]);
+			}
+
+			for(std::vector<FusedFilterMember>::const_iterator it=fusedMembers.begin(); it!=fusedMembers.end(); it++)
+				fusedMembersList.push_back(new Filter(*it->layout, it->name, *filtersList[it->hostIdx], it->uniformsPrefix));
+
+			// Take the new layout (the formats reported by filterLayout(), etc.) : 
+			std::swap(elementsLayout, tmp.elementsLayout);
+			std::swap(elementsKind, tmp.elementsKind);
+			std::swap(elementsName, tmp.elementsName);
+			std::swap(elementsID, tmp.elementsID);
+			std::swap(AbstractPipelineLayout::connections, tmp.AbstractPipelineLayout::connections);
+
+			// Reallocate the buffers, the old ones are released first so that their textures can be recycled (see HdlTexturePool) :
+			const int currentCellID = getCurrentCellID();
+			std::vector<int> cellIDs = getCellIDs();
+
+			currentCell = NULL;
+			for(std::map<int, BuffersCell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+				delete it->second;
+			cells.clear();
+
+			actionsList.clear();
+			outputsList.clear();
+			bufferFormats = BufferFormatsCell();
+			allocateBuffers(connections);
+
+			for(std::vector<int>::const_iterator it=cellIDs.begin(); it!=cellIDs.end(); it++)
+				cells[*it] = new BuffersCell(bufferFormats);
+
+			if(currentCellID!=0)
+				changeTargetBuffersCell(currentCellID);
+
+			// Drop the measures made on the previous formats :
+			queryPending.assign(queryPending.size(), false);
+			perfsReady = false;
+		}
+		catch(Exception& e)
+		{
+			for(std::vector<Filter*>::iterator it=newFilters.begin(); it!=newFilters.end(); it++)
+				delete (*it);
+			for(std::vector<AbstractFilterLayout*>::iterator it=filterLayouts.begin(); it!=filterLayouts.end(); it++)
+				delete (*it);
+			for(std::vector<FusedFilterMember>::iterator it=fusedMembers.begin(); it!=fusedMembers.end(); it++)
+				delete it->layout;
+
+			Exception m("Pipeline::reformat - Exception caught while reformatting the pipeline " + getFullName() + " (the pipeline is broken) : ", __FILE__, __LINE__, Exception::CoreException);
+			m << e;
+			throw m;
+		}
+
+		for(std::vector<AbstractFilterLayout*>::iterator it=filterLayouts.begin(); it!=filterLayouts.end(); it++)
+			delete (*it);
+		for(std::vector<FusedFilterMember>::iterator it=fusedMembers.begin(); it!=fusedMembers.end(); it++)
+			delete it->layout;
+
+		recompiledFiltersList = recompiled;
+		firstRun	= true;
+		broken		= false;
+
+		return recompiledFiltersList.size();
+	}
+
+	/**
+	\fn const std::vector<std::string>& Pipeline::getRecompiledFilters(void) const
+	\brief Get the names of the filters whose shaders were compiled again by the last call to Pipeline::reformat.
+	\return The names of the filter instances.
+	**/
+	const std::vector<std::string>& Pipeline::getRecompiledFilters(void) const
+	{
+		return recompiledFiltersList;
+	}
+
 	/**
 	\fn int Pipeline::getSize(bool askDriver)
-	\brief Get the size in bytes of the elements on the GPU for this pipeline.
+	\brief Get the size in bytes of the elements on the GPU for this pipeline (per buffers cell). The buffers are shared between the filters whose outputs are not alive at the same time, compare with Pipeline::getNaiveSize.
 	\param  askDriver If true, it will use HdlTexture::getSizeOnGPU() to determine the real size (might be slower).
 	\return Size in bytes.
 	**/
@@ -1471,7 +2161,7 @@
 			if(askDriver)
 				fsize = currentCell->buffersList[i]->getSize(askDriver);
 			else
-				fsize = bufferFormats.formats[i].getSize();
+				fsize = bufferFormats.formats[i].getSize() * bufferFormats.outputCounts[i];
 
 			#ifdef __GLIPLIB_VERBOSE__
 				std::cout << "    - Buffer " << i << " : " << fsize/(1024.0*1024.0) << "MB (W:" << bufferFormats.formats[i].getWidth() << ", H:" << bufferFormats.formats[i].getHeight() << ",T:" << bufferFormats.outputCounts[i] << ')' << std::endl;
@@ -1486,6 +2176,143 @@
 		return size;
 	}
 
+	/**
+	\fn int Pipeline::getNaiveSize(void) const
+	\brief Get the size in bytes that the buffers would take if each filter had its own buffer (without reusing the buffers between filters whose outputs are not alive at the same time).
+	\return Size in bytes.
+	**/
+	int Pipeline::getNaiveSize(void) const
+	{
+		int size = 0;
+
+		for(std::vector<Filter*>::const_iterator it=filtersList.begin(); it!=filtersList.end(); it++)
+			size += (*it)->getSize() * (*it)->getNumOutputPort();
+
+		return size;
+	}
+
+	/**
+	\fn int Pipeline::getFilterHalo(const AbstractFilterLayout& layout, int declaredHalo, int defaultHalo)
+	\brief Get the halo of a single filter.
+	\param layout The layout of the filter.
+	\param declaredHalo The halo declared by the user (negative if none).
+	\param defaultHalo The halo to use for the filters reading their inputs around the current fragment (negative if unknown).
+	\return The halo of the filter. Raise an exception if the filter reads its inputs around the current fragment and neither its halo nor the default halo are known.
+	**/
+	int Pipeline::getFilterHalo(const AbstractFilterLayout& layout, int declaredHalo, int defaultHalo)
+	{
+		if(declaredHalo>=0)
+			return declaredHalo;
+
+		const ShaderSource* source = layout.getShaderSource(GL_FRAGMENT_SHADER);
+
+		bool pointwise = (source!=NULL && layout.isStandardGeometryModel());
+
+		for(int k=0; pointwise && k<layout.getNumInputPort(); k++)
+			pointwise = source->isPointwiseInput(layout.getInputPortName(k), layout.getWidth(), layout.getHeight());
+
+		if(pointwise)
+			return 0;
+		else if(defaultHalo<0)
+			throw Exception("Pipeline::getHalo - The filter " + layout.getFullName() + " reads its inputs around the current fragment but its halo was not declared (and no default halo was given).", __FILE__, __LINE__, Exception::CoreException);
+		else
+			return defaultHalo;
+	}
+
+	/**
+	\fn int Pipeline::getHalo(const std::map<int, int>& filtersHalos, int defaultHalo)
+	\brief Compute the halo of the pipeline : the distance, in pixels, up to which the inputs can influence an output pixel. This is the margin needed around a tile to process it independently.
+	\param filtersHalos The halo of some of the filters, indexed by their global ID (see AbstractPipelineLayout::getElementID and operator[]).
+	\param defaultHalo The halo of the filters which are not listed and which do not read all their inputs at the current fragment (see ShaderSource::isPointwiseInput, such filters have no halo). Negative if unknown.
+	\return The halo of the pipeline, accumulated along the longest path from an input to an output. Raise an exception if a filter changes the resolution, or if the halo of a filter is unknown.
+
+	The halos of the filters merged by Pipeline::FusePointwiseFilters are summed.
+	**/
+	int Pipeline::getHalo(const std::map<int, int>& filtersHalos, int defaultHalo)
+	{
+		std::map<int, int>::const_iterator itHalo;
+
+		// Halo of each filter :
+		std::vector<int> 	halos(filtersList.size(), -1);
+		std::vector<bool>	hosts(filtersList.size(), false);
+
+		for(std::map<int, int>::const_iterator it=filtersGlobalIDsList.begin(); it!=filtersGlobalIDsList.end(); it++)
+		{
+			if((itHalo=filtersHalos.find(it->first))!=filtersHalos.end())
+				halos[it->second] = itHalo->second;
+		}
+
+		for(std::map<int, int>::const_iterator it=fusedMembersGlobalIDsList.begin(); it!=fusedMembersGlobalIDsList.end(); it++)
+		{
+			const int 	host		= fusedMembersHostsList[it->second];
+			const int	declared	= ((itHalo=filtersHalos.find(it->first))!=filtersHalos.end()) ? itHalo->second : -1;
+
+			if(!hosts[host])
+			{
+				hosts[host] = true;
+				halos[host] = 0;
+			}
+			halos[host] += getFilterHalo(*fusedMembersList[it->second], declared, defaultHalo);
+		}
+
+		for(unsigned int k=0; k<filtersList.size(); k++)
+		{
+			if(filtersList[k]->getWidth()!=filtersList.front()->getWidth() || filtersList[k]->getHeight()!=filtersList.front()->getHeight())
+				throw Exception("Pipeline::getHalo - The filter " + filtersList[k]->getFullName() + " does not have the same resolution as the other filters of the pipeline " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+
+			if(!hosts[k])
+				halos[k] = getFilterHalo(*filtersList[k], halos[k], defaultHalo);
+		}
+
+		// Accumulate along the actions (in order) :
+		std::vector<int> accumulated(actionsList.size(), 0);
+		for(unsigned int k=0; k<actionsList.size(); k++)
+		{
+			int inputHalo = 0;
+
+			for(unsigned int l=0; l<actionsList[k].inputActionIdx.size(); l++)
+			{
+				if(actionsList[k].inputActionIdx[l]!=THIS_PIPELINE)
+					inputHalo = std::max(inputHalo, accumulated[ actionsList[k].inputActionIdx[l] ]);
+			}
+
+			accumulated[k] = inputHalo + halos[ actionsList[k].filterIdx ];
+		}
+
+		int result = 0;
+		for(std::vector<OutputHub>::const_iterator it=outputsList.begin(); it!=outputsList.end(); it++)
+		{
+			if(it->actionIdx>=0)
+				result = std::max(result, accumulated[it->actionIdx]);
+		}
+
+		return result;
+	}
+
+	/**
+	\fn bool Pipeline::isActionOutputHeld(const std::vector<bool>& runList, int action, int until) const
+	\brief Test if the outputs of an action, which will not be applied, are still available in their buffer (of the current cell) up to a given action.
+	\param runList The list of the actions which will be applied.
+	\param action The index of the action.
+	\param until The index of the action reading the outputs.
+	\return True if the outputs are still held in the buffer.
+	**/
+	bool Pipeline::isActionOutputHeld(const std::vector<bool>& runList, int action, int until) const
+	{
+		const int bufferIdx = actionsList[action].bufferIdx;
+
+		if(currentCell->buffersOwners[bufferIdx]!=action)
+			return false;
+
+		for(int q=0; q<until; q++)
+		{
+			if(q!=action && runList[q] && actionsList[q].bufferIdx==bufferIdx)
+				return false;
+		}
+
+		return true;
+	}
+
 	/**
 	\fn void Pipeline::process(void)
 	\brief Apply the pipeline.
@@ -1508,113 +2335,485 @@
 			timing = clock();
 		}
 
+		#ifdef GLIP_USE_GL
+		if(GLEW_VERSION_3_3 && perfsMonitoring)
+		{
+			// Gather the results of the previous runs, then recycle the oldest slot if it is still pending (its results are lost) :
+			collectPerfsQueries();
+			queryPending[queryCurrentSlot] = false;
+		}
+		#endif
+
+		GLint64 timelineFrameBegin = 0,
+			timelineBegin = 0,
+			timelineEnd = 0;
+		if(timelineRecording)
+			timelineFrameBegin = beginTimelineFrame();
+
 		#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
 			std::cout << "Pipeline::process - Processing : " << getFullName() << std::endl;
 		#endif
 
-		for(unsigned int k=0; k<actionsList.size(); k++)
+		// Find the actions to apply :
+		std::vector<bool> 	dirtyList(actionsList.size(), true),	// The outputs of the action will change.
+					runList(actionsList.size(), true);	// The action has to be applied (changing its outputs or restoring them).
+		if(incrementalProcessing)
 		{
-			ActionHub* 	action 	= &actionsList[k];
-			Filter* 	f 	= filtersList[ action->filterIdx ];
-			HdlFBO* 	t 	= currentCell->buffersList[ action->bufferIdx ];
+			currentCell->actionsStates.resize(actionsList.size());
 
-			#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
-				std::cout << "    applying filter : " << f->getFullName() << "..." << std::endl;
-			#endif
+			for(unsigned int k=0; k<actionsList.size(); k++)
+			{
+				const ActionHub& 	action 	= actionsList[k];
+				const ActionState&	state	= currentCell->actionsStates[k];
+				bool			dirty	= !state.valid || state.programState!=filtersList[action.filterIdx]->program().getModificationCount();
+
+				for(unsigned int l=0; l<action.inputActionIdx.size() && !dirty; l++)
+				{
+					if(action.inputActionIdx[l]==THIS_PIPELINE)
+					{
+						const HdlTexture* input = inputsList[ action.inputArgumentIdx[l] ];
+						dirty = (state.inputs[l]!=input) || (state.inputsStates[l]!=input->getModificationCount());
+					}
+					else
+						dirty = dirtyList[ action.inputActionIdx[l] ] || (state.inputsStates[l]!=currentCell->actionsStates[ action.inputActionIdx[l] ].generation);
+				}
+
+				dirtyList[k] 	= dirty;
+				runList[k]	= dirty;
+			}
 
-			for(int l=0; l<f->getNumInputPort(); l++)
+			// Apply again the actions whose outputs were overwritten in their buffer but are still needed :
+			bool changed = true;
+			while(changed)
 			{
-				int bufferID 	= action->inputBufferIdx[l];
-				int portID 	= action->inputArgumentIdx[l];
+				changed = false;
+
+				for(unsigned int k=0; k<actionsList.size(); k++)
+				{
+					if(!runList[k])
+						continue;
+
+					for(unsigned int l=0; l<actionsList[k].inputActionIdx.size(); l++)
+					{
+						const int p = actionsList[k].inputActionIdx[l];
+
+						if(p!=THIS_PIPELINE && !runList[p] && !isActionOutputHeld(runList, p, k))
+						{
+							runList[p] 	= true;
+							changed		= true;
+						}
+					}
+				}
+
+				for(std::vector<OutputHub>::const_iterator it=outputsList.begin(); it!=outputsList.end(); it++)
+				{
+					if(it->actionIdx>=0 && !runList[it->actionIdx] && !isActionOutputHeld(runList, it->actionIdx, actionsList.size()))
+					{
+						runList[it->actionIdx]	= true;
+						changed			= true;
+					}
+				}
+			}
+		}
+
+		numProcessedActions = 0;
+
+		// Redundant state changes are skipped between the actions (see HandleOpenGL::beginStateTracking) :
+		HandleOpenGL::beginStateTracking();
+		try
+		{
+			for(unsigned int k=0; k<actionsList.size(); k++)
+			{
+				ActionHub* 	action 	= &actionsList[k];
+				Filter* 	f 	= filtersList[ action->filterIdx ];
+				HdlFBO* 	t 	= currentCell->buffersList[ action->bufferIdx ];
+
+				if(!runList[k])
+				{
+					#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
+						std::cout << "    skipping filter : " << f->getFullName() << "." << std::endl;
+					#endif
+
+					// Keep the timer queries consistent :
+					if(perfsMonitoring)
+					{
+						#ifdef GLIP_USE_GL
+						if(GLEW_VERSION_3_3)
+						{
+							glBeginQuery(GL_TIME_ELAPSED, queryObjects[queryCurrentSlot*actionsList.size() + k]);
+							glEndQuery(GL_TIME_ELAPSED);
+						}
+						else
+						#endif
+							perfs[k] = 0.0;
+					}
+
+					continue;
+				}
+
+				#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
+					std::cout << "    applying filter : " << f->getFullName() << "..." << std::endl;
+				#endif
+
+				#ifdef GLIP_USE_GL
+				if(timelineRecording)
+					glGetInteger64v(GL_TIMESTAMP, &timelineBegin);
+				#endif
+
+				for(int l=0; l<f->getNumInputPort(); l++)
+				{
+					int bufferID 	= action->inputBufferIdx[l];
+					int portID 	= action->inputArgumentIdx[l];
+
+					#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
+						std::cout << "        conecting buffer " << bufferID << " on port " << portID << std::endl;
+					#endif
+
+					if(bufferID==THIS_PIPELINE)
+						f->setInputForNextRendering(l, inputsList[portID]);
+					else
+						f->setInputForNextRendering(l, (*currentCell->buffersList[bufferID])[portID]);
+				}
 
 				#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
-					std::cout << "        conecting buffer " << bufferID << " on port " << portID << std::endl;
+					std::cout << "        Processing using buffer " << action->bufferIdx << "..." << std::endl;
+				#endif
+
+				GLuint 	actionQueries[4] = {0, 0, 0, 0}; // Action, then mipmaps generation.
+				#ifdef GLIP_USE_GL
+				if(timelineRecording)
+				{
+					glGetInteger64v(GL_TIMESTAMP, &timelineEnd);
+					addTimelineEvent("Bind inputs", "bind", k, timelineBegin, timelineEnd);
+					if(k==0 || actionsList[k-1].bufferIdx!=action->bufferIdx)
+						addTimelineEvent("FBO switch", "fbo", k, timelineEnd);
+
+					timelineBegin = timelineEnd;
+					actionQueries[0] = acquireTimelineQuery();
+					actionQueries[1] = acquireTimelineQuery();
+					glQueryCounter(actionQueries[0], GL_TIMESTAMP);
+
+					// The mipmaps are generated at the end of the rendering (see HdlFBO::endRendering) :
+					if(t->getMaxLevel()>0)
+					{
+						actionQueries[2] = acquireTimelineQuery();
+						actionQueries[3] = acquireTimelineQuery();
+						t->setMipmapsQueries(actionQueries[2], actionQueries[3]);
+					}
+				}
 				#endif
 
-				if(bufferID==THIS_PIPELINE)
-					f->setInputForNextRendering(l, inputsList[portID]);
+				if(perfsMonitoring)
+				{
+					#ifdef GLIP_USE_GL
+					if(GLEW_VERSION_3_3)
+						glBeginQuery(GL_TIME_ELAPSED, queryObjects[queryCurrentSlot*actionsList.size() + k]);
+					else
+					#endif
+						timing = clock();
+
+					//glFlush();
+				}
+
+				if(firstRun)
+				{
+					try
+					{
+						f->process(*t);
+					}
+					catch(Exception& e)
+					{
+						firstRun	= false;
+						broken 		= true;
+						Exception m("Pipeline::process - Exception caught in pipeline " + getFullName() + ", during processing : ", __FILE__, __LINE__, Exception::CoreException);
+						m << e;
+						throw m;
+					}
+				}
 				else
-					f->setInputForNextRendering(l, (*currentCell->buffersList[bufferID])[portID]);
+					f->process(*t);
+
+				if(perfsMonitoring)
+				{
+					//glFlush();
+
+					#ifdef GLIP_USE_GL
+					if(GLEW_VERSION_3_3)
+						glEndQuery(GL_TIME_ELAPSED); // The result will be read during a following call, see Pipeline::collectPerfsQueries.
+					else
+					#endif
+					{
+						timing = clock() - timing;
+						perfs[k] = static_cast<double>(timing)/static_cast<double>(CLOCKS_PER_SEC)*1000.0f;
+					}
+				}
+
+				#ifdef GLIP_USE_GL
+				if(timelineRecording)
+				{
+					glQueryCounter(actionQueries[1], GL_TIMESTAMP);
+					glGetInteger64v(GL_TIMESTAMP, &timelineEnd);
+					addTimelineEvent(f->getFullName(), "submit", k, timelineBegin, timelineEnd);
+					addTimelineGPUEvent(f->getFullName(), "gpu", k, actionQueries[0], actionQueries[1]);
+					if(actionQueries[2]>0)
+						addTimelineGPUEvent("Mipmaps generation", "mipmap", k, actionQueries[2], actionQueries[3]);
+				}
+				#endif
+
+				// Update the state of the cell :
+				currentCell->buffersOwners[ action->bufferIdx ] = k;
+				numProcessedActions++;
+
+				if(incrementalProcessing && dirtyList[k])
+				{
+					ActionState& state = currentCell->actionsStates[k];
+
+					state.valid 		= true;
+					state.programState	= f->program().getModificationCount();
+					state.generation	= ++currentCell->generationCounter;
+					state.inputs.assign(action->inputActionIdx.size(), NULL);
+					state.inputsStates.assign(action->inputActionIdx.size(), 0);
+
+					for(unsigned int l=0; l<action->inputActionIdx.size(); l++)
+					{
+						if(action->inputActionIdx[l]==THIS_PIPELINE)
+						{
+							state.inputs[l]		= inputsList[ action->inputArgumentIdx[l] ];
+							state.inputsStates[l]	= inputsList[ action->inputArgumentIdx[l] ]->getModificationCount();
+						}
+						else
+							state.inputsStates[l]	= currentCell->actionsStates[ action->inputActionIdx[l] ].generation;
+					}
+				}
+
+				#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
+					std::cout << "        Done." << std::endl;
+				#endif
 			}
+		}
+		catch(...)
+		{
+			HandleOpenGL::endStateTracking();
+			throw;
+		}
+		HandleOpenGL::endStateTracking();
 
-			#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
-				std::cout << "        Processing using buffer " << action->bufferIdx << "..." << std::endl;
+		if(perfsMonitoring)
+		{
+			#ifdef GLIP_USE_GL
+			if(GLEW_VERSION_3_3)
+			{
+				queryPending[queryCurrentSlot] 	= true;
+				queryCurrentSlot		= (queryCurrentSlot + 1) % numPerfsQueriesFrames;
+			}
+			else
 			#endif
+			{
+				totalTiming = clock() - totalTiming;
+				totalPerf   = static_cast<double>(totalTiming)/static_cast<double>(CLOCKS_PER_SEC)*1000.0f;
+				perfsReady  = true;
+			}
+		}
+
+		#ifdef GLIP_USE_GL
+		if(timelineRecording)
+		{
+			glGetInteger64v(GL_TIMESTAMP, &timelineEnd);
+			addTimelineEvent("Frame", "frame", -1, timelineFrameBegin, timelineEnd);
+		}
+		#endif
+
+		#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
+			std::cout << "Pipeline::process - Done for pipeline : " << getFullName() << std::endl;
+		#endif
+
+		firstRun = false;
+	}
+
+	/**
+	\fn void Pipeline::processBatch(const std::vector< std::vector<HdlTexture*> >& inputs, const std::vector<int>& cellIDs)
+	\brief Apply the pipeline on several sets of inputs. Each action is applied on all the sets before the next action, which saves the program switches and states setup.
+	\param inputs The sets of inputs, each containing as many textures as the pipeline has input ports.
+	\param cellIDs The buffers cells receiving the results of each set (must be distinct).
+
+	The current cell is not changed. The results of the set k are read with out(i, cellIDs[k]). All the actions are applied (incremental processing is ignored and the state of the cells involved is reset). When performance monitoring is enabled, the timings correspond to the whole batch.
+	**/
+	void Pipeline::processBatch(const std::vector< std::vector<HdlTexture*> >& inputs, const std::vector<int>& cellIDs)
+	{
+		clock_t timing = 0;
+
+		if(inputs.size()!=cellIDs.size())
+			throw Exception("Pipeline::processBatch - The number of inputs sets (" + toString(inputs.size()) + ") does not match the number of cells (" + toString(cellIDs.size()) + ") for pipeline " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+
+		if(!inputsList.empty())
+			throw Exception("Pipeline::processBatch - Arguments were already given to pipeline " + getFullName() + " (use Pipeline::Reset before).", __FILE__, __LINE__, Exception::CoreException);
+
+		std::vector<BuffersCell*> batchCells;
+		for(unsigned int k=0; k<cellIDs.size(); k++)
+		{
+			std::map<int, BuffersCell*>::iterator it = cells.find(cellIDs[k]);
+
+			if(it==cells.end())
+				throw Exception("Pipeline::processBatch - The cell ID " + toString(cellIDs[k]) + " does not exist.", __FILE__, __LINE__, Exception::CoreException);
+			if(std::find(batchCells.begin(), batchCells.end(), it->second)!=batchCells.end())
+				throw Exception("Pipeline::processBatch - The cell ID " + toString(cellIDs[k]) + " is used more than once.", __FILE__, __LINE__, Exception::CoreException);
+			if(static_cast<int>(inputs[k].size())!=getNumInputPort())
+				throw Exception("Pipeline::processBatch - Wrong number of arguments in the set " + toString(k) + " given to pipeline " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+
+			batchCells.push_back(it->second);
+		}
+
+		if(batchCells.empty())
+			return ;
+
+		#ifdef GLIP_USE_GL
+		if(GLEW_VERSION_3_3 && perfsMonitoring)
+		{
+			collectPerfsQueries();
+			queryPending[queryCurrentSlot] = false;
+		}
+		else if(perfsMonitoring)
+		#else
+		if(perfsMonitoring)
+		#endif
+			totalPerf = 0.0;
+
+		#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
+			std::cout << "Pipeline::processBatch - Processing " << batchCells.size() << " sets : " << getFullName() << std::endl;
+		#endif
+
+		std::vector<HdlFBO*> 			renderers(batchCells.size(), NULL);
+		std::vector< std::vector<HdlTexture*> > arguments(batchCells.size());
+
+		// The timeline records each action once, for all the sets :
+		GLint64 timelineFrameBegin = 0,
+			timelineBegin = 0,
+			timelineEnd = 0;
+		if(timelineRecording)
+			timelineFrameBegin = beginTimelineFrame();
+
+		numProcessedActions = 0;
 
-			if(perfsMonitoring)
+		// Redundant state changes are skipped between the actions (see HandleOpenGL::beginStateTracking) :
+		HandleOpenGL::beginStateTracking();
+		try
+		{
+			for(unsigned int k=0; k<actionsList.size(); k++)
 			{
+				const ActionHub& 	action 	= actionsList[k];
+				Filter* 		f 	= filtersList[ action.filterIdx ];
+
+				for(unsigned int b=0; b<batchCells.size(); b++)
+				{
+					renderers[b] = batchCells[b]->buffersList[ action.bufferIdx ];
+					arguments[b].assign(f->getNumInputPort(), NULL);
+
+					for(int l=0; l<f->getNumInputPort(); l++)
+					{
+						if(action.inputBufferIdx[l]==THIS_PIPELINE)
+							arguments[b][l] = inputs[b][ action.inputArgumentIdx[l] ];
+						else
+							arguments[b][l] = (*batchCells[b]->buffersList[ action.inputBufferIdx[l] ])[ action.inputArgumentIdx[l] ];
+					}
+				}
+
+				GLuint 	actionQueries[2] = {0, 0};
 				#ifdef GLIP_USE_GL
-				if(GLEW_VERSION_3_3)
-					glBeginQuery(GL_TIME_ELAPSED, queryObject);
-				else
+				if(timelineRecording)
+				{
+					glGetInteger64v(GL_TIMESTAMP, &timelineBegin);
+					actionQueries[0] = acquireTimelineQuery();
+					actionQueries[1] = acquireTimelineQuery();
+					glQueryCounter(actionQueries[0], GL_TIMESTAMP);
+				}
 				#endif
-					timing = clock();
 
-				//glFlush();
-			}
+				if(perfsMonitoring)
+				{
+					#ifdef GLIP_USE_GL
+					if(GLEW_VERSION_3_3)
+						glBeginQuery(GL_TIME_ELAPSED, queryObjects[queryCurrentSlot*actionsList.size() + k]);
+					else
+					#endif
+						timing = clock();
+				}
 
-			if(firstRun)
-			{
 				try
 				{
-					f->process(*t);
+					f->processBatch(renderers, arguments);
 				}
 				catch(Exception& e)
 				{
-					firstRun	= false;
-					broken 		= true;
-					Exception m("Pipeline::process - Exception caught in pipeline " + getFullName() + ", during processing : ", __FILE__, __LINE__, Exception::CoreException);
+					if(firstRun)
+					{
+						firstRun	= false;
+						broken 		= true;
+					}
+					Exception m("Pipeline::processBatch - Exception caught in pipeline " + getFullName() + ", during processing : ", __FILE__, __LINE__, Exception::CoreException);
 					m << e;
 					throw m;
 				}
-			}
-			else
-				f->process(*t);
 
-			if(perfsMonitoring)
-			{
-				//glFlush();
+				if(perfsMonitoring)
+				{
+					#ifdef GLIP_USE_GL
+					if(GLEW_VERSION_3_3)
+						glEndQuery(GL_TIME_ELAPSED);
+					else
+					#endif
+					{
+						timing = clock() - timing;
+						perfs[k] = static_cast<double>(timing)/static_cast<double>(CLOCKS_PER_SEC)*1000.0f;
+						totalPerf += perfs[k];
+					}
+				}
 
 				#ifdef GLIP_USE_GL
-				if(GLEW_VERSION_3_3)
+				if(timelineRecording)
 				{
-					GLuint64 querytime;
-					glEndQuery(GL_TIME_ELAPSED);
-					glGetQueryObjectui64v(queryObject, GL_QUERY_RESULT, &querytime);
-					perfs[k] = static_cast<double>(querytime)/1e6;
+					glQueryCounter(actionQueries[1], GL_TIMESTAMP);
+					glGetInteger64v(GL_TIMESTAMP, &timelineEnd);
+					addTimelineEvent(f->getFullName(), "submit", k, timelineBegin, timelineEnd);
+					addTimelineGPUEvent(f->getFullName(), "gpu", k, actionQueries[0], actionQueries[1]);
 				}
-				else
 				#endif
-				{
-					timing = clock() - timing;
-					perfs[k] = static_cast<double>(timing)/static_cast<double>(CLOCKS_PER_SEC)*1000.0f;
-				}
-			}
 
-			#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
-				std::cout << "        Done." << std::endl;
-			#endif
+				for(unsigned int b=0; b<batchCells.size(); b++)
+					batchCells[b]->buffersOwners[ action.bufferIdx ] = k;
+
+				numProcessedActions += batchCells.size();
+			}
+		}
+		catch(...)
+		{
+			HandleOpenGL::endStateTracking();
+			throw;
 		}
+		HandleOpenGL::endStateTracking();
+
+		// The incremental states of these cells are no longer valid :
+		for(unsigned int b=0; b<batchCells.size(); b++)
+			batchCells[b]->actionsStates.clear();
 
 		if(perfsMonitoring)
 		{
 			#ifdef GLIP_USE_GL
 			if(GLEW_VERSION_3_3)
 			{
-				totalPerf = 0;
-				for(unsigned int i=0; i<perfs.size(); i++)
-					totalPerf += perfs[i];
+				queryPending[queryCurrentSlot] 	= true;
+				queryCurrentSlot		= (queryCurrentSlot + 1) % numPerfsQueriesFrames;
 			}
 			else
 			#endif
-			{
-				totalTiming = clock() - totalTiming;
-				totalPerf   = static_cast<double>(totalTiming)/static_cast<double>(CLOCKS_PER_SEC)*1000.0f;
-			}
+				perfsReady = true;
+		}
+
+		#ifdef GLIP_USE_GL
+		if(timelineRecording)
+		{
+			glGetInteger64v(GL_TIMESTAMP, &timelineEnd);
+			addTimelineEvent("Batch", "frame", -1, timelineFrameBegin, timelineEnd);
 		}
-
-		#ifdef __GLIPLIB_DEVELOPMENT_VERBOSE__
-			std::cout << "Pipeline::process - Done for pipeline : " << getFullName() << std::endl;
 		#endif
 
 		firstRun = false;
@@ -1733,7 +2932,18 @@
 	{
 		try
 		{
-			return *filtersList[ filtersGlobalIDsList[filterID] ];
+			std::map<int, int>::const_iterator it = filtersGlobalIDsList.find(filterID);
+
+			if(it!=filtersGlobalIDsList.end())
+				return *filtersList[ it->second ];
+
+			// The filter might have been merged into another one :
+			it = fusedMembersGlobalIDsList.find(filterID);
+
+			if(it==fusedMembersGlobalIDsList.end())
+				throw Exception("Pipeline::operator[int] - No filter with ID " + toString(filterID) + " in pipeline " + getFullName() + " (it might have been pruned).", __FILE__, __LINE__, Exception::CoreException);
+
+			return *fusedMembersList[ it->second ];
 		}
 		catch(Exception& e)
 		{
@@ -1769,6 +2979,124 @@
 		return broken;
 	}
 
+	/**
+	\fn int Pipeline::processAsync(void)
+	\brief Apply the pipeline on the inputs previously given (with operator<<) without waiting for the results, equivalent to operator<<(Pipeline::Process) followed by the creation of a fence.
+	\return A ticket identifying this run (strictly positive), to be used with isComplete() or wait(). Raise an exception if any errors occur.
+
+	The commands are flushed to the GPU, thus the ticket will complete even if no other OpenGL call is made. Without sync objects (OpenGL 3.2 or ARB_sync), the function waits for the completion of the run before returning.
+	**/
+	int Pipeline::processAsync(void)
+	{
+		(*this) << Process;
+
+		const int ticket = ticketsCounter;
+		ticketsCounter++;
+
+		#ifdef GLIP_USE_GL
+		if(GLEW_VERSION_3_2 || GLEW_ARB_sync)
+		{
+			GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+			if(sync==0)
+				throw Exception("Pipeline::processAsync - Unable to create the fence for pipeline " + getFullName() + ".", __FILE__, __LINE__, Exception::GLException);
+
+			glFlush();
+			pendingTickets[ticket] = sync;
+		}
+		else
+		#endif
+			glFinish();
+
+		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+			OPENGL_ERROR_TRACKER("Pipeline::processAsync", "glFenceSync()")
+		#endif
+
+		return ticket;
+	}
+
+	/**
+	\fn bool Pipeline::isComplete(int ticket)
+	\brief Test, without blocking, if an asynchronous run is completed.
+	\param ticket The ticket returned by processAsync().
+	\return True if all the actions of this run were executed by the GPU (its outputs can be read without stalling). Raise an exception if the ticket was never issued by this pipeline.
+	**/
+	bool Pipeline::isComplete(int ticket)
+	{
+		return wait(ticket, 0.0);
+	}
+
+	/**
+	\fn bool Pipeline::wait(int ticket, double timeout)
+	\brief Wait for the completion of an asynchronous run.
+	\param ticket The ticket returned by processAsync().
+	\param timeout Maximum waiting time, in milliseconds (negative to wait until completion, zero to only test).
+	\return True if the run is completed, false if the timeout expired before. Raise an exception if the ticket was never issued by this pipeline.
+	**/
+	bool Pipeline::wait(int ticket, double timeout)
+	{
+		if(ticket<=0 || ticket>=ticketsCounter)
+			throw Exception("Pipeline::wait - The ticket " + toString(ticket) + " was not issued by pipeline " + getFullName() + ".", __FILE__, __LINE__, Exception::CoreException);
+
+		std::map<int, GLsync>::iterator it = pendingTickets.find(ticket);
+
+		// Already known to be completed :
+		if(it==pendingTickets.end())
+			return true;
+
+		GLenum result = GL_TIMEOUT_EXPIRED;
+
+		#ifdef GLIP_USE_GL
+		if(timeout<0.0)
+		{
+			do
+				result = glClientWaitSync(it->second, 0, std::numeric_limits<GLuint64>::max());
+			while(result==GL_TIMEOUT_EXPIRED);
+		}
+		else
+			result = glClientWaitSync(it->second, 0, static_cast<GLuint64>(timeout*1e6));
+		#endif
+
+		if(result==GL_WAIT_FAILED)
+			throw Exception("Pipeline::wait - Unable to wait for the ticket " + toString(ticket) + " of pipeline " + getFullName() + ".", __FILE__, __LINE__, Exception::GLException);
+		else if(result==GL_TIMEOUT_EXPIRED)
+			return false;
+
+		// The fences complete in order, the previous tickets are also completed :
+		std::map<int, GLsync>::iterator itEnd = it;
+		itEnd++;
+		#ifdef GLIP_USE_GL
+		for(std::map<int, GLsync>::iterator itSync=pendingTickets.begin(); itSync!=itEnd; itSync++)
+			glDeleteSync(itSync->second);
+		#endif
+		pendingTickets.erase(pendingTickets.begin(), itEnd);
+
+		return true;
+	}
+
+	/**
+	\fn int Pipeline::getNumPendingTickets(void) const
+	\brief Get the number of asynchronous runs which were not yet seen completed (by isComplete() or wait()).
+	\return The number of pending tickets.
+	**/
+	int Pipeline::getNumPendingTickets(void) const
+	{
+		return pendingTickets.size();
+	}
+
+	/**
+	\fn void Pipeline::releaseTickets(void)
+	\brief Delete the fences of the pending tickets.
+	**/
+	void Pipeline::releaseTickets(void)
+	{
+		#ifdef GLIP_USE_GL
+		for(std::map<int, GLsync>::iterator it=pendingTickets.begin(); it!=pendingTickets.end(); it++)
+			glDeleteSync(it->second);
+		#endif
+		pendingTickets.clear();
+	}
+
 	/**
 	\fn int Pipeline::createBuffersCell(void)
 	\brief Create a new buffers cell for this pipeline.
@@ -1883,6 +3211,108 @@
 		}
 	}
 
+	/**
+	\fn void Pipeline::enableIncrementalProcessing(void)
+	\brief Enable incremental processing : the following runs will only apply the actions whose inputs, program or upstream actions changed since their last application in the current buffers cell.
+	**/
+	void Pipeline::enableIncrementalProcessing(void)
+	{
+		if(!incrementalProcessing)
+		{
+			// Forget the previous states, the next run will apply all the actions :
+			for(std::map<int, BuffersCell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+				it->second->actionsStates.clear();
+
+			incrementalProcessing = true;
+		}
+	}
+
+	/**
+	\fn void Pipeline::disableIncrementalProcessing(void)
+	\brief Disable incremental processing, all the actions will be applied at each run.
+	**/
+	void Pipeline::disableIncrementalProcessing(void)
+	{
+		incrementalProcessing = false;
+	}
+
+	/**
+	\fn bool Pipeline::isIncrementalProcessingEnabled(void) const
+	\brief Test if the incremental processing is enabled.
+	\return True if the incremental processing is enabled.
+	**/
+	bool Pipeline::isIncrementalProcessingEnabled(void) const
+	{
+		return incrementalProcessing;
+	}
+
+	/**
+	\fn int Pipeline::getNumProcessedActions(void) const
+	\brief Get the number of actions which were actually applied during the last run (equal to Pipeline::getNumActions unless the incremental processing is enabled).
+	\return The number of actions applied.
+	**/
+	int Pipeline::getNumProcessedActions(void) const
+	{
+		return numProcessedActions;
+	}
+
+	/**
+	\fn void Pipeline::releasePerfsQueries(void)
+	\brief Delete the timer queries used for performance monitoring.
+	**/
+	void Pipeline::releasePerfsQueries(void)
+	{
+		if(!queryObjects.empty())
+			glDeleteQueries(queryObjects.size(), &queryObjects[0]);
+		queryObjects.clear();
+		queryPending.clear();
+		queryCurrentSlot = 0;
+	}
+
+	/**
+	\fn void Pipeline::collectPerfsQueries(void)
+	\brief Read, without blocking, the results of the timer queries which are available. Only the most recent completed run is kept.
+	**/
+	void Pipeline::collectPerfsQueries(void)
+	{
+		if(queryObjects.empty() || actionsList.empty())
+			return ;
+
+		const unsigned int numActions = actionsList.size();
+
+		// From the oldest slot to the most recent one :
+		for(int l=0; l<numPerfsQueriesFrames; l++)
+		{
+			const int slot = (queryCurrentSlot + l) % numPerfsQueriesFrames;
+
+			if(!queryPending[slot])
+				continue;
+
+			// The queries complete in order, testing the last one is enough :
+			GLint available = 0;
+			glGetQueryObjectiv(queryObjects[slot*numActions + numActions - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+			if(available==0)
+				break;
+
+			totalPerf = 0.0;
+			for(unsigned int k=0; k<numActions; k++)
+			{
+				GLuint64 querytime = 0;
+				glGetQueryObjectui64v(queryObjects[slot*numActions + k], GL_QUERY_RESULT, &querytime);
+				perfs[k] = static_cast<double>(querytime)/1e6;
+				totalPerf += perfs[k];
+			}
+
+			queryPending[slot] 	= false;
+			perfsReady		= true;
+		}
+
+		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+			OPENGL_ERROR_TRACKER("Pipeline::collectPerfsQueries", "glGetQueryObjectui64v()")
+		#endif
+	}
+
 	/**
 	\fn void Pipeline::enablePerfsMonitoring(void)
 	\brief Enable performances monitoring.
@@ -1894,14 +3324,17 @@
 		if(!perfsMonitoring)
 		{
 			perfsMonitoring = true;
+			perfsReady	= false;
 			perfs.assign(filtersList.size(),0.0f);
 			totalPerf = 0.0f;
 
 			#ifdef GLIP_USE_GL
-			if(GLEW_VERSION_3_3)
+			if(GLEW_VERSION_3_3 && queryObjects.empty())
 			{
-				if(queryObject==0)
-					glGenQueries(1, &queryObject);
+				queryObjects.assign(numPerfsQueriesFrames*actionsList.size(), 0);
+				glGenQueries(queryObjects.size(), &queryObjects[0]);
+				queryPending.assign(numPerfsQueriesFrames, false);
+				queryCurrentSlot = 0;
 			}
 			#endif
 		}
@@ -1918,28 +3351,54 @@
 		if(perfsMonitoring)
 		{
 			perfsMonitoring = false;
+			perfsReady	= false;
 			perfs.clear();
 			totalPerf = 0.0;
+			releasePerfsQueries();
+		}
+	}
+
+	/**
+	\fn bool Pipeline::isTimingReady(void)
+	\brief Test if performance monitoring results are available. The timer queries results of a run are usually available one or a few runs later, this function does not wait for them.
+	\return True if at least one run was fully measured since the monitoring was enabled (in which case the timing functions return the results of the most recent measured run).
+	**/
+	bool Pipeline::isTimingReady(void)
+	{
+		if(perfsMonitoring)
+		{
+			collectPerfsQueries();
+			return perfsReady;
 		}
+		else
+			return false;
 	}
 
 	/**
 	\fn double Pipeline::getTiming(int filterID)
-	\brief Get last result of performance monitoring IF it is still enabled.
+	\brief Get last available result of performance monitoring IF it is still enabled (see Pipeline::isTimingReady).
 	\param filterID The ID of the filter.
-	\return Time in milliseconds needed to apply the filter (not counting binding operation).
+	\return Time in milliseconds needed to apply the filter (not counting binding operation). Raise an exception if the filter does not exist or was pruned or merged into another one.
 	**/
 	double Pipeline::getTiming(int filterID)
 	{
 		if(perfsMonitoring)
-			return perfs[ filtersGlobalIDsList[filterID] ];
+		{
+			std::map<int, int>::const_iterator it = filtersGlobalIDsList.find(filterID);
+
+			if(it==filtersGlobalIDsList.end())
+				throw Exception("Pipeline::getTiming - No filter with ID " + toString(filterID) + " in pipeline " + getFullName() + " (it might have been pruned or merged into another filter).", __FILE__, __LINE__, Exception::CoreException);
+
+			collectPerfsQueries();
+			return perfs[it->second];
+		}
 		else
 			throw Exception("Pipeline::getTiming - Monitoring is disabled.", __FILE__, __LINE__, Exception::CoreException);
 	}
 
 	/**
 	\fn double Pipeline::getTiming(int action, std::string& filterName)
-	\brief Get last result of performance monitoring IF it is still enabled.
+	\brief Get last available result of performance monitoring IF it is still enabled (see Pipeline::isTimingReady).
 	\param action The ID of the filter.
 	\param filterName A reference string that will contain the name of the filter indexed by action at the end of the function.
 	\return Time in milliseconds needed to apply the filter (not counting binding operation).
@@ -1952,6 +3411,7 @@
 				throw Exception("Pipeline::getTiming - Action index is outside of range.", __FILE__, __LINE__, Exception::CoreException);
 			else
 			{
+				collectPerfsQueries();
 				filterName = filtersList[ actionsList[action].filterIdx ]->getFullName();
 				return perfs[action];
 			}
@@ -1963,14 +3423,319 @@
 
 	/**
 	\fn double Pipeline::getTotalTiming(void)
-	\brief Get total time elapsed for last run.
+	\brief Get total time elapsed for last measured run (see Pipeline::isTimingReady).
 	\return Time in milliseconds needed to apply the whole pipeline (counting everything and flushing after each filter).
 	**/
 	double Pipeline::getTotalTiming(void)
 	{
 		if(perfsMonitoring)
+		{
+			collectPerfsQueries();
 			return totalPerf;
+		}
 		else
 			throw Exception("Pipeline::getTotalTiming - Monitoring is disabled.", __FILE__, __LINE__, Exception::CoreException);
 	}
 
+	/**
+	\fn void Pipeline::addTimelineEvent(const std::string& name, const std::string& category, int action, GLint64 begin, GLint64 end)
+	\brief Record a CPU event in the timeline.
+	\param name Name of the event.
+	\param category Category of the event.
+	\param action Index of the action or -1.
+	\param begin Beginning time, in nanoseconds, on the GL clock.
+	\param end Ending time, in nanoseconds, on the GL clock. If negative, the event is instant.
+	**/
+	void Pipeline::addTimelineEvent(const std::string& name, const std::string& category, int action, GLint64 begin, GLint64 end)
+	{
+		TimelineEvent e;
+
+		e.name		= name;
+		e.category	= category;
+		e.gpu		= false;
+		e.instant	= (end<0);
+		e.frame		= timelineFrame;
+		e.action	= action;
+		e.begin		= begin;
+		e.end		= e.instant ? begin : end;
+		e.beginQuery	= 0;
+		e.endQuery	= 0;
+
+		timelineEvents.push_back(e);
+	}
+
+	/**
+	\fn void Pipeline::addTimelineGPUEvent(const std::string& name, const std::string& category, int action, GLuint beginQuery, GLuint endQuery)
+	\brief Record a GPU event in the timeline, its times will be read later from the timestamp queries.
+	\param name Name of the event.
+	\param category Category of the event.
+	\param action Index of the action.
+	\param beginQuery Timestamp query issued before the event.
+	\param endQuery Timestamp query issued after the event.
+	**/
+	void Pipeline::addTimelineGPUEvent(const std::string& name, const std::string& category, int action, GLuint beginQuery, GLuint endQuery)
+	{
+		TimelineEvent e;
+
+		e.name		= name;
+		e.category	= category;
+		e.gpu		= true;
+		e.instant	= false;
+		e.frame		= timelineFrame;
+		e.action	= action;
+		e.begin		= 0;
+		e.end		= 0;
+		e.beginQuery	= beginQuery;
+		e.endQuery	= endQuery;
+
+		timelineEvents.push_back(e);
+	}
+
+	/**
+	\fn GLuint Pipeline::acquireTimelineQuery(void)
+	\brief Get a query for the timeline, from the queries of the resolved events if possible.
+	\return The name of the query.
+	**/
+	GLuint Pipeline::acquireTimelineQuery(void)
+	{
+		GLuint query = 0;
+
+		if(timelineQueries.empty())
+			glGenQueries(1, &query);
+		else
+		{
+			query = timelineQueries.back();
+			timelineQueries.pop_back();
+		}
+
+		return query;
+	}
+
+	/**
+	\fn void Pipeline::releaseTimelineEvent(TimelineEvent& e)
+	\brief Give the queries of an event back to the timeline, for the following runs.
+	\param e The event.
+	**/
+	void Pipeline::releaseTimelineEvent(TimelineEvent& e)
+	{
+		if(e.beginQuery>0)
+		{
+			timelineQueries.push_back(e.beginQuery);
+			timelineQueries.push_back(e.endQuery);
+		}
+		e.beginQuery	= 0;
+		e.endQuery	= 0;
+	}
+
+	/**
+	\fn GLint64 Pipeline::beginTimelineFrame(void)
+	\brief Start recording a new run in the timeline, the results available are read and the oldest runs are discarded.
+	\return The time at the beginning of the run, in nanoseconds, on the GL clock.
+	**/
+	GLint64 Pipeline::beginTimelineFrame(void)
+	{
+		GLint64 t = 0;
+
+		resolveTimelineEvents(false);
+		timelineFrame++;
+
+		// Drop the oldest runs :
+		while(!timelineEvents.empty() && timelineEvents.front().frame<=timelineFrame-timelineMaxFrames)
+		{
+			releaseTimelineEvent(timelineEvents.front());
+			timelineEvents.pop_front();
+		}
+
+		#ifdef GLIP_USE_GL
+			glGetInteger64v(GL_TIMESTAMP, &t);
+		#endif
+
+		return t;
+	}
+
+	/**
+	\fn void Pipeline::resolveTimelineEvents(bool wait)
+	\brief Read the timestamp queries of the pending GPU events.
+	\param wait If false, stop at the first event which is not yet available. Otherwise, wait for all the results.
+	**/
+	void Pipeline::resolveTimelineEvents(bool wait)
+	{
+		#ifdef GLIP_USE_GL
+		for(std::deque<TimelineEvent>::iterator it=timelineEvents.begin(); it!=timelineEvents.end(); it++)
+		{
+			if(it->beginQuery==0)
+				continue;
+
+			if(!wait)
+			{
+				GLint available = 0;
+				glGetQueryObjectiv(it->endQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+
+				if(available==0)
+					break;
+			}
+
+			GLuint64 t = 0;
+			glGetQueryObjectui64v(it->beginQuery, GL_QUERY_RESULT, &t);
+			it->begin = static_cast<GLint64>(t);
+			glGetQueryObjectui64v(it->endQuery, GL_QUERY_RESULT, &t);
+			it->end = static_cast<GLint64>(t);
+
+			releaseTimelineEvent(*it);
+		}
+
+		#ifdef __GLIPLIB_TRACK_GL_ERRORS__
+			OPENGL_ERROR_TRACKER("Pipeline::resolveTimelineEvents", "glGetQueryObjectui64v()")
+		#endif
+		#else
+			UNUSED_PARAMETER(wait)
+		#endif
+	}
+
+	/**
+	\fn void Pipeline::clearTimeline(void)
+	\brief Remove all the events of the timeline and release the pending queries.
+	**/
+	void Pipeline::clearTimeline(void)
+	{
+		for(std::deque<TimelineEvent>::iterator it=timelineEvents.begin(); it!=timelineEvents.end(); it++)
+			releaseTimelineEvent(*it);
+		timelineEvents.clear();
+		timelineFrame = 0;
+
+		if(!timelineQueries.empty())
+			glDeleteQueries(timelineQueries.size(), &timelineQueries[0]);
+		timelineQueries.clear();
+	}
+
+	/**
+	\fn void Pipeline::enableTimeline(int maxFrames)
+	\brief Start recording the timeline of the following runs. This requires timestamp queries (OpenGL 3.3). Calling this function again will reset the previous records.
+	\param maxFrames Number of runs kept, the oldest runs are discarded.
+	**/
+	void Pipeline::enableTimeline(int maxFrames)
+	{
+		#ifdef GLIP_USE_GL
+		if(!GLEW_VERSION_3_3)
+		#endif
+			throw Exception("Pipeline::enableTimeline - Timestamp queries are not supported (requires OpenGL 3.3).", __FILE__, __LINE__, Exception::GLException);
+
+		if(maxFrames<=0)
+			throw Exception("Pipeline::enableTimeline - The number of frames must be strictly positive.", __FILE__, __LINE__, Exception::CoreException);
+
+		clearTimeline();
+		timelineRecording 	= true;
+		timelineMaxFrames	= maxFrames;
+	}
+
+	/**
+	\fn void Pipeline::disableTimeline(void)
+	\brief Stop recording the timeline and discard the records.
+	**/
+	void Pipeline::disableTimeline(void)
+	{
+		timelineRecording = false;
+		clearTimeline();
+	}
+
+	/**
+	\fn bool Pipeline::isTimelineEnabled(void) const
+	\brief Test if the timeline is being recorded.
+	\return True if the timeline is being recorded.
+	**/
+	bool Pipeline::isTimelineEnabled(void) const
+	{
+		return timelineRecording;
+	}
+
+	static std::string escapeJSON(const std::string& str)
+	{
+		std::string result;
+
+		for(std::string::const_iterator it=str.begin(); it!=str.end(); it++)
+		{
+			const unsigned char c = static_cast<unsigned char>(*it);
+
+			if(c=='\"' || c=='\\')
+			{
+				result += '\\';
+				result += *it;
+			}
+			else if(c=='\n')
+				result += "\\n";
+			else if(c=='\r')
+				result += "\\r";
+			else if(c=='\t')
+				result += "\\t";
+			else if(c<0x20)
+			{
+				// The other control characters are not allowed in the strings :
+				const char hexDigits[] = "0123456789ABCDEF";
+				result += "\\u00";
+				result += hexDigits[c >> 4];
+				result += hexDigits[c & 0x0F];
+			}
+			else
+				result += *it;
+		}
+
+		return result;
+	}
+
+	/**
+	\fn std::string Pipeline::getTimeline(void)
+	\brief Get the recorded timeline in the Chrome trace event format (JSON). This function waits for the GPU results which are not yet available.
+
+	The events of the CPU (submission, inputs binding, FBO switches) are on the thread 0 while the events of the GPU (execution of each action, mipmaps generation) are on the thread 1. The runs of Pipeline::processBatch appear as a single frame, each action covering all the sets. All times are on the OpenGL clock.
+	\return A string containing the JSON description of the timeline.
+	**/
+	std::string Pipeline::getTimeline(void)
+	{
+		resolveTimelineEvents(true);
+
+		std::stringstream str;
+		str.precision(3);
+		str << std::fixed;
+
+		str << "{\n\"displayTimeUnit\" : \"ms\",\n\"traceEvents\" : [\n";
+		str << "\t{\"name\" : \"process_name\", \"ph\" : \"M\", \"pid\" : 0, \"tid\" : 0, \"args\" : {\"name\" : \"" << escapeJSON(getFullName()) << "\"}},\n";
+		str << "\t{\"name\" : \"thread_name\", \"ph\" : \"M\", \"pid\" : 0, \"tid\" : 0, \"args\" : {\"name\" : \"CPU\"}},\n";
+		str << "\t{\"name\" : \"thread_name\", \"ph\" : \"M\", \"pid\" : 0, \"tid\" : 1, \"args\" : {\"name\" : \"GPU\"}}";
+
+		for(std::deque<TimelineEvent>::const_iterator it=timelineEvents.begin(); it!=timelineEvents.end(); it++)
+		{
+			str << ",\n\t{\"name\" : \"" << escapeJSON(it->name) << "\", \"cat\" : \"" << escapeJSON(it->category) << "\", ";
+
+			if(it->instant)
+				str << "\"ph\" : \"i\", \"s\" : \"t\", ";
+			else
+				str << "\"ph\" : \"X\", \"dur\" : " << static_cast<double>(it->end - it->begin)/1e3 << ", ";
+
+			str << "\"ts\" : " << static_cast<double>(it->begin)/1e3 << ", \"pid\" : 0, \"tid\" : " << (it->gpu ? 1 : 0) << ", \"args\" : {\"frame\" : " << it->frame;
+			if(it->action>=0)
+				str << ", \"action\" : " << it->action;
+			str << "}}";
+		}
+
+		str << "\n]\n}\n";
+
+		return str.str();
+	}
+
+	/**
+	\fn void Pipeline::saveTimeline(const std::string& filename)
+	\brief Save the recorded timeline to a file in the Chrome trace event format (see Pipeline::getTimeline).
+	\param filename Filename of the output.
+	**/
+	void Pipeline::saveTimeline(const std::string& filename)
+	{
+		std::fstream file;
+		file.open(filename.c_str(), std::fstream::out | std::fstream::trunc);
+
+		if(!file.is_open())
+			throw Exception("Pipeline::saveTimeline - Cannot write to file " + filename + ".", __FILE__, __LINE__, Exception::CoreException);
+
+		file << getTimeline();
+		file.close();
+	}
+
@@ -22,6 +22,8 @@
 **/
 
 #include <algorithm>
+#include <set>
+#include <cctype>
 #include "Core/ShaderSource.hpp"
 #include "devDebugTools.hpp"
 #include "Core/OglInclude.hpp"
@@ -49,6 +51,12 @@ using namespace Glip::CoreGL;
 		sourceName(_sourceName)
 	{ }
 
+// ShaderSource::Token :
+	ShaderSource::Token::Token(Kind _kind, const std::string& _str)
+	 :	kind(_kind),
+		str(_str)
+	{ }
+
 // ShaderSource : 
 	std::string ShaderSource::portNameForFragColor = "outputTexture";
 
@@ -65,12 +73,17 @@ using namespace Glip::CoreGL;
 		inSamplers2D(ss.inSamplers2D),
 		uniformVars(ss.uniformVars),
 		uniformVarsType(ss.uniformVarsType),
+		uniformBlocks(ss.uniformBlocks),
 		outFragments(ss.outFragments),
+		outFragmentsType(ss.outFragmentsType),
 		compatibilityRequest(ss.compatibilityRequest),
 		versionNumber(ss.versionNumber),
 		startLine(ss.startLine),
 		linesInfo(ss.linesInfo)
-	{ }
+	{
+		for(int k=0; k<3; k++)
+			workGroupSize[k] = ss.workGroupSize[k];
+	}
 
 	/**
 	\fn    ShaderSource::ShaderSource(const std::string& src, const std::string& _sourceName, int _startLine, const std::map<int,LineInfo>& _linesInfo)
@@ -287,6 +300,21 @@ using namespace Glip::CoreGL;
 		//else if(str	== "sampler2DRect")	typeCode = GL_SAMPLER_2D;
 		//else if(str	== "usampler2DRect")	typeCode = GL_SAMPLER_2D;
 		//else if(str	== "isampler2DRect")	typeCode = GL_SAMPLER_2D;
+		else if(str	== "sampler2DArray")		typeCode = GL_SAMPLER_2D;	// Layered inputs (see HdlAbstractTextureFormat::isLayered()).
+		else if(str	== "usampler2DArray")		typeCode = GL_SAMPLER_2D;
+		else if(str	== "isampler2DArray")		typeCode = GL_SAMPLER_2D;
+		else if(str	== "sampler3D")			typeCode = GL_SAMPLER_2D;
+		else if(str	== "usampler3D")		typeCode = GL_SAMPLER_2D;
+		else if(str	== "isampler3D")		typeCode = GL_SAMPLER_2D;
+		else if(str	== "image2D")			typeCode = GL_IMAGE_2D;
+		else if(str	== "iimage2D")			typeCode = GL_INT_IMAGE_2D;
+		else if(str	== "uimage2D")			typeCode = GL_UNSIGNED_INT_IMAGE_2D;
+		else if(str	== "image2DArray")		typeCode = GL_IMAGE_2D_ARRAY;
+		else if(str	== "iimage2DArray")		typeCode = GL_INT_IMAGE_2D_ARRAY;
+		else if(str	== "uimage2DArray")		typeCode = GL_UNSIGNED_INT_IMAGE_2D_ARRAY;
+		else if(str	== "image3D")			typeCode = GL_IMAGE_3D;
+		else if(str	== "iimage3D")			typeCode = GL_INT_IMAGE_3D;
+		else if(str	== "uimage3D")			typeCode = GL_UNSIGNED_INT_IMAGE_3D;
 		else if(str	== "unsigned" && cpl=="int")	typeCode = GL_UNSIGNED_INT;
  		else
 			throw Exception("ShaderSource::parseUniformLine - Unknown or unsupported uniform type \"" + str + "\".", __FILE__, __LINE__, Exception::GLException);
@@ -327,6 +355,13 @@ using namespace Glip::CoreGL;
 		return typeCode;
 	}
 
+	bool ShaderSource::isImageType(GLenum typeCode)
+	{
+		return (typeCode==GL_IMAGE_2D || typeCode==GL_INT_IMAGE_2D || typeCode==GL_UNSIGNED_INT_IMAGE_2D ||
+			typeCode==GL_IMAGE_2D_ARRAY || typeCode==GL_INT_IMAGE_2D_ARRAY || typeCode==GL_UNSIGNED_INT_IMAGE_2D_ARRAY ||
+			typeCode==GL_IMAGE_3D || typeCode==GL_INT_IMAGE_3D || typeCode==GL_UNSIGNED_INT_IMAGE_3D);
+	}
+
 	void ShaderSource::parseCode(void)
 	{
 		const std::string 	wordsDelim 	= ".,;/\\?*+-:#'\"",
@@ -337,7 +372,11 @@ using namespace Glip::CoreGL;
 		inSamplers2D.clear();
 		uniformVars.clear();
 		uniformVarsType.clear();
+		uniformBlocks.clear();
 		outFragments.clear();
+		outFragmentsType.clear();
+		for(int k=0; k<3; k++)
+			workGroupSize[k] = 0;
 
 		// Parse the lines :
 		parseLines();
@@ -346,6 +385,40 @@ using namespace Glip::CoreGL;
 		while( removeBlock(tmpSource, "//", "\n", false) ) ;
 		while( removeBlock(tmpSource, "/*", "*/", false) ) ;		
 		const bool hasGl_FragColor = (tmpSource.find("gl_FragColor")!=std::string::npos); // Test if this is using a gl_FragColor (not in a comment).
+
+		// Find the names of the uniform blocks (uniform Name { ... } [instance];) before their bodies are removed, and the work group size of compute shaders (layout(local_size_x = X, ...) in;) before the parentheses are removed :
+		std::vector<Token> tokens;
+		tokenize(tmpSource, tokens);
+		bool isCompute = false;
+		for(int k=0; k<static_cast<int>(tokens.size()); k++)
+		{
+			if(tokens[k].kind==Token::Identifier && tokens[k].str.compare(0, 11, "local_size_")==0 && tokens[k].str.size()==12)
+			{
+				const int	d = tokens[k].str[11] - 'x',
+						t = nextToken(tokens, k),
+						u = (t>=0) ? nextToken(tokens, t) : -1;
+
+				if(d<0 || d>2)
+					continue;
+				if(u<0 || tokens[t].str!="=" || tokens[u].kind!=Token::Number || !fromString(tokens[u].str, workGroupSize[d]) || workGroupSize[d]<=0)
+					throw Exception("ShaderSource::parseCode - Cannot read the work group size from the declaration of " + tokens[k].str + " in " + getSourceName() + ".", __FILE__, __LINE__, Exception::GLException);
+				isCompute = true;
+			}
+
+			if(tokens[k].kind!=Token::Identifier || tokens[k].str!="uniform")
+				continue;
+
+			const int 	t = nextToken(tokens, k),
+					u = (t>=0) ? nextToken(tokens, t) : -1;
+
+			if(u>=0 && tokens[t].kind==Token::Identifier && tokens[u].str=="{")
+				uniformBlocks.push_back(tokens[t].str);
+		}
+
+		// The undeclared dimensions of the work group default to 1 :
+		for(int k=0; k<3 && isCompute; k++)
+			workGroupSize[k] = std::max(workGroupSize[k], 1);
+
 		while( removeBlock(tmpSource, "{", "}", true) ) ;
 		while( removeBlock(tmpSource, "(", ")", true) ) ;
 
@@ -359,7 +432,8 @@ using namespace Glip::CoreGL;
 		// Read it :
 		const std::string 	versionKeyword 	= "#version",
 					uniformKeyword 	= "uniform",
-					outKeyword 	= "out";
+					outKeyword 	= "out",
+					qualifiers	= " readonly writeonly coherent volatile restrict lowp mediump highp ";
 
 		bool 	previousWasVersion 	= false,
 			previousWasUniform 	= false,
@@ -392,6 +466,14 @@ using namespace Glip::CoreGL;
 				if(!fromString(split[k], versionNumber))
 					throw Exception("ShaderSource::parseCode - GLSL version number cannot be read from string \"" + split[k] + "\".", __FILE__, __LINE__, Exception::GLException);
 			}
+			else if(previousWasUniform && !readingVarNames && qualifiers.find(" " + split[k] + " ")!=std::string::npos)
+				continue; // Memory and precision qualifiers.
+			else if(previousWasUniform && !readingVarNames && std::find(uniformBlocks.begin(), uniformBlocks.end(), split[k])!=uniformBlocks.end())
+			{
+				// Uniform block, skip the instance name :
+				readingVarNames = true;
+				waitComa = true;
+			}
 			else if(previousWasUniform && !readingVarNames && k<(split.size()-1))
 			{
 				typeCode = parseUniformTypeCode(split[k], split[k+1]);
@@ -399,7 +481,13 @@ using namespace Glip::CoreGL;
 			}
 			else if(!waitComa && previousWasUniform && readingVarNames)
 			{
-				if(typeCode != GL_SAMPLER_2D)
+				if(isImageType(typeCode))
+				{
+					// Images are the outputs of compute shaders :
+					outFragments.push_back(split[k]);
+					outFragmentsType.push_back(typeCode);
+				}
+				else if(typeCode != GL_SAMPLER_2D)
 				{
 					uniformVars.push_back(split[k]);
 					uniformVarsType.push_back(typeCode);
@@ -415,6 +503,7 @@ using namespace Glip::CoreGL;
 			else if(!waitComa && previousWasOut && readingVarNames && split[k]!="," && split[k]!="=")
 			{
 				outFragments.push_back(split[k]);
+				outFragmentsType.push_back(typeCode);
 			}
 			// else
 				// discard
@@ -427,10 +516,322 @@ using namespace Glip::CoreGL;
 				std::cout << source << std::endl;
 			#endif
 			outFragments.push_back(portNameForFragColor);
+			outFragmentsType.push_back(GL_FLOAT_VEC4);
 			compatibilityRequest = true;
 		}
 	}
 
+	bool ShaderSource::isSizeConstant(const std::vector<Token>& tokens, const std::string& name, int width, int height)
+	{
+		// The name must be declared once, as generated by FORMAT_TO_CONSTANT : const ivec2 name = ivec2(width, height);
+		int numDeclarations = 0;
+		bool match = false;
+
+		for(int k=0; k<static_cast<int>(tokens.size()); k++)
+		{
+			if(tokens[k].kind!=Token::Identifier || tokens[k].str!=name)
+				continue;
+
+			const int p = previousToken(tokens, k);
+			if(p<0 || tokens[p].kind!=Token::Identifier || tokens[p].str=="return" || tokens[p].str=="else")
+				continue;
+
+			numDeclarations++;
+
+			const int pp = previousToken(tokens, p);
+			int t[7], w = 0, h = 0;
+			t[0] = nextToken(tokens, k);
+			for(int l=1; l<7 && t[l-1]>=0; l++)
+				t[l] = nextToken(tokens, t[l-1]);
+
+			match =	tokens[p].str=="ivec2" && pp>=0 && tokens[pp].str=="const" && t[6]>=0 &&
+				tokens[t[0]].str=="=" && tokens[t[1]].str=="ivec2" && tokens[t[2]].str=="(" && tokens[t[4]].str=="," && tokens[t[6]].str==")" &&
+				tokens[t[3]].kind==Token::Number && fromString(tokens[t[3]].str, w) && w==width &&
+				tokens[t[5]].kind==Token::Number && fromString(tokens[t[5]].str, h) && h==height;
+		}
+
+		return numDeclarations==1 && match;
+	}
+
+	bool ShaderSource::isFragCoordExpression(const std::vector<Token>& tokens, int begin, int end, const std::string& inputName, int width, int height, bool followVariables) const
+	{
+		const std::string	expression	= join(tokens, begin, end),
+					fragCoord	= "gl_FragCoord.xy/",
+					sizeQuery	= "textureSize(" + inputName + ",0)";
+
+		if(expression.compare(0, fragCoord.size(), fragCoord)==0)
+		{
+			// Normalized coordinates, the divisor must be the size of the texture :
+			const std::string divisor = expression.substr(fragCoord.size());
+
+			if(divisor==sizeQuery || divisor==("vec2(" + sizeQuery + ")"))
+				return true;
+			else if(divisor.size()>6 && divisor.compare(0, 5, "vec2(")==0 && divisor[divisor.size()-1]==')')
+			{
+				// vec2(format), the constant must have the size of the output :
+				std::vector<Token> divisorTokens;
+				tokenize(divisor.substr(5, divisor.size()-6), divisorTokens);
+				return divisorTokens.size()==1 && divisorTokens.front().kind==Token::Identifier && isSizeConstant(tokens, divisorTokens.front().str, width, height);
+			}
+			else
+				return false;
+		}
+		else if(followVariables)
+		{
+			// A local variable, all its assignments must be fragment coordinates too :
+			const int 	k = nextToken(tokens, begin-1),
+					n = (k>=0) ? nextToken(tokens, k) : -1;
+			if(k<0 || k>=end || (n>=0 && n<end) || tokens[k].kind!=Token::Identifier || isReservedName(tokens[k].str))
+				return false;
+
+			const std::string variable = tokens[k].str;
+			int numAssignments = 0;
+
+			for(int l=0; l<static_cast<int>(tokens.size()); l++)
+			{
+				if(tokens[l].kind!=Token::Identifier || tokens[l].str!=variable)
+					continue;
+
+				const int 	p = previousToken(tokens, l),
+						n = nextToken(tokens, l),
+						nn = (n>=0) ? nextToken(tokens, n) : -1;
+
+				if(p>=0 && tokens[p].str==".")
+					continue;
+				else if(p>=0 && (tokens[p].str=="+" || tokens[p].str=="-") && previousToken(tokens, p)>=0 && tokens[previousToken(tokens, p)].str==tokens[p].str)
+					return false; // Pre-increment or decrement.
+				else if(n<0)
+					continue;
+				else if(tokens[n].str=="=" && (nn<0 || tokens[nn].str!="="))
+				{
+					// Find the end of the assignment :
+					int 	e = nn,
+						depth = 0;
+					for(; e>=0 && e<static_cast<int>(tokens.size()); e++)
+					{
+						if(tokens[e].str=="(" || tokens[e].str=="[")
+							depth++;
+						else if(tokens[e].str==")" || tokens[e].str=="]")
+							depth--;
+
+						if(depth<0 || (depth==0 && (tokens[e].str=="," || tokens[e].str==";")))
+							break;
+					}
+
+					if(nn<0 || !isFragCoordExpression(tokens, nn, e, inputName, width, height, false))
+						return false;
+
+					numAssignments++;
+				}
+				else if(tokens[n].str=="[")
+					return false;
+				else if((tokens[n].str=="+" || tokens[n].str=="-" || tokens[n].str=="*" || tokens[n].str=="/") && nn>=0 && (tokens[nn].str=="=" || tokens[nn].str==tokens[n].str))
+					return false; // Compound assignment or post-increment.
+				else if(tokens[n].str==".")
+				{
+					// Writing to a component :
+					const int 	m = (nn>=0) ? nextToken(tokens, nn) : -1,
+							mm = (m>=0) ? nextToken(tokens, m) : -1;
+
+					if(m>=0 && tokens[m].str=="=" && (mm<0 || tokens[mm].str!="="))
+						return false;
+					else if(m>=0 && (tokens[m].str=="+" || tokens[m].str=="-" || tokens[m].str=="*" || tokens[m].str=="/") && mm>=0 && (tokens[mm].str=="=" || tokens[mm].str==tokens[m].str))
+						return false;
+				}
+			}
+
+			return numAssignments>0;
+		}
+		else
+			return false;
+	}
+
+	void ShaderSource::tokenize(const std::string& code, std::vector<Token>& tokens)
+	{
+		bool lineStart = true;
+		size_t k = 0;
+
+		while(k<code.size())
+		{
+			const char c = code[k];
+			size_t e = k+1;
+
+			if(c=='#' && lineStart)
+			{
+				// Preprocessor line (with possible continuations) :
+				while(e<code.size() && !(code[e]=='\n' && code[e-1]!='\\'))
+					e++;
+				tokens.push_back(Token(Token::Directive, code.substr(k, e-k)));
+				lineStart = false;
+			}
+			else if(std::isspace(c))
+			{
+				lineStart = lineStart || (c=='\n');
+				while(e<code.size() && std::isspace(code[e]))
+				{
+					lineStart = lineStart || (code[e]=='\n');
+					e++;
+				}
+				tokens.push_back(Token(Token::Blank, code.substr(k, e-k)));
+			}
+			else if(c=='/' && e<code.size() && (code[e]=='/' || code[e]=='*'))
+			{
+				if(code[e]=='/')
+					e = std::min(code.find('\n', k), code.size());
+				else
+					e = std::min(code.find("*/", k+2), code.size()-2) + 2;
+				tokens.push_back(Token(Token::Blank, code.substr(k, e-k)));
+			}
+			else if(std::isalpha(c) || c=='_')
+			{
+				while(e<code.size() && (std::isalnum(code[e]) || code[e]=='_'))
+					e++;
+				tokens.push_back(Token(Token::Identifier, code.substr(k, e-k)));
+				lineStart = false;
+			}
+			else if(std::isdigit(c) || (c=='.' && e<code.size() && std::isdigit(code[e])))
+			{
+				while(e<code.size() && (std::isalnum(code[e]) || code[e]=='.' || ((code[e]=='+' || code[e]=='-') && (code[e-1]=='e' || code[e-1]=='E'))))
+					e++;
+				tokens.push_back(Token(Token::Number, code.substr(k, e-k)));
+				lineStart = false;
+			}
+			else
+			{
+				tokens.push_back(Token(Token::Symbol, code.substr(k, 1)));
+				lineStart = false;
+			}
+
+			k = e;
+		}
+	}
+
+	int ShaderSource::nextToken(const std::vector<Token>& tokens, int k)
+	{
+		for(k++; k<static_cast<int>(tokens.size()); k++)
+		{
+			if(tokens[k].kind!=Token::Blank)
+				return k;
+		}
+		return -1;
+	}
+
+	int ShaderSource::previousToken(const std::vector<Token>& tokens, int k)
+	{
+		for(k--; k>=0; k--)
+		{
+			if(tokens[k].kind!=Token::Blank)
+				return k;
+		}
+		return -1;
+	}
+
+	int ShaderSource::splitArguments(const std::vector<Token>& tokens, int k, std::vector<std::pair<int, int> >& arguments)
+	{
+		int 	depth = 0,
+			start = k+1;
+
+		arguments.clear();
+		for(int l=k+1; l<static_cast<int>(tokens.size()); l++)
+		{
+			const std::string& str = tokens[l].str;
+
+			if(tokens[l].kind!=Token::Symbol)
+				continue;
+			else if(str=="(" || str=="[" || str=="{")
+				depth++;
+			else if(depth==0 && str==")")
+			{
+				if(!arguments.empty() || nextToken(tokens, start-1)<l)
+					arguments.push_back(std::pair<int, int>(start, l));
+				return l;
+			}
+			else if(str==")" || str=="]" || str=="}")
+				depth--;
+			else if(depth==0 && str==",")
+			{
+				arguments.push_back(std::pair<int, int>(start, l));
+				start = l+1;
+			}
+		}
+
+		return -1;
+	}
+
+	int ShaderSource::findStatementStart(const std::vector<Token>& tokens, int k)
+	{
+		int l = k-1;
+		for(; l>=0; l--)
+		{
+			if(tokens[l].kind==Token::Directive || tokens[l].str==";" || tokens[l].str=="{" || tokens[l].str=="}")
+				break;
+		}
+		return nextToken(tokens, l);
+	}
+
+	std::string ShaderSource::join(const std::vector<Token>& tokens, int begin, int end, bool withBlanks)
+	{
+		std::string result;
+		for(int k=std::max(begin, 0); k<end && k<static_cast<int>(tokens.size()); k++)
+		{
+			if(withBlanks || tokens[k].kind!=Token::Blank)
+				result += tokens[k].str;
+		}
+		return result;
+	}
+
+	bool ShaderSource::isReservedName(const std::string& name)
+	{
+		static const char* reservedNames[] = {	// Keywords and types :
+							"attribute", "const", "uniform", "varying", "buffer", "shared", "layout", "centroid", "flat", "smooth", "noperspective", "patch", "sample",
+							"break", "continue", "do", "for", "while", "switch", "case", "default", "if", "else", "subroutine", "in", "out", "inout", "invariant", "precise",
+							"discard", "return", "struct", "true", "false", "lowp", "mediump", "highp", "precision", "coherent", "volatile", "restrict", "readonly", "writeonly",
+							"void", "bool", "int", "uint", "float", "double", "vec2", "vec3", "vec4", "dvec2", "dvec3", "dvec4", "bvec2", "bvec3", "bvec4", "ivec2", "ivec3", "ivec4", "uvec2", "uvec3", "uvec4",
+							"mat2", "mat3", "mat4", "mat2x2", "mat2x3", "mat2x4", "mat3x2", "mat3x3", "mat3x4", "mat4x2", "mat4x3", "mat4x4",
+							"dmat2", "dmat3", "dmat4", "dmat2x2", "dmat2x3", "dmat2x4", "dmat3x2", "dmat3x3", "dmat3x4", "dmat4x2", "dmat4x3", "dmat4x4",
+							"sampler1D", "sampler2D", "sampler3D", "samplerCube", "sampler1DShadow", "sampler2DShadow", "samplerCubeShadow", "sampler1DArray", "sampler2DArray", "sampler1DArrayShadow", "sampler2DArrayShadow",
+							"isampler1D", "isampler2D", "isampler3D", "isamplerCube", "isampler1DArray", "isampler2DArray", "usampler1D", "usampler2D", "usampler3D", "usamplerCube", "usampler1DArray", "usampler2DArray",
+							"sampler2DRect", "sampler2DRectShadow", "isampler2DRect", "usampler2DRect", "samplerBuffer", "isamplerBuffer", "usamplerBuffer",
+							"sampler2DMS", "isampler2DMS", "usampler2DMS", "sampler2DMSArray", "isampler2DMSArray", "usampler2DMSArray", "samplerCubeArray", "samplerCubeArrayShadow", "isamplerCubeArray", "usamplerCubeArray",
+							// Preprocessor :
+							"define", "undef", "ifdef", "ifndef", "elif", "endif", "error", "line", "defined",
+							// Built-in functions :
+							"radians", "degrees", "sin", "cos", "tan", "asin", "acos", "atan", "sinh", "cosh", "tanh", "asinh", "acosh", "atanh",
+							"pow", "exp", "log", "exp2", "log2", "sqrt", "inversesqrt", "abs", "sign", "floor", "trunc", "round", "roundEven", "ceil", "fract", "mod", "modf", "min", "max", "clamp", "mix", "step", "smoothstep",
+							"isnan", "isinf", "floatBitsToInt", "floatBitsToUint", "intBitsToFloat", "uintBitsToFloat", "fma", "frexp", "ldexp",
+							"packUnorm2x16", "packSnorm2x16", "packUnorm4x8", "packSnorm4x8", "unpackUnorm2x16", "unpackSnorm2x16", "unpackUnorm4x8", "unpackSnorm4x8", "packHalf2x16", "unpackHalf2x16", "packDouble2x32", "unpackDouble2x32",
+							"length", "distance", "dot", "cross", "normalize", "faceforward", "reflect", "refract", "matrixCompMult", "outerProduct", "transpose", "determinant", "inverse",
+							"lessThan", "lessThanEqual", "greaterThan", "greaterThanEqual", "equal", "notEqual", "any", "all", "not",
+							"uaddCarry", "usubBorrow", "umulExtended", "imulExtended", "bitfieldExtract", "bitfieldInsert", "bitfieldReverse", "bitCount", "findLSB", "findMSB",
+							"textureSize", "textureQueryLod", "textureQueryLevels", "textureSamples", "texture", "textureProj", "textureLod", "textureOffset", "texelFetch", "texelFetchOffset", "textureProjOffset", "textureLodOffset",
+							"textureProjLod", "textureProjLodOffset", "textureGrad", "textureGradOffset", "textureProjGrad", "textureProjGradOffset", "textureGather", "textureGatherOffset", "textureGatherOffsets",
+							"texture1D", "texture1DProj", "texture1DLod", "texture1DProjLod", "texture2D", "texture2DProj", "texture2DLod", "texture2DProjLod", "texture2DRect", "texture3D", "texture3DProj", "texture3DLod", "texture3DProjLod", "textureCube", "textureCubeLod",
+							"dFdx", "dFdy", "dFdxFine", "dFdyFine", "dFdxCoarse", "dFdyCoarse", "fwidth", "fwidthFine", "fwidthCoarse", "interpolateAtCentroid", "interpolateAtSample", "interpolateAtOffset",
+							"noise1", "noise2", "noise3", "noise4", "ftransform"};
+		static std::set<std::string> names;
+
+		if(names.empty())
+			names.insert(reservedNames, reservedNames + sizeof(reservedNames)/sizeof(char*));
+
+		return names.find(name)!=names.end();
+	}
+
+	std::string ShaderSource::renameToken(const std::vector<Token>& tokens, int k, const std::string& prefix, const std::vector<std::string>& keptNames)
+	{
+		const std::string& name = tokens[k].str;
+		const int p = previousToken(tokens, k);
+
+		if(	(p>=0 && tokens[p].str==".") || 
+			isReservedName(name) || 
+			name.compare(0, 3, "gl_")==0 || 
+			name.compare(0, 3, "GL_")==0 || 
+			name.compare(0, 2, "__")==0 || 
+			std::find(keptNames.begin(), keptNames.end(), name)!=keptNames.end())
+			return name;
+		else
+			return prefix + name;
+	}
+
 	/**
 	\fn ShaderSource& ShaderSource::operator=(const ShaderSource& c)
 	\brief Copy operator.
@@ -446,12 +847,17 @@ using namespace Glip::CoreGL;
 		inSamplers2D 		= c.inSamplers2D;
 		uniformVars 		= c.uniformVars;
 		uniformVarsType 	= c.uniformVarsType;
+		uniformBlocks		= c.uniformBlocks;
 		outFragments 		= c.outFragments;
+		outFragmentsType	= c.outFragmentsType;
 		compatibilityRequest 	= c.compatibilityRequest;
 		versionNumber 		= c.versionNumber;
 		startLine		= c.startLine;
 		linesInfo		= c.linesInfo;
 
+		for(int k=0; k<3; k++)
+			workGroupSize[k] = c.workGroupSize[k];
+
 		return (*this);
 	}
 
@@ -566,6 +972,33 @@ using namespace Glip::CoreGL;
 		return versionNumber;
 	}
 
+	/**
+	\fn bool ShaderSource::isComputeSource(void) const
+	\brief Test if this source is a compute shader (it declares its work group size with layout(local_size_x = ...) in;).
+	\return True if this source is a compute shader.
+	**/
+	bool ShaderSource::isComputeSource(void) const
+	{
+		return workGroupSize[0]>0;
+	}
+
+	/**
+	\fn void ShaderSource::getWorkGroupSize(int& x, int& y, int& z) const
+	\brief Get the local work group size declared by a compute shader (the undeclared dimensions are equal to 1).
+	\param x Size along the X dimension.
+	\param y Size along the Y dimension.
+	\param z Size along the Z dimension.
+	**/
+	void ShaderSource::getWorkGroupSize(int& x, int& y, int& z) const
+	{
+		if(!isComputeSource())
+			throw Exception("ShaderSource::getWorkGroupSize - The source " + getSourceName() + " is not a compute shader.", __FILE__, __LINE__, Exception::GLException);
+
+		x = workGroupSize[0];
+		y = workGroupSize[1];
+		z = workGroupSize[2];
+	}
+
 	/**
 	\fn bool ShaderSource::empty(void) const
 	\brief Test if the source is empty.
@@ -699,3 +1132,310 @@ using namespace Glip::CoreGL;
 		return uniformVarsType;
 	}
 
+
+	/**
+	\fn const std::vector<std::string>& ShaderSource::getUniformBlocks(void) const
+	\brief Return a vector containing the name of all the uniform blocks (their members are not listed in ShaderSource::getUniformVars).
+	\return A vector of standard string.
+	**/
+	const std::vector<std::string>& ShaderSource::getUniformBlocks(void) const
+	{
+		return uniformBlocks;
+	}
+
+	/**
+	\fn const std::vector<GLenum>& ShaderSource::getOutputTypes(void) const
+	\brief Return a vector containing the type of the output textures, in the same order as ShaderSource::getOutputVars (see http://www.opengl.org/sdk/docs/man/xhtml/glGetActiveUniform.xml for a table of possible values).
+	\return A vector of GLenum.
+	**/
+	const std::vector<GLenum>& ShaderSource::getOutputTypes(void) const
+	{
+		return outFragmentsType;
+	}
+
+	/**
+	\fn bool ShaderSource::isPointwiseInput(const std::string& inputName, int width, int height) const
+	\brief Test if an input texture is only read at the location of the current fragment.
+
+	The input must be a sampler2D which is only used in calls to texelFetch(inputName, ivec2(gl_FragCoord.xy), 0), to texture/textureLod (with a level of 0) at gl_FragCoord.xy/vec2(format) (format being the constant inserted from FORMAT_TO_CONSTANT for the size of the output) or gl_FragCoord.xy/textureSize(inputName, 0) (possibly through a local variable) and to textureSize. This assumes that the input texture has the same size as the output.
+
+	\param inputName The name of the input texture.
+	\param width Width of the output, the format constant (const ivec2, as inserted from FORMAT_TO_CONSTANT) must match it.
+	\param height Height of the output.
+	\return True if the input is read only at the current fragment.
+	**/
+	bool ShaderSource::isPointwiseInput(const std::string& inputName, int width, int height) const
+	{
+		if(std::find(inSamplers2D.begin(), inSamplers2D.end(), inputName)==inSamplers2D.end())
+			return false;
+
+		std::vector<Token> tokens;
+		tokenize(source, tokens);
+
+		for(int k=0; k<static_cast<int>(tokens.size()); k++)
+		{
+			if(tokens[k].kind==Token::Directive)
+			{
+				// Macros hiding the input are not followed :
+				std::vector<Token> directiveTokens;
+				tokenize(tokens[k].str.substr(1), directiveTokens);
+				for(std::vector<Token>::const_iterator it=directiveTokens.begin(); it!=directiveTokens.end(); it++)
+				{
+					if(it->kind==Token::Identifier && it->str==inputName)
+						return false;
+				}
+			}
+			else if(tokens[k].kind==Token::Identifier && tokens[k].str==inputName)
+			{
+				const int 	p = previousToken(tokens, k),
+						s = findStatementStart(tokens, k);
+
+				if(p>=0 && tokens[p].str==".")
+					continue;
+				else if(s>=0 && tokens[s].str=="uniform")
+				{
+					// Declaration, only floating point samplers :
+					int t = nextToken(tokens, s);
+					while(t>=0 && (tokens[t].str=="lowp" || tokens[t].str=="mediump" || tokens[t].str=="highp"))
+						t = nextToken(tokens, t);
+
+					if(t<0 || tokens[t].str!="sampler2D")
+						return false;
+					else
+						continue;
+				}
+				else if(p<0 || tokens[p].str!="(")
+					return false;
+
+				const int f = previousToken(tokens, p);
+				std::vector< std::pair<int, int> > arguments;
+
+				if(f<0 || splitArguments(tokens, p, arguments)<0 || arguments.empty() || join(tokens, arguments[0].first, arguments[0].second)!=inputName)
+					return false;
+
+				const std::string& function = tokens[f].str;
+				if(function=="textureSize")
+					continue;
+				else if(function=="texelFetch")
+				{
+					const std::string coordinates = (arguments.size()==3) ? join(tokens, arguments[1].first, arguments[1].second) : "";
+					if(arguments.size()!=3 || (coordinates!="ivec2(gl_FragCoord.xy)" && coordinates!="ivec2(gl_FragCoord)") || join(tokens, arguments[2].first, arguments[2].second)!="0")
+						return false;
+				}
+				else if(function=="texture" || function=="texture2D")
+				{
+					if(arguments.size()!=2 || !isFragCoordExpression(tokens, arguments[1].first, arguments[1].second, inputName, width, height, true))
+						return false;
+				}
+				else if(function=="textureLod" || function=="texture2DLod")
+				{
+					const std::string level = (arguments.size()==3) ? join(tokens, arguments[2].first, arguments[2].second) : "";
+					if(arguments.size()!=3 || !isFragCoordExpression(tokens, arguments[1].first, arguments[1].second, inputName, width, height, true) || (level!="0" && level!="0.0" && level!="0." && level!="0.0f"))
+						return false;
+				}
+				else
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	\fn ShaderSource ShaderSource::fuse(const std::vector<const ShaderSource*>& sources, const std::vector<std::string>& prefixes, const std::vector<int>& consumers, const std::vector<std::string>& consumedInputs, int width, int height, const std::string& storeConversion, const std::string& _sourceName)
+	\brief Merge a tree of fragment shaders into a single one.
+
+	All the identifiers of each source are prefixed (uniform variables, functions, global variables, etc.), except for the outputs of the last source. The outputs of the other sources are turned into global variables and their reading in the consumer source is replaced by the variable itself (see ShaderSource::isPointwiseInput). The generated main function calls the main function of each source in order.
+
+	\param sources The sources, in an order where all the producers appear before their consumer.
+	\param prefixes The prefixes added to the identifiers of each source (must be distinct).
+	\param consumers For each source, the index of the source reading its (single) output, or -1 for the last source.
+	\param consumedInputs For each source, the name of the input texture reading its output in the consumer source.
+	\param width The width of the output textures.
+	\param height The height of the output textures.
+	\param storeConversion GLSL expression of the vec4 variable v emulating the storage of the intermediate results in a texture (clamping, missing channels...).
+	\param _sourceName Name of the generated source.
+	\return The fused source.
+	**/
+	ShaderSource ShaderSource::fuse(const std::vector<const ShaderSource*>& sources, const std::vector<std::string>& prefixes, const std::vector<int>& consumers, const std::vector<std::string>& consumedInputs, int width, int height, const std::string& storeConversion, const std::string& _sourceName)
+	{
+		const int n = sources.size();
+		int 	version = 0,
+			root = -1;
+		std::vector<std::string>	producerVars(n),
+						extensions;
+		std::string			code;
+
+		if(n==0 || static_cast<int>(prefixes.size())!=n || static_cast<int>(consumers.size())!=n || static_cast<int>(consumedInputs.size())!=n)
+			throw Exception("ShaderSource::fuse - Invalid arguments.", __FILE__, __LINE__, Exception::CoreException);
+
+		for(int i=0; i<n; i++)
+		{
+			if(consumers[i]<0 && root<0)
+				root = i;
+			else if(consumers[i]<0 || consumers[i]<=i || consumers[i]>=n)
+				throw Exception("ShaderSource::fuse - Invalid consumer for source " + sources[i]->getSourceName() + ".", __FILE__, __LINE__, Exception::CoreException);
+			else if(sources[i]->getOutputVars().size()!=1 || sources[i]->requiresCompatibility())
+				throw Exception("ShaderSource::fuse - The source " + sources[i]->getSourceName() + " must have exactly one output (out vec4) to be fused.", __FILE__, __LINE__, Exception::CoreException);
+			else
+				producerVars[i] = prefixes[i] + sources[i]->getOutputVars().front();
+		}
+
+		if(root!=n-1)
+			throw Exception("ShaderSource::fuse - The last source must be the only one without consumer.", __FILE__, __LINE__, Exception::CoreException);
+
+		for(int i=0; i<n; i++)
+		{
+			std::vector<Token> tokens;
+			tokenize(sources[i]->source, tokens);
+
+			std::vector<bool> 				removed(tokens.size(), false);
+			std::map<int, std::pair<int, std::string> > 	replacements; // First token -> last token and replacement.
+			const std::vector<std::string>			keptNames = (i==root) ? sources[i]->getOutputVars() : std::vector<std::string>();
+
+			// Refuse the constructions which cannot be renamed safely :
+			for(int k=0; k<static_cast<int>(tokens.size()); k++)
+			{
+				const int 	t = nextToken(tokens, k),
+						u = (t>=0) ? nextToken(tokens, t) : -1;
+
+				if(tokens[k].kind==Token::Identifier && (tokens[k].str=="struct" || tokens[k].str=="layout" || (tokens[k].str=="uniform" && u>=0 && tokens[u].str=="{")))
+					throw Exception("ShaderSource::fuse - Cannot fuse the source " + sources[i]->getSourceName() + " (structures, blocks and layout qualifiers are not supported).", __FILE__, __LINE__, Exception::CoreException);
+			}
+
+			// Remove the inputs provided by the fused producers :
+			for(int j=0; j<n; j++)
+			{
+				if(consumers[j]!=i)
+					continue;
+
+				for(int k=0; k<static_cast<int>(tokens.size()); k++)
+				{
+					if(tokens[k].kind!=Token::Identifier || tokens[k].str!=consumedInputs[j])
+						continue;
+
+					const int 	p = previousToken(tokens, k),
+							s = findStatementStart(tokens, k);
+
+					if(p>=0 && tokens[p].str==".")
+						continue;
+					else if(s>=0 && tokens[s].str=="uniform")
+					{
+						// Remove the declarator, or the full declaration :
+						const int q = nextToken(tokens, k);
+						int a = k, 
+						    b = k;
+
+						if(p>=0 && tokens[p].str==",")
+							a = p;
+						else if(q>=0 && tokens[q].str==",")
+							b = q;
+						else
+						{
+							a = s;
+							while(b<static_cast<int>(tokens.size())-1 && tokens[b].str!=";")
+								b++;
+						}
+
+						for(int l=a; l<=b; l++)
+							removed[l] = true;
+					}
+					else
+					{
+						const int f = (p>=0) ? previousToken(tokens, p) : -1;
+						std::vector< std::pair<int, int> > arguments;
+						const int e = (f>=0 && tokens[p].str=="(") ? splitArguments(tokens, p, arguments) : -1;
+
+						if(e<0)
+							throw Exception("ShaderSource::fuse - Cannot replace the input " + consumedInputs[j] + " in the source " + sources[i]->getSourceName() + ".", __FILE__, __LINE__, Exception::CoreException);
+						else if(tokens[f].str=="textureSize")
+							replacements[f] = std::pair<int, std::string>(e, "ivec2(" + toString(width) + ", " + toString(height) + ")");
+						else
+							replacements[f] = std::pair<int, std::string>(e, producerVars[j]);
+					}
+				}
+			}
+
+			// Write the renamed code :
+			std::string	renamed;
+			int 		depth = 0;
+			for(int k=0; k<static_cast<int>(tokens.size()); k++)
+			{
+				std::map<int, std::pair<int, std::string> >::const_iterator it = replacements.find(k);
+
+				if(removed[k])
+					continue;
+				else if(it!=replacements.end())
+				{
+					renamed += it->second.second;
+					k = it->second.first;
+				}
+				else if(tokens[k].kind==Token::Directive)
+				{
+					std::vector<Token> directiveTokens;
+					tokenize(tokens[k].str.substr(1), directiveTokens);
+
+					const int d = nextToken(directiveTokens, -1);
+					const std::string directive = (d>=0) ? directiveTokens[d].str : "";
+
+					if(directive=="version")
+					{
+						int v = 0;
+						const int w = nextToken(directiveTokens, d);
+						if(w>=0 && fromString(directiveTokens[w].str, v))
+							version = std::max(version, v);
+					}
+					else if(directive=="extension")
+					{
+						if(std::find(extensions.begin(), extensions.end(), tokens[k].str)==extensions.end())
+							extensions.push_back(tokens[k].str);
+					}
+					else if(directive!="pragma")
+					{
+						renamed += "#";
+						for(int l=0; l<static_cast<int>(directiveTokens.size()); l++)
+							renamed += (directiveTokens[l].kind==Token::Identifier && l!=d) ? renameToken(directiveTokens, l, prefixes[i], keptNames) : directiveTokens[l].str;
+					}
+				}
+				else if(tokens[k].kind==Token::Identifier)
+				{
+					// The outputs of the producers become global variables :
+					if(!(i!=root && depth==0 && tokens[k].str=="out"))
+						renamed += renameToken(tokens, k, prefixes[i], keptNames);
+				}
+				else
+				{
+					if(tokens[k].str=="(" || tokens[k].str=="{")
+						depth++;
+					else if(tokens[k].str==")" || tokens[k].str=="}")
+						depth--;
+
+					renamed += tokens[k].str;
+				}
+			}
+
+			code += "\n// Fused source " + toString(i) + " : " + sources[i]->getSourceName() + "\n" + renamed + "\n";
+		}
+
+		// Assemble :
+		std::string result = (version>0) ? ("#version " + toString(version) + "\n") : "";
+		for(std::vector<std::string>::const_iterator it=extensions.begin(); it!=extensions.end(); it++)
+			result += *it + "\n";
+
+		result += "\nvec4 glipFusionStore(vec4 v)\n{\n\treturn " + storeConversion + ";\n}\n";
+		result += code;
+		result += "\nvoid main()\n{\n";
+		for(int i=0; i<n; i++)
+		{
+			if(i!=root)
+				result += "\t" + producerVars[i] + " = vec4(0.0);\n";
+
+			result += "\t" + prefixes[i] + "main();\n";
+
+			if(i!=root)
+				result += "\t" + producerVars[i] + " = glipFusionStore(" + producerVars[i] + ");\n";
+		}
+		result += "}\n";
+
+		return ShaderSource(result, _sourceName);
+	}
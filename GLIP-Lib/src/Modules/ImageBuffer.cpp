@@ -45,6 +45,11 @@ using namespace Glip::Modules;
 		descriptor(format.getFormatDescriptor()),
 		table(NULL)
 	{
+		if(isLayered())
+			throw Exception("ImageBuffer::ImageBuffer - Layered formats (" + getGLEnumNameSafe(getGLTarget()) + ") cannot be stored in an ImageBuffer.", __FILE__, __LINE__, Exception::ModuleException);
+		if(!descriptor.isDepthValid(getGLDepth()))
+			throw Exception("ImageBuffer::ImageBuffer - Format " + getGLEnumNameSafe(getGLMode()) + " does not support depth : " + getGLEnumNameSafe(getGLDepth()) + ".", __FILE__, __LINE__, Exception::ModuleException);
+
 		setAlignment(_alignment);
 		#ifdef GLIP_USE_GL
 		bool normalized = (descriptor.mode==GL_FLOAT) || (descriptor.mode==GL_DOUBLE);
@@ -66,6 +71,11 @@ using namespace Glip::Modules;
 		descriptor(format.getFormatDescriptor()),
 		table(NULL)
 	{
+		if(isLayered())
+			throw Exception("ImageBuffer::ImageBuffer - Layered formats (" + getGLEnumNameSafe(getGLTarget()) + ") cannot be stored in an ImageBuffer.", __FILE__, __LINE__, Exception::ModuleException);
+		if(!descriptor.isDepthValid(getGLDepth()))
+			throw Exception("ImageBuffer::ImageBuffer - Format " + getGLEnumNameSafe(getGLMode()) + " does not support depth : " + getGLEnumNameSafe(getGLDepth()) + ".", __FILE__, __LINE__, Exception::ModuleException);
+
 		setAlignment(_alignment);
 		#ifdef GLIP_USE_GL
 		bool normalized = (descriptor.mode==GL_FLOAT) || (descriptor.mode==GL_DOUBLE);
@@ -87,6 +97,11 @@ using namespace Glip::Modules;
 		descriptor(texture.getFormatDescriptor()),
 		table(NULL)
 	{
+		if(isLayered())
+			throw Exception("ImageBuffer::ImageBuffer - Layered formats (" + getGLEnumNameSafe(getGLTarget()) + ") cannot be stored in an ImageBuffer.", __FILE__, __LINE__, Exception::ModuleException);
+		if(!descriptor.isDepthValid(getGLDepth()))
+			throw Exception("ImageBuffer::ImageBuffer - Format " + getGLEnumNameSafe(getGLMode()) + " does not support depth : " + getGLEnumNameSafe(getGLDepth()) + ".", __FILE__, __LINE__, Exception::ModuleException);
+
 		setAlignment(_alignment);
 		#ifdef GLIP_USE_GL
 		bool normalized = (descriptor.mode==GL_FLOAT) || (descriptor.mode==GL_DOUBLE);
@@ -294,12 +309,15 @@ using namespace Glip::Modules;
 
 			glPixelStorei(GL_UNPACK_ALIGNMENT, getAlignment());
 
-			// Write :
-			glTexImage2D(GL_TEXTURE_2D, 0, getGLMode(), getWidth(), getHeight(), 0, descriptor.aliasMode, getGLDepth(), table->getPtr());
+			// Write (the storage of the uncompressed textures is allocated at their creation) :
+			if(texture.isCompressed())
+				glTexImage2D(GL_TEXTURE_2D, 0, getGLMode(), getWidth(), getHeight(), 0, descriptor.aliasMode, getGLDepth(), table->getPtr());
+			else
+				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, getWidth(), getHeight(), descriptor.aliasMode, getGLDepth(), table->getPtr());
 
 			GLenum err = glGetError();
 			if(err!=GL_NO_ERROR)
-				throw Exception("ImageBuffer::operator>> - Unable to copy data to texture (glTexImage2D). (OpenGL error : " + getGLEnumNameSafe(err) + ").", __FILE__, __LINE__, Exception::ModuleException);
+				throw Exception("ImageBuffer::operator>> - Unable to copy data to texture (glTexSubImage2D). (OpenGL error : " + getGLEnumNameSafe(err) + ").", __FILE__, __LINE__, Exception::ModuleException);
 
 			if( texture.getMaxLevel()>0 )
 			{
@@ -310,6 +328,8 @@ using namespace Glip::Modules;
 				#endif
 			}
 
+			texture.markAsModified();
+
 			HdlTexture::unbind();
 
 			texture.setMinFilter(getMinFilter());
@@ -460,6 +480,11 @@ using namespace Glip::Modules;
 
 		const bool sameLayout = (src.getGLMode()==getGLMode()),	
 			   sameDepth = (src.getGLDepth()==getGLDepth());
+		
+		// Same channels in the same order (e.g. GL_RGBA16F and GL_RGBA32F) :
+		bool sameChannels = (src.descriptor.numChannels==descriptor.numChannels);
+		for(int k=0; sameChannels && k<descriptor.numChannels; k++)
+			sameChannels = (src.descriptor.channels[k]==descriptor.channels[k]);
 		const int rowOffset = (yFlip ? (height-1) : 0),
 			  rowDirection = (yFlip ? -1 : 1),
 			  columnOffset = (xFlip ? (width-1) : 0),
@@ -468,10 +493,46 @@ using namespace Glip::Modules;
 		// Shortcut : 
 		if(sameLayout && sameDepth && !xFlip)
 		{
-			const size_t rowSize = table->getRowSize();
+			const size_t pixelSize = descriptor.getPixelSize(getGLDepth());
 			
 			for(int y=0; y<height; y++)
-				std::memcpy(reinterpret_cast<char*>(table->getRowPtr(yDst + y)), reinterpret_cast<const char*>(src.table->getRowPtr(ySrc + rowOffset + rowDirection*y)), rowSize);
+				std::memcpy(reinterpret_cast<char*>(table->getRowPtr(yDst + y)) + xDst*pixelSize, reinterpret_cast<const char*>(src.table->getRowPtr(ySrc + rowOffset + rowDirection*y)) + xSrc*pixelSize, width*pixelSize);
+		}
+		else if(sameChannels && !xFlip && ((getGLDepth()==GL_HALF_FLOAT && src.getGLDepth()==GL_FLOAT) || (getGLDepth()==GL_FLOAT && src.getGLDepth()==GL_HALF_FLOAT)))
+		{
+			// Half to single precision (and back), row by row (vectorized, see HalfFloat) :
+			const size_t pixelSize = descriptor.getPixelSize(getGLDepth()),
+				     srcPixelSize = src.descriptor.getPixelSize(src.getGLDepth()),
+				     count = static_cast<size_t>(width) * descriptor.numChannels;
+
+			for(int y=0; y<height; y++)
+			{
+				char* dstRow = reinterpret_cast<char*>(table->getRowPtr(yDst + y)) + xDst*pixelSize;
+				const char* srcRow = reinterpret_cast<const char*>(src.table->getRowPtr(ySrc + rowOffset + rowDirection*y)) + xSrc*srcPixelSize;
+
+				if(getGLDepth()==GL_HALF_FLOAT)
+					HalfFloat::toHalf(reinterpret_cast<HalfFloat*>(dstRow), reinterpret_cast<const float*>(srcRow), count);
+				else
+					HalfFloat::toFloat(reinterpret_cast<float*>(dstRow), reinterpret_cast<const HalfFloat*>(srcRow), count);
+			}
+		}
+		else if(getGLDepth()==GL_HALF_FLOAT || src.getGLDepth()==GL_HALF_FLOAT)
+		{
+			// Half precision cannot be bit-shuffled, go through the normalized values (channel by channel) :
+			char shuffle[HdlTextureFormatDescriptor_MaxNumChannels];
+			HdlTextureFormatDescriptor::getShuffle(descriptor, src.descriptor, shuffle, HdlTextureFormatDescriptor_MaxNumChannels);
+
+			for(int y=0; y<height; y++)
+			{
+				for(int x=0; x<width; x++)
+				{
+					for(int k=0; k<descriptor.numChannels; k++)
+					{
+						const float v = (shuffle[k]>=0) ? src.table->getNormalized(xSrc + columnOffset + columnDirection*x, ySrc + rowOffset + rowDirection*y, shuffle[k]) : 0.0f;
+						table->setNormalized(v, xDst + x, yDst + y, k);
+					}
+				}
+			}
 		}
 		else if(!table->isNormalized() && src.table->isNormalized())
 		{
@@ -487,14 +548,14 @@ using namespace Glip::Modules;
 			if(isBlack)
 			{
 				for(int y=0; y<height; y++)
-					std::memset(table->getRowPtr(yDst + y), 0, width*dstPixelSize);
+					std::memset(reinterpret_cast<char*>(table->getRowPtr(yDst + y)) + xDst*dstPixelSize, 0, width*dstPixelSize);
 			}
 			else
 			{
 				for(int y=0; y<height; y++)
 				{
-					char* dstRow = reinterpret_cast<char*>(table->getRowPtr(yDst + y));
-					const char* srcRow = reinterpret_cast<const char*>(src.table->getRowPtr(ySrc + rowOffset + rowDirection*y));
+					char* dstRow = reinterpret_cast<char*>(table->getRowPtr(yDst + y)) + xDst*dstPixelSize;
+					const char* srcRow = reinterpret_cast<const char*>(src.table->getRowPtr(ySrc + rowOffset + rowDirection*y)) + xSrc*srcPixelSize;
 			
 					for(int x=0; x<width; x++)
 					{
@@ -524,7 +585,7 @@ using namespace Glip::Modules;
 			if(isBlack)
 			{
 				for(int y=0; y<height; y++)
-					std::memset(table->getRowPtr(yDst + y), 0, width*dstPixelSize);
+					std::memset(reinterpret_cast<char*>(table->getRowPtr(yDst + y)) + xDst*dstPixelSize, 0, width*dstPixelSize);
 			}
 			else
 			{
@@ -534,8 +595,8 @@ using namespace Glip::Modules;
 
 				for(int y=0; y<height; y++)
 				{
-					char* dstRow = reinterpret_cast<char*>(table->getRowPtr(yDst + y));
-					const char* srcRow = reinterpret_cast<const char*>(src.table->getRowPtr(ySrc + rowOffset + rowDirection*y));
+					char* dstRow = reinterpret_cast<char*>(table->getRowPtr(yDst + y)) + xDst*dstPixelSize;
+					const char* srcRow = reinterpret_cast<const char*>(src.table->getRowPtr(ySrc + rowOffset + rowDirection*y)) + xSrc*srcPixelSize;
 			
 					for(int x=0; x<width; x++)
 					{
@@ -763,3 +824,274 @@ using namespace Glip::Modules;
 		file.close();
 	}
 
+// AsyncTextureReader
+	AsyncTextureReader::Readback::Readback(HdlPBO* _pbo, const HdlAbstractTextureFormat& _format)
+	 :	pbo(_pbo),
+		fence(NULL),
+		format(_format)
+	{ }
+
+	/**
+	\fn AsyncTextureReader::AsyncTextureReader(int _maxFreeBuffers)
+	\brief AsyncTextureReader constructor.
+	\param _maxFreeBuffers Maximum number of idle pixel buffer objects kept for the next readbacks.
+	**/
+	AsyncTextureReader::AsyncTextureReader(int _maxFreeBuffers)
+	 :	ticketsCounter(1),
+		maxFreeBuffers(_maxFreeBuffers)
+	{
+		if(maxFreeBuffers<0)
+			throw Exception("AsyncTextureReader::AsyncTextureReader - The maximum number of free buffers must be positive or zero (" + toString(maxFreeBuffers) + ").", __FILE__, __LINE__, Exception::ModuleException);
+	}
+
+	AsyncTextureReader::~AsyncTextureReader(void)
+	{
+		while(!readbacks.empty())
+			release(readbacks.begin()->first);
+
+		for(std::vector<HdlPBO*>::iterator it=freeBuffers.begin(); it!=freeBuffers.end(); it++)
+			delete (*it);
+	}
+
+	AsyncTextureReader::Readback& AsyncTextureReader::getReadback(int ticket, const std::string& caller)
+	{
+		std::map<int, Readback*>::iterator it = readbacks.find(ticket);
+
+		if(it==readbacks.end())
+			throw Exception("AsyncTextureReader::" + caller + " - The ticket " + toString(ticket) + " is not pending (it was either never issued or already released).", __FILE__, __LINE__, Exception::ModuleException);
+
+		return *it->second;
+	}
+
+	/**
+	\fn int AsyncTextureReader::read(HdlTexture& texture)
+	\brief Start the readback of a texture. The commands are flushed to the GPU and the function returns immediately. Without sync objects (OpenGL 3.2 or ARB_sync), the function waits for the completion of the copy before returning.
+	\param texture The texture to read (must not be compressed). Its content can be modified right after this call.
+	\return A ticket identifying this readback (strictly positive), to be used with isComplete(), wait(), retrieve() and release().
+	**/
+	int AsyncTextureReader::read(HdlTexture& texture)
+	{
+		#if !defined(GLIP_USE_GLES) && !defined(GLIP_USE_GLES2) && !defined(GLIP_USE_GLES3)
+			if(texture.isCompressed())
+				throw Exception("AsyncTextureReader::read - Compressed textures cannot be read back asynchronously.", __FILE__, __LINE__, Exception::ModuleException);
+			if(texture.isLayered())
+				throw Exception("AsyncTextureReader::read - Layered textures cannot be read back asynchronously (see HdlTexture::read).", __FILE__, __LINE__, Exception::ModuleException);
+
+			// Find a recycled buffer of the right size :
+			HdlPBO* pbo = NULL;
+			for(std::vector<HdlPBO*>::iterator it=freeBuffers.begin(); it!=freeBuffers.end(); it++)
+			{
+				if(static_cast<size_t>((*it)->getSize())==texture.getSize())
+				{
+					pbo = *it;
+					freeBuffers.erase(it);
+					break;
+				}
+			}
+
+			if(pbo==NULL)
+				pbo = new HdlPBO(texture, GL_PIXEL_PACK_BUFFER, GL_STREAM_READ);
+
+			Readback* r = new Readback(pbo, texture);
+
+			// Copy :
+			texture.bind();
+			pbo->bindAsPack();
+			glPixelStorei(GL_PACK_ALIGNMENT, texture.getAlignment());
+
+			glGetTexImage(texture.getGLTarget(), 0, texture.getFormatDescriptor().aliasMode, texture.getGLDepth(), 0);
+
+			GLenum err = glGetError();
+
+			HdlPBO::unbind(GL_PIXEL_PACK_BUFFER);
+			HdlTexture::unbind();
+
+			if(err!=GL_NO_ERROR)
+			{
+				recycle(pbo);
+				delete r;
+				throw Exception("AsyncTextureReader::read - Unable to copy data from texture (glGetTexImage). (OpenGL error : " + getGLEnumNameSafe(err) + ").", __FILE__, __LINE__, Exception::ModuleException);
+			}
+
+			if(GLEW_VERSION_3_2 || GLEW_ARB_sync)
+			{
+				r->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+				glFlush();
+			}
+			else
+				glFinish();
+
+			const int ticket = ticketsCounter;
+			ticketsCounter++;
+			readbacks[ticket] = r;
+
+			return ticket;
+		#else
+			UNUSED_PARAMETER(texture)
+			throw Exception("AsyncTextureReader::read - Not currently supported under GLES.", __FILE__, __LINE__, Exception::GLException);
+		#endif
+	}
+
+	/**
+	\fn bool AsyncTextureReader::isComplete(int ticket)
+	\brief Test, without blocking, if a readback is completed.
+	\param ticket The ticket returned by read().
+	\return True if the data can be retrieved without stalling.
+	**/
+	bool AsyncTextureReader::isComplete(int ticket)
+	{
+		return wait(ticket, 0.0);
+	}
+
+	/**
+	\fn bool AsyncTextureReader::wait(int ticket, double timeout)
+	\brief Wait for the completion of a readback.
+	\param ticket The ticket returned by read().
+	\param timeout Maximum waiting time, in milliseconds (negative to wait until completion, zero to only test).
+	\return True if the readback is completed, false if the timeout expired before.
+	**/
+	bool AsyncTextureReader::wait(int ticket, double timeout)
+	{
+		Readback& r = getReadback(ticket, "wait");
+
+		if(r.fence==NULL)
+			return true;
+
+		GLenum result = GL_TIMEOUT_EXPIRED;
+
+		#ifdef GLIP_USE_GL
+		if(timeout<0.0)
+		{
+			do
+				result = glClientWaitSync(r.fence, 0, std::numeric_limits<GLuint64>::max());
+			while(result==GL_TIMEOUT_EXPIRED);
+		}
+		else
+			result = glClientWaitSync(r.fence, 0, static_cast<GLuint64>(timeout*1e6));
+		#endif
+
+		if(result==GL_WAIT_FAILED)
+			throw Exception("AsyncTextureReader::wait - Unable to wait for the ticket " + toString(ticket) + ".", __FILE__, __LINE__, Exception::GLException);
+		else if(result==GL_TIMEOUT_EXPIRED)
+			return false;
+
+		#ifdef GLIP_USE_GL
+			glDeleteSync(r.fence);
+		#endif
+		r.fence = NULL;
+
+		return true;
+	}
+
+	/**
+	\fn const HdlAbstractTextureFormat& AsyncTextureReader::getFormat(int ticket)
+	\brief Get the format of the texture read by a pending readback (for instance, to allocate the ImageBuffer receiving the data).
+	\param ticket The ticket returned by read().
+	\return The format of the data.
+	**/
+	const HdlAbstractTextureFormat& AsyncTextureReader::getFormat(int ticket)
+	{
+		return getReadback(ticket, "getFormat").format;
+	}
+
+	/**
+	\fn void AsyncTextureReader::retrieve(int ticket, ImageBuffer& image)
+	\brief Copy the result of a readback to an image and release the ticket. Waits for the completion of the readback if needed. The image also receives the filtering and wrapping modes of the texture.
+	\param ticket The ticket returned by read().
+	\param image The target image, it must be compatible with the format of the texture read.
+	**/
+	void AsyncTextureReader::retrieve(int ticket, ImageBuffer& image)
+	{
+		Readback& r = getReadback(ticket, "retrieve");
+
+		if(!image.isCompatibleWith(r.format))
+			throw Exception("AsyncTextureReader::retrieve - Texture and ImageBuffer objects are incompatible.", __FILE__, __LINE__, Exception::ModuleException);
+
+		wait(ticket);
+
+		void* ptr = r.pbo->map(GL_READ_ONLY, GL_PIXEL_PACK_BUFFER);
+
+		if(ptr==NULL)
+		{
+			HdlPBO::unbind(GL_PIXEL_PACK_BUFFER);
+			throw Exception("AsyncTextureReader::retrieve - Unable to map the buffer of the ticket " + toString(ticket) + ".", __FILE__, __LINE__, Exception::GLException);
+		}
+
+		try
+		{
+			ImageBuffer data(ptr, r.format, r.format.getAlignment());
+			image << data;
+		}
+		catch(...)
+		{
+			HdlPBO::unmap(GL_PIXEL_PACK_BUFFER);
+			HdlPBO::unbind(GL_PIXEL_PACK_BUFFER);
+			throw;
+		}
+
+		HdlPBO::unmap(GL_PIXEL_PACK_BUFFER);
+		HdlPBO::unbind(GL_PIXEL_PACK_BUFFER);
+
+		release(ticket);
+	}
+
+	/**
+	\fn void AsyncTextureReader::release(int ticket)
+	\brief Release a ticket without retrieving its data. Its buffer will be used again by the next readbacks.
+	\param ticket The ticket returned by read().
+	**/
+	void AsyncTextureReader::release(int ticket)
+	{
+		Readback& r = getReadback(ticket, "release");
+
+		#ifdef GLIP_USE_GL
+			if(r.fence!=NULL)
+				glDeleteSync(r.fence);
+		#endif
+
+		recycle(r.pbo);
+		delete &r;
+		readbacks.erase(ticket);
+	}
+
+	void AsyncTextureReader::recycle(HdlPBO* pbo)
+	{
+		freeBuffers.push_back(pbo);
+
+		// Release the oldest buffers first :
+		while(static_cast<int>(freeBuffers.size())>maxFreeBuffers)
+		{
+			delete freeBuffers.front();
+			freeBuffers.erase(freeBuffers.begin());
+		}
+	}
+
+	/**
+	\fn int AsyncTextureReader::getNumPendingReadbacks(void) const
+	\brief Get the number of readbacks which were not yet retrieved or released.
+	\return The number of pending readbacks.
+	**/
+	int AsyncTextureReader::getNumPendingReadbacks(void) const
+	{
+		return readbacks.size();
+	}
+
+	/**
+	\fn int AsyncTextureReader::getNumFreeBuffers(void) const
+	\brief Get the number of idle pixel buffer objects, kept for the next readbacks.
+	\return The number of free buffers.
+	**/
+	int AsyncTextureReader::getNumFreeBuffers(void) const
+	{
+		return freeBuffers.size();
+	}
+
+	/**
+	\fn int AsyncTextureReader::getMaxFreeBuffers(void) const
+	\brief Get the maximum number of idle pixel buffer objects kept for the next readbacks.
+	\return The maximum number of free buffers.
+	**/
+	int AsyncTextureReader::getMaxFreeBuffers(void) const
+	{
+		return maxFreeBuffers;
+	}
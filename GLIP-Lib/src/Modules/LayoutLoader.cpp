@@ -59,6 +59,7 @@
 										"GRID_2D",
 										"GRID_3D",
 										"CUSTOM_MODEL",
+										"PROCEDURAL_GRID",
 										"STANDARD_QUAD",
 										"VERTEX",
 										"ELEMENT",
@@ -626,8 +627,10 @@
 		if(mipmap<0)
 			throw Exception("Mipmap cannot be negative for format \"" + e.name + "\". Token : \"" + e.arguments[4] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
 
-		// Create and push (note the 0 base mipmap) :
-		formatList.insert( std::pair<std::string, HdlTextureFormat>( e.name, HdlTextureFormat(w, h, mode, depth, minFilter, magFilter, sWrap, tWrap, 0, mipmap) ) );
+		// Create and push (note the 0 base mipmap, the layers are kept) :
+		HdlTextureFormat format(w, h, mode, depth, minFilter, magFilter, sWrap, tWrap, 0, mipmap);
+		format.setLayers(it->second.getGLTarget(), it->second.getNumLayers());
+		formatList.insert( std::pair<std::string, HdlTextureFormat>( e.name, format ) );
 	}
 
 	void LayoutLoader::buildRequiredSource(const VanillaParserSpace::Element& e)
@@ -798,11 +801,11 @@
 	void LayoutLoader::buildFormat(const VanillaParserSpace::Element& e)
 	{
 		// Preliminary tests :
-		preliminaryTests(e, 1, 4, 9, -1, "Format");
+		preliminaryTests(e, 1, 4, 11, -1, "Format");
 
 		// Get the data :
-		int w, h, mipmap = 0;
-		GLenum mode, depth, minFilter, magFilter, sWrap, tWrap;
+		int w, h, mipmap = 0, layers = 1;
+		GLenum mode, depth, minFilter, magFilter, sWrap, tWrap, target;
 
 		if(!fromString(e.arguments[0], w))
 			throw Exception("Cannot read width for format \"" + e.name + "\". Token : \"" + e.arguments[0] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
@@ -841,6 +844,19 @@
 		else
 			mipmap = 0;
 
+		if(e.arguments.size()>9)
+		{
+			if(!fromString(e.arguments[9], layers))
+				throw Exception("Cannot read number of layers for format \"" + e.name + "\". Token : \"" + e.arguments[9] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
+		}
+		else
+			layers = 1;
+
+		if(e.arguments.size()>10)
+			target = getGLEnum(e.arguments[10]);
+		else
+			target = (layers>1) ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
+
 		// Find possible errors :
 		if(mode==GL_FALSE)
 			throw Exception("Cannot read mode for format \"" + e.name + "\". Token : \"" + e.arguments[2] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
@@ -856,12 +872,20 @@
 			throw Exception("Cannot read TWrapping for format \"" + e.name + "\". Token : \"" + e.arguments[7] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
 		if(mipmap<0)
 			throw Exception("Mipmap cannot be negative for format \"" + e.name + "\". Token : \"" + e.arguments[4] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
+		if(layers<1)
+			throw Exception("Number of layers must be strictly positive for format \"" + e.name + "\". Token : \"" + e.arguments[9] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
+		if(target!=GL_TEXTURE_2D && target!=GL_TEXTURE_2D_ARRAY && target!=GL_TEXTURE_3D)
+			throw Exception("Target must be GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY or GL_TEXTURE_3D for format \"" + e.name + "\". Token : \"" + e.arguments[10] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
+		if(target==GL_TEXTURE_2D && layers!=1)
+			throw Exception("A GL_TEXTURE_2D format must have a single layer (format \"" + e.name + "\").", e.sourceName, e.startLine, Exception::ClientScriptException);
 
 		if(formatList.find(e.name)!=formatList.end())
 			throw Exception("A Format Object with the name \"" + e.name + "\" was already registered.", e.sourceName, e.startLine, Exception::ClientScriptException);
 
 		// Create and push (note the 0 base mipmap) :
-		formatList.insert( std::pair<std::string, HdlTextureFormat>( e.name, HdlTextureFormat(w, h, mode, depth, minFilter, magFilter, sWrap, tWrap, 0, mipmap) ) );
+		HdlTextureFormat format(w, h, mode, depth, minFilter, magFilter, sWrap, tWrap, 0, mipmap);
+		format.setLayers(target, layers);
+		formatList.insert( std::pair<std::string, HdlTextureFormat>( e.name, format ) );
 	}
 
 	void LayoutLoader::buildSource(const VanillaParserSpace::Element& e)
@@ -970,6 +994,24 @@
 
 			geometryList.insert( std::pair<std::string, GeometryModel>( e.name, GeometryPrimitives::PointsGrid3D(w,h,z)) );
 		}
+		else if(e.arguments[0]==keywords[KW_LL_PROCEDURAL_GRID])
+		{
+			if(e.arguments.size()!=3 && e.arguments.size()!=4)
+				throw Exception("The model \"" + std::string(keywords[KW_LL_PROCEDURAL_GRID]) + "\" requires to have either 3 or 4 arguments (included) in geometry \"" + e.name + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
+
+			int w, h, z = 1;
+
+			if(!fromString(e.arguments[1], w) || w<=0)
+				throw Exception("Cannot read width for procedural grid geometry \"" + e.name + "\". Token : \"" + e.arguments[1] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
+
+			if(!fromString(e.arguments[2], h) || h<=0)
+				throw Exception("Cannot read height for procedural grid geometry \"" + e.name + "\". Token : \"" + e.arguments[2] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
+
+			if(e.arguments.size()>3 && (!fromString(e.arguments[3], z) || z<=0))
+				throw Exception("Cannot read depth for procedural grid geometry \"" + e.name + "\". Token : \"" + e.arguments[3] + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
+
+			geometryList.insert( std::pair<std::string, GeometryModel>( e.name, GeometryPrimitives::ProceduralGrid(w,h,z)) );
+		}
 		else if(e.arguments[0]==keywords[KW_LL_CUSTOM_MODEL])
 		{
 			if(e.arguments.size()!=3 && e.arguments.size()!=4)
@@ -1168,6 +1210,8 @@
 				blendingEquation = GL_NONE;
 		bool depthTestingSet = false;
 			GLenum depthTestingFunction = GL_NONE;
+		std::string computeDomain;
+		int numInstances = 1;
 
 		// If the fragment source name is provided in the arguments : 
 		if(e.arguments.size()>1)
@@ -1175,6 +1219,8 @@
 			std::map<std::string,ShaderSource>::iterator fragmentSource = sourceList.find(e.arguments[1]);
 			if(fragmentSource==sourceList.end())
 				throw Exception("No ShaderSource with name \"" + e.arguments[1] + "\" was registered and can be use in Filter \"" + e.name + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
+			else if(fragmentSource->second.isComputeSource())
+				shaders[GL_COMPUTE_SHADER] = &fragmentSource->second;
 			else
 				shaders[GL_FRAGMENT_SHADER] = &fragmentSource->second;
 		}
@@ -1190,7 +1236,7 @@
 				std::map<GLenum, bool> setParametersTest;
 				setParametersTest[GL_VERTEX_SHADER]		= false;
 				setParametersTest[GL_FRAGMENT_SHADER]		= (shaders.find(GL_FRAGMENT_SHADER)!=shaders.end()); // The fragment shader is not already set.
-				setParametersTest[GL_COMPUTE_SHADER]		= false;
+				setParametersTest[GL_COMPUTE_SHADER]		= (shaders.find(GL_COMPUTE_SHADER)!=shaders.end());
 				#ifdef GLIP_USE_GL
 				setParametersTest[GL_TESS_CONTROL_SHADER]	= false;
 				setParametersTest[GL_TESS_EVALUATION_SHADER]	= false;
@@ -1240,7 +1286,7 @@
 						if(setParametersTest[GL_COMPUTE_SHADER])
 							throw Exception("The GL_COMPUTE_SHADER parameter was already set.", parser.elements[k].sourceName, parser.elements[k].startLine, Exception::ClientScriptException);
 		
-						preliminaryTests(parser.elements[k], -1, 1, 1, -1, e.name);
+						preliminaryTests(parser.elements[k], -1, 1, 2, -1, e.name);
 
 						std::map<std::string,ShaderSource>::iterator source = sourceList.find(parser.elements[k].arguments[0]);
 						if(source==sourceList.end())
@@ -1248,6 +1294,9 @@
 						else
 							shaders[GL_COMPUTE_SHADER] = &source->second;
 
+						if(parser.elements[k].arguments.size()>1)
+							computeDomain = parser.elements[k].arguments[1];
+
 						setParametersTest[GL_COMPUTE_SHADER] = true;
 					}
 					#ifdef GLIP_USE_GL
@@ -1300,15 +1349,18 @@
 					else if(glId==GL_RENDER)
 					{
 						if(setParametersTest[GL_RENDER])
-							throw Exception("The GL_GEOMETRY_SHADER parameter was already set.", parser.elements[k].sourceName, parser.elements[k].startLine, Exception::ClientScriptException);
+							throw Exception("The GL_RENDER parameter was already set.", parser.elements[k].sourceName, parser.elements[k].startLine, Exception::ClientScriptException);
 
-						preliminaryTests(parser.elements[k], -1, 1, 1, -1, e.name);
+						preliminaryTests(parser.elements[k], -1, 1, 2, -1, e.name);
 
 						std::map<std::string,GeometryModel>::iterator geometry = geometryList.find(parser.elements[k].arguments[0]);
 						if(geometry==geometryList.end())
 							throw Exception("No Geometry with name \"" + parser.elements[k].arguments[0] + "\" was registered.", parser.elements[k].sourceName, parser.elements[k].startLine, Exception::ClientScriptException);
 						else
 							geometryPtr = &geometry->second;
+
+						if(parser.elements[k].arguments.size()>1 && (!fromString(parser.elements[k].arguments[1], numInstances) || numInstances<1))
+							throw Exception("Cannot read the number of instances for GL_RENDER. Token : \"" + parser.elements[k].arguments[1] + "\".", parser.elements[k].sourceName, parser.elements[k].startLine, Exception::ClientScriptException);
 		
 						setParametersTest[GL_RENDER] = true;
 					}
@@ -1382,6 +1434,23 @@
 
 		if(depthTestingSet)
 			filterLayout->second.enableDepthTesting(depthTestingFunction);
+
+		if(!computeDomain.empty() || numInstances!=1)
+		{
+			try
+			{
+				if(!computeDomain.empty())
+					filterLayout->second.setComputeDomain(computeDomain);
+				filterLayout->second.setNumInstances(numInstances);
+			}
+			catch(Exception& ex)
+			{
+				filterList.erase(filterLayout);
+				Exception m("Exception caught while building FilterLayout \"" + e.name + "\".", e.sourceName, e.startLine, Exception::ClientScriptException);
+				m << ex;
+				throw m;
+			}
+		}
 	}
 
 	void LayoutLoader::buildPipeline(const VanillaParserSpace::Element& e)
@@ -2795,6 +2864,12 @@
 		e.arguments.push_back( getGLEnumName( format.getTWrapping() ) );
 		e.arguments.push_back( toString( format.getMaxLevel() ) );
 
+		if(format.isLayered())
+		{
+			e.arguments.push_back( toString( format.getNumLayers() ) );
+			e.arguments.push_back( getGLEnumName( format.getGLTarget() ) );
+		}
+
 		return e;
 	}
  
@@ -2875,6 +2950,18 @@
 			e.arguments.push_back( toString(y+1) );
 			e.arguments.push_back( toString(z+1) );
 		}
+		else if(mdl.type==GeometryModel::ProceduralGrid)
+		{
+			e.arguments.push_back( LayoutLoader::getKeyword( KW_LL_PROCEDURAL_GRID ) );
+
+			int w, h, d;
+			mdl.getProceduralSize(w, h, d);
+
+			e.arguments.push_back( toString(w) );
+			e.arguments.push_back( toString(h) );
+			if(d>1)
+				e.arguments.push_back( toString(d) );
+		}
 		else if(mdl.type==GeometryModel::CustomModel)
 		{
 			e.arguments.push_back( LayoutLoader::getKeyword( KW_LL_CUSTOM_MODEL ) );
@@ -2975,6 +3062,8 @@
 				el.noBody = true;
 				el.noArgument = false;
 				el.arguments.push_back(name);
+				if(shaderType==GL_COMPUTE_SHADER && !fLayout.getComputeDomain().empty())
+					el.arguments.push_back(fLayout.getComputeDomain());
 				e.body += "\t" + el.getCode() + "\n";
 			}
 		}
@@ -2989,6 +3078,8 @@
 			el.noBody = true;
 			el.noArgument = false;
 			el.arguments.push_back(modelName);
+			if(fLayout.getNumInstances()>1)
+				el.arguments.push_back(toString(fLayout.getNumInstances()));
 			e.body += "\t" + el.getCode() + "\n";
 		}
 
@@ -1940,7 +1940,8 @@
 			LAYOUT_LOADER_MODULE_APPLY( GENERATE_SAME_SIZE_2D_GRID, 2, 4, -1,	"DESCRIPTION{Create a 2D grid geometry of the same size as the format in argument (width and height).}"
 												"ARGUMENT:nameNewGeometry{Name of the new geometry.}"
 												"ARGUMENT:nameFormat{Name of the original format.}"
-												"ARGUMENT:normalized{Either TRUE or FALSE. If enabled, the vertices coordinates will be in the range [0,1].}")
+												"ARGUMENT:normalized{Either TRUE or FALSE. If enabled, the vertices coordinates will be in the range [0,1].}"
+												"ARGUMENT:procedural{Either TRUE or FALSE. If enabled, the grid has no vertex data and the vertex shader must compute the coordinates from gl_VertexID (normalized is then ignored).}")
 			{
 				UNUSED_PARAMETER(body)
 				UNUSED_PARAMETER(currentPath)
@@ -1965,16 +1966,21 @@
 
 				CONST_ITERATOR_TO_FORMAT( it, arguments[1] )
 
-				const bool normalized = (arguments.size()>=3) ? getBoolean(arguments[2], sourceName, startLine) : false;;
+				const bool 	normalized = (arguments.size()>=3) ? getBoolean(arguments[2], sourceName, startLine) : false,
+						procedural = (arguments.size()>=4) ? getBoolean(arguments[3], sourceName, startLine) : false;
 
 				// Build the new geometry : 
-				APPEND_NEW_GEOMETRY( arguments[0], GeometryPrimitives::PointsGrid2D(it->second.getWidth(), it->second.getHeight(), normalized) )
+				if(procedural)
+					APPEND_NEW_GEOMETRY( arguments[0], GeometryPrimitives::ProceduralGrid(it->second.getWidth(), it->second.getHeight()) )
+				else
+					APPEND_NEW_GEOMETRY( arguments[0], GeometryPrimitives::PointsGrid2D(it->second.getWidth(), it->second.getHeight(), normalized) )
 			}
 
-			LAYOUT_LOADER_MODULE_APPLY( GENERATE_SAME_SIZE_3D_GRID, 2, 3, -1,	"DESCRIPTION{Create a 3D grid geometry of the same size as the format in argument (width, height and number of channels).}"
+			LAYOUT_LOADER_MODULE_APPLY( GENERATE_SAME_SIZE_3D_GRID, 2, 4, -1,	"DESCRIPTION{Create a 3D grid geometry of the same size as the format in argument (width, height and number of channels).}"
 												"ARGUMENT:nameNewGeometry{Name of the new geometry.}"
 												"ARGUMENT:nameFormat{Name of the original format.}"
-												"ARGUMENT:normalized{Either TRUE or FALSE. If enabled, the vertices coordinates will be in the range [0,1].}")
+												"ARGUMENT:normalized{Either TRUE or FALSE. If enabled, the vertices coordinates will be in the range [0,1].}"
+												"ARGUMENT:procedural{Either TRUE or FALSE. If enabled, the grid has no vertex data and the vertex shader must compute the coordinates from gl_VertexID (normalized is then ignored).}")
 			{
 				UNUSED_PARAMETER(body)
 				UNUSED_PARAMETER(currentPath)
@@ -1999,10 +2005,14 @@
 
 				CONST_ITERATOR_TO_FORMAT( it, arguments[1] )
 
-				const bool normalized = (arguments.size()>=3) ? getBoolean(arguments[2], sourceName, startLine) : false;
+				const bool 	normalized = (arguments.size()>=3) ? getBoolean(arguments[2], sourceName, startLine) : false,
+						procedural = (arguments.size()>=4) ? getBoolean(arguments[3], sourceName, startLine) : false;
 
 				// Build the new geometry : 
-				APPEND_NEW_GEOMETRY( arguments[0], GeometryPrimitives::PointsGrid3D(it->second.getWidth(), it->second.getHeight(), it->second.getNumChannels(), normalized) )
+				if(procedural)
+					APPEND_NEW_GEOMETRY( arguments[0], GeometryPrimitives::ProceduralGrid(it->second.getWidth(), it->second.getHeight(), it->second.getNumChannels()) )
+				else
+					APPEND_NEW_GEOMETRY( arguments[0], GeometryPrimitives::PointsGrid3D(it->second.getWidth(), it->second.getHeight(), it->second.getNumChannels(), normalized) )
 			}
 
 			LAYOUT_LOADER_MODULE_APPLY( CHAIN_PIPELINES, 4, -1, -1,	"DESCRIPTION{Create a pipeline by connecting the pipelines passed in arguments.}\n"
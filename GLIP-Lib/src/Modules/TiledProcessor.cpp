@@ -0,0 +1,326 @@
+/* ************************************************************************************************************* */
+/*                                                                                                               */
+/*     GLIP-LIB                                                                                                  */
+/*     OpenGL Image Processing LIBrary                                                                           */
+/*                                                                                                               */
+/*     Author        : R. Kerviche                                                                               */
+/*     LICENSE       : MIT License                                                                               */
+/*     Website       : glip-lib.net                                                                              */
+/*                                                                                                               */
+/*     File          : TiledProcessor.cpp                                                                        */
+/*     Original Date : October 17th 2026                                                                         */
+/*                                                                                                               */
+/*     Description   : Module : Tiled processing of large images                                                 */
+/*                                                                                                               */
+/* ************************************************************************************************************* */
+
+/**
+ * \file    TiledProcessor.cpp
+ * \brief   Module : Tiled processing of large images
+ * \author  R. KERVICHE
+ * \date    October 17th 2026
+**/
+
+#include <cstring>
+#include <algorithm>
+#include "Modules/TiledProcessor.hpp"
+#include "Core/Exception.hpp"
+
+using namespace Glip;
+using namespace Glip::CoreGL;
+using namespace Glip::CorePipeline;
+using namespace Glip::Modules;
+
+	/**
+	\fn TiledProcessor::TiledProcessor(Pipeline& _pipeline, int _defaultHalo)
+	\brief TiledProcessor constructor.
+	\param _pipeline The pipeline to apply, built for the size of a tile. It must be kept in memory during the life of this object.
+	\param _defaultHalo The halo of the filters which are not declared and which read their inputs around the current fragment (negative if unknown, such filters must then be declared).
+	**/
+	TiledProcessor::TiledProcessor(Pipeline& _pipeline, int _defaultHalo)
+	 :	pipeline(_pipeline),
+		defaultHalo(_defaultHalo),
+		numProcessedTiles(0)
+	{
+		if(pipeline.getNumOutputPort()==0)
+			throw Exception("TiledProcessor::TiledProcessor - The pipeline " + pipeline.getFullName() + " has no output.", __FILE__, __LINE__, Exception::ModuleException);
+	}
+
+	TiledProcessor::~TiledProcessor(void)
+	{ }
+
+	/**
+	\fn void TiledProcessor::listTiles(int size, int tileSize, int halo, std::vector<int>& coresStarts, std::vector<int>& origins)
+	\brief Split one dimension in tiles.
+	\param size Size of the image.
+	\param tileSize Size of a tile.
+	\param halo Halo of the pipeline.
+	\param coresStarts Start of the part of each tile which is kept.
+	\param origins Start of each tile.
+	**/
+	void TiledProcessor::listTiles(int size, int tileSize, int halo, std::vector<int>& coresStarts, std::vector<int>& origins)
+	{
+		coresStarts.clear();
+		origins.clear();
+
+		if(size<=tileSize)
+		{
+			coresStarts.push_back(0);
+			origins.push_back(0);
+			return ;
+		}
+
+		const int coreSize = tileSize - 2*halo;
+
+		if(coreSize<=0)
+			throw Exception("TiledProcessor::listTiles - The halo (" + toString(halo) + ") is too large for tiles of size " + toString(tileSize) + ".", __FILE__, __LINE__, Exception::ModuleException);
+
+		// The tiles stay inside the image, the borders are then handled as with the full image :
+		for(int c=0; c<size; c+=coreSize)
+		{
+			coresStarts.push_back(c);
+			origins.push_back(std::min(std::max(c - halo, 0), size - tileSize));
+		}
+	}
+
+	/**
+	\fn void TiledProcessor::uploadTile(const ImageBuffer& image, int x, int y, ImageBuffer& tile, HdlPBO& pbo, HdlTexture& texture)
+	\brief Copy a tile of an image to a texture, through a PBO.
+	\param image The source image.
+	\param x Horizontal origin of the tile.
+	\param y Vertical origin of the tile.
+	\param tile Host buffer, of the size of the tile.
+	\param pbo Unpacking buffer.
+	\param texture Target texture.
+	**/
+	void TiledProcessor::uploadTile(const ImageBuffer& image, int x, int y, ImageBuffer& tile, HdlPBO& pbo, HdlTexture& texture)
+	{
+		const int 	w = std::min(tile.getWidth(), image.getWidth() - x),
+				h = std::min(tile.getHeight(), image.getHeight() - y);
+
+		tile.blit(image, x, y, 0, 0, w, h);
+
+		// Repeat the border if the image is smaller than the tile :
+		for(int k=w; k<tile.getWidth(); k++)
+			tile.blit(tile, w-1, 0, k, 0, 1, h);
+		for(int k=h; k<tile.getHeight(); k++)
+			tile.blit(tile, 0, h-1, 0, k, tile.getWidth(), 1);
+
+		void* ptr = pbo.map(GL_WRITE_ONLY, GL_PIXEL_UNPACK_BUFFER);
+		std::memcpy(ptr, tile.getPtr(), tile.getTable().getSize());
+		HdlPBO::unmap(GL_PIXEL_UNPACK_BUFFER);
+
+		glPixelStorei(GL_UNPACK_ALIGNMENT, tile.getTable().getAlignment());
+		pbo.copyToTexture(texture, 0, 0, -1, -1, tile.getDescriptor().aliasMode, tile.getGLDepth());
+	}
+
+	/**
+	\fn int TiledProcessor::getTileWidth(void)
+	\brief Get the width of the tiles.
+	\return The width of the outputs of the pipeline.
+	**/
+	int TiledProcessor::getTileWidth(void)
+	{
+		return pipeline.out(0).getWidth();
+	}
+
+	/**
+	\fn int TiledProcessor::getTileHeight(void)
+	\brief Get the height of the tiles.
+	\return The height of the outputs of the pipeline.
+	**/
+	int TiledProcessor::getTileHeight(void)
+	{
+		return pipeline.out(0).getHeight();
+	}
+
+	/**
+	\fn void TiledProcessor::setFilterHalo(int filterID, int halo)
+	\brief Declare the halo of a filter : the distance, in pixels, up to which the filter reads its inputs around the current fragment.
+	\param filterID The global ID of the filter in the pipeline (see AbstractPipelineLayout::getElementID).
+	\param halo The halo of the filter.
+	**/
+	void TiledProcessor::setFilterHalo(int filterID, int halo)
+	{
+		if(halo<0)
+			throw Exception("TiledProcessor::setFilterHalo - The halo must be positive or zero (" + toString(halo) + ").", __FILE__, __LINE__, Exception::ModuleException);
+
+		filtersHalos[filterID] = halo;
+	}
+
+	/**
+	\fn void TiledProcessor::setDefaultHalo(int halo)
+	\brief Set the halo of the filters which are not declared and which read their inputs around the current fragment.
+	\param halo The default halo.
+	**/
+	void TiledProcessor::setDefaultHalo(int halo)
+	{
+		if(halo<0)
+			throw Exception("TiledProcessor::setDefaultHalo - The halo must be positive or zero (" + toString(halo) + ").", __FILE__, __LINE__, Exception::ModuleException);
+
+		defaultHalo = halo;
+	}
+
+	/**
+	\fn int TiledProcessor::getHalo(void)
+	\brief Get the halo of the pipeline (see Pipeline::getHalo).
+	\return The overlap needed on each side of the tiles.
+	**/
+	int TiledProcessor::getHalo(void)
+	{
+		return pipeline.getHalo(filtersHalos, defaultHalo);
+	}
+
+	/**
+	\fn int TiledProcessor::getNumTiles(int width, int height)
+	\brief Get the number of tiles needed to process an image.
+	\param width Width of the image.
+	\param height Height of the image.
+	\return The number of tiles.
+	**/
+	int TiledProcessor::getNumTiles(int width, int height)
+	{
+		const int halo = getHalo();
+		std::vector<int> cores, origins;
+
+		listTiles(width, getTileWidth(), halo, cores, origins);
+		const int n = cores.size();
+		listTiles(height, getTileHeight(), halo, cores, origins);
+
+		return n * cores.size();
+	}
+
+	/**
+	\fn int TiledProcessor::getNumProcessedTiles(void) const
+	\brief Get the number of tiles processed during the last call to process().
+	\return The number of tiles.
+	**/
+	int TiledProcessor::getNumProcessedTiles(void) const
+	{
+		return numProcessedTiles;
+	}
+
+	/**
+	\fn void TiledProcessor::process(const std::vector<const ImageBuffer*>& inputs, const std::vector<ImageBuffer*>& outputs)
+	\brief Apply the pipeline on images, tile by tile.
+	\param inputs The input images (one per input port of the pipeline, all of the same size).
+	\param outputs The output images (one per output port of the pipeline, of the same size as the inputs). The results are converted to the format of these images.
+	**/
+	void TiledProcessor::process(const std::vector<const ImageBuffer*>& inputs, const std::vector<ImageBuffer*>& outputs)
+	{
+		if(static_cast<int>(inputs.size())!=pipeline.getNumInputPort() || static_cast<int>(outputs.size())!=pipeline.getNumOutputPort())
+			throw Exception("TiledProcessor::process - The pipeline " + pipeline.getFullName() + " expects " + toString(pipeline.getNumInputPort()) + " input(s) and " + toString(pipeline.getNumOutputPort()) + " output(s) (" + toString(inputs.size()) + " and " + toString(outputs.size()) + " given).", __FILE__, __LINE__, Exception::ModuleException);
+		if(inputs.empty())
+			throw Exception("TiledProcessor::process - The pipeline " + pipeline.getFullName() + " has no input.", __FILE__, __LINE__, Exception::ModuleException);
+
+		const int 	width 		= inputs.front()->getWidth(),
+				height		= inputs.front()->getHeight(),
+				tileWidth	= getTileWidth(),
+				tileHeight	= getTileHeight(),
+				halo		= getHalo();
+
+		for(unsigned int k=0; k<inputs.size(); k++)
+		{
+			if(inputs[k]->getWidth()!=width || inputs[k]->getHeight()!=height)
+				throw Exception("TiledProcessor::process - All the inputs must have the same size.", __FILE__, __LINE__, Exception::ModuleException);
+		}
+		for(unsigned int k=0; k<outputs.size(); k++)
+		{
+			if(outputs[k]->getWidth()!=width || outputs[k]->getHeight()!=height)
+				throw Exception("TiledProcessor::process - The outputs must have the same size as the inputs.", __FILE__, __LINE__, Exception::ModuleException);
+			if(pipeline.out(k).getWidth()!=tileWidth || pipeline.out(k).getHeight()!=tileHeight)
+				throw Exception("TiledProcessor::process - All the outputs of the pipeline " + pipeline.getFullName() + " must have the same size.", __FILE__, __LINE__, Exception::ModuleException);
+		}
+
+		std::vector<int> xCores, xOrigins, yCores, yOrigins;
+		listTiles(width, tileWidth, halo, xCores, xOrigins);
+		listTiles(height, tileHeight, halo, yCores, yOrigins);
+
+		const int numTiles = xCores.size() * yCores.size();
+
+		// Double buffering of the inputs, the next tile is uploaded while the current one is processed :
+		std::vector<ImageBuffer*>	hostTiles,
+						hostResults;
+		std::vector<HdlPBO*>		pbos;
+		std::vector<HdlTexture*>	textures;
+
+		try
+		{
+			for(unsigned int k=0; k<inputs.size(); k++)
+			{
+				const HdlTextureFormat fmt(tileWidth, tileHeight, inputs[k]->getGLMode(), inputs[k]->getGLDepth(), inputs[k]->getMinFilter(), inputs[k]->getMagFilter());
+
+				hostTiles.push_back(new ImageBuffer(fmt));
+				for(int l=0; l<2; l++)
+				{
+					pbos.push_back(new HdlPBO(tileWidth, tileHeight, 1, 1, GL_PIXEL_UNPACK_BUFFER, GL_STREAM_DRAW, hostTiles.back()->getTable().getSize()));
+					textures.push_back(new HdlTexture(fmt));
+				}
+			}
+
+			for(unsigned int k=0; k<outputs.size(); k++)
+				hostResults.push_back(new ImageBuffer(pipeline.out(k).format()));
+
+			numProcessedTiles = 0;
+
+			for(unsigned int k=0; k<inputs.size(); k++)
+				uploadTile(*inputs[k], xOrigins[0], yOrigins[0], *hostTiles[k], *pbos[2*k], *textures[2*k]);
+
+			for(int t=0; t<numTiles; t++)
+			{
+				const int	slot	= t % 2,
+						i	= t % xCores.size(),
+						j	= t / xCores.size(),
+						cw	= ((i+1<static_cast<int>(xCores.size())) ? xCores[i+1] : width) - xCores[i],
+						ch	= ((j+1<static_cast<int>(yCores.size())) ? yCores[j+1] : height) - yCores[j];
+
+				for(unsigned int k=0; k<inputs.size(); k++)
+					pipeline << *textures[2*k + slot];
+				pipeline << Pipeline::Process;
+
+				// Prepare the next tile :
+				if(t+1<numTiles)
+				{
+					const int 	ni = (t+1) % xCores.size(),
+							nj = (t+1) / xCores.size();
+
+					for(unsigned int k=0; k<inputs.size(); k++)
+						uploadTile(*inputs[k], xOrigins[ni], yOrigins[nj], *hostTiles[k], *pbos[2*k + 1 - slot], *textures[2*k + 1 - slot]);
+				}
+
+				// Stitch :
+				for(unsigned int k=0; k<outputs.size(); k++)
+				{
+					(*hostResults[k]) << pipeline.out(k);
+					outputs[k]->blit(*hostResults[k], xCores[i] - xOrigins[i], yCores[j] - yOrigins[j], xCores[i], yCores[j], cw, ch);
+				}
+
+				numProcessedTiles++;
+			}
+		}
+		catch(Exception& e)
+		{
+			for(unsigned int k=0; k<hostTiles.size(); k++)
+				delete hostTiles[k];
+			for(unsigned int k=0; k<hostResults.size(); k++)
+				delete hostResults[k];
+			for(unsigned int k=0; k<pbos.size(); k++)
+				delete pbos[k];
+			for(unsigned int k=0; k<textures.size(); k++)
+				delete textures[k];
+
+			Exception m("TiledProcessor::process - Exception caught while processing the tile " + toString(numProcessedTiles) + " : ", __FILE__, __LINE__, Exception::ModuleException);
+			m << e;
+			throw m;
+		}
+
+		for(unsigned int k=0; k<hostTiles.size(); k++)
+			delete hostTiles[k];
+		for(unsigned int k=0; k<hostResults.size(); k++)
+			delete hostResults[k];
+		for(unsigned int k=0; k<pbos.size(); k++)
+			delete pbos[k];
+		for(unsigned int k=0; k<textures.size(); k++)
+			delete textures[k];
+	}
+
@@ -0,0 +1,223 @@
+/* ************************************************************************************************************* */
+/*                                                                                                               */
+/*     GLIP-LIB                                                                                                  */
+/*     OpenGL Image Processing LIBrary                                                                           */
+/*                                                                                                               */
+/*     Author        : R. Kerviche                                                                               */
+/*     LICENSE       : MIT License                                                                               */
+/*     Website       : glip-lib.net                                                                              */
+/*                                                                                                               */
+/*     File          : testHalfFloat.cpp                                                                         */
+/*     Original Date : October 17th 2026                                                                         */
+/*                                                                                                               */
+/*     Description   : Tests of the half precision conversions                                                   */
+/*                                                                                                               */
+/* ************************************************************************************************************* */
+
+/**
+ * \file    testHalfFloat.cpp
+ * \brief   Tests of the half precision conversions (HalfFloat), for all the half values and the rounding boundaries. The scalar and bulk conversions must agree (the bulk conversions use the F16C instructions with the CMake option GLIP_USE_F16C).
+ * \author  R. KERVICHE
+ * \date    October 17th 2026
+**/
+
+	// Includes :
+	#include <iostream>
+	#include <iomanip>
+	#include <vector>
+	#include <cstring>
+	#include <cmath>
+	#include "GLIPLib.hpp"
+
+	using namespace Glip::CoreGL;
+
+	static int numErrors = 0;
+
+	static unsigned int floatBits(const float& value)
+	{
+		unsigned int f = 0;
+		std::memcpy(&f, &value, sizeof(f));
+		return f;
+	}
+
+	static float bitsFloat(const unsigned int& f)
+	{
+		float value = 0.0f;
+		std::memcpy(&value, &f, sizeof(value));
+		return value;
+	}
+
+	static void report(const std::string& test, unsigned int input, unsigned int result, unsigned int expected)
+	{
+		if(numErrors<32)
+			std::cerr << test << " - input 0x" << std::hex << input << " : 0x" << result << " instead of 0x" << expected << std::dec << std::endl;
+		numErrors++;
+	}
+
+	// Exact value of a half, computed independently :
+	static double referenceValue(unsigned short h)
+	{
+		const int	exponent	= (h >> 10) & 0x1F,
+				mantissa	= h & 0x3FF;
+		const double	sign		= ((h & 0x8000)!=0) ? -1.0 : 1.0;
+
+		if(exponent==0)
+			return sign * std::ldexp(static_cast<double>(mantissa), -24);
+		else
+			return sign * std::ldexp(static_cast<double>(mantissa + 1024), exponent - 25);
+	}
+
+	// Convert with the scalar and the bulk functions (the bulk conversion is run on a block of 8 values and on the remainder) :
+	static unsigned short checkToHalf(const std::string& test, float value)
+	{
+		const unsigned short h = HalfFloat::toHalf(value);
+
+		std::vector<float> src(11, value);
+		std::vector<HalfFloat> dst(src.size());
+		HalfFloat::toHalf(&dst[0], &src[0], src.size());
+
+		for(unsigned int k=0; k<dst.size(); k++)
+		{
+			if(dst[k].bits!=h)
+			{
+				report(test + " (bulk toHalf)", floatBits(value), dst[k].bits, h);
+				break;
+			}
+		}
+
+		return h;
+	}
+
+	static void testAllHalves(void)
+	{
+		std::vector<HalfFloat> halves(65536);
+		std::vector<float> floats(halves.size());
+		for(unsigned int k=0; k<halves.size(); k++)
+			halves[k].bits = static_cast<unsigned short>(k);
+
+		HalfFloat::toFloat(&floats[0], &halves[0], halves.size());
+
+		std::vector<HalfFloat> back(halves.size());
+		HalfFloat::toHalf(&back[0], &floats[0], floats.size());
+
+		for(unsigned int k=0; k<halves.size(); k++)
+		{
+			const unsigned short	h		= static_cast<unsigned short>(k);
+			const float		f		= HalfFloat::toFloat(h);
+			const bool		isNaN		= ((h & 0x7C00)==0x7C00) && ((h & 0x3FF)!=0);
+
+			// Scalar and bulk conversions must give the same bits :
+			if(floatBits(f)!=floatBits(floats[k]))
+				report("toFloat (scalar / bulk)", h, floatBits(floats[k]), floatBits(f));
+
+			if(isNaN)
+			{
+				// Quiet NaN, same sign and payload :
+				const unsigned int expected = (static_cast<unsigned int>(h & 0x8000) << 16) | 0x7FC00000u | (static_cast<unsigned int>(h & 0x3FF) << 13);
+				if(floatBits(f)!=expected)
+					report("toFloat (NaN)", h, floatBits(f), expected);
+			}
+			else if((h & 0x7FFF)==0x7C00)
+			{
+				if(!(f>3.4e38f || f<-3.4e38f) || ((h & 0x8000)!=0)!=(f<0.0f))
+					report("toFloat (infinity)", h, floatBits(f), 0);
+			}
+			else if(static_cast<double>(f)!=referenceValue(h) || (floatBits(f) >> 31)!=static_cast<unsigned int>(h >> 15))
+				report("toFloat (value)", h, floatBits(f), floatBits(static_cast<float>(referenceValue(h))));
+
+			// Round trip, the NaN are made quiet :
+			const unsigned short expected = isNaN ? static_cast<unsigned short>(h | 0x200) : h;
+			if(HalfFloat::toHalf(f)!=expected)
+				report("toHalf(toFloat()) (scalar)", h, HalfFloat::toHalf(f), expected);
+			if(back[k].bits!=expected)
+				report("toHalf(toFloat()) (bulk)", h, back[k].bits, expected);
+		}
+	}
+
+	static void testRounding(void)
+	{
+		// Halfway between two consecutive finite halves, and one float step around :
+		for(unsigned int s=0; s<2; s++)
+		{
+			for(unsigned int k=0; k<0x7BFF; k++)
+			{
+				const unsigned short	a	= static_cast<unsigned short>((s << 15) | k),
+							b	= static_cast<unsigned short>(a + 1);
+				const float		middle	= static_cast<float>((referenceValue(a) + referenceValue(b)) / 2.0),
+							below	= bitsFloat(floatBits(middle) - 1),
+							above	= bitsFloat(floatBits(middle) + 1);
+				const unsigned short	even	= ((a & 1)==0) ? a : b;
+
+				unsigned short h = checkToHalf("toHalf (tie)", middle);
+				if(h!=even)
+					report("toHalf (tie)", floatBits(middle), h, even);
+				h = checkToHalf("toHalf (below tie)", below);
+				if(h!=a)
+					report("toHalf (below tie)", floatBits(below), h, a);
+				h = checkToHalf("toHalf (above tie)", above);
+				if(h!=b)
+					report("toHalf (above tie)", floatBits(above), h, b);
+			}
+		}
+	}
+
+	static void testBoundaries(void)
+	{
+		struct Case
+		{
+			float		value;
+			unsigned short	expected;
+		};
+
+		const float infinity = bitsFloat(0x7F800000u);
+		const Case cases[] = {	{65504.0f,				0x7BFF},	// Largest half.
+					{-65504.0f,				0xFBFF},
+					{65519.996f,				0x7BFF},	// Just below the halfway to the infinity.
+					{65520.0f,				0x7C00},	// Halfway, ties to even (the infinity).
+					{-65520.0f,				0xFC00},
+					{1e10f,					0x7C00},	// Overflow.
+					{infinity,				0x7C00},
+					{-infinity,				0xFC00},
+					{static_cast<float>(std::ldexp(1.0, -14)),	0x0400},	// Smallest normal.
+					{static_cast<float>(std::ldexp(1023.0, -24)),	0x03FF},	// Largest denormal.
+					{static_cast<float>(std::ldexp(1.0, -24)),	0x0001},	// Smallest denormal.
+					{static_cast<float>(-std::ldexp(1.0, -24)),	0x8001},
+					{static_cast<float>(std::ldexp(1.0, -25)),	0x0000},	// Halfway to the smallest denormal, ties to even (zero).
+					{static_cast<float>(-std::ldexp(1.0, -25)),	0x8000},
+					{bitsFloat(0x33000001u),		0x0001},	// Just above 2^-25.
+					{static_cast<float>(std::ldexp(3.0, -25)),	0x0002},	// 1.5 x 2^-24, ties to even.
+					{static_cast<float>(std::ldexp(1.0, -26)),	0x0000},	// Underflow.
+					{bitsFloat(0x00000001u),		0x0000},	// Float denormal.
+					{0.0f,					0x0000},
+					{bitsFloat(0x80000000u),		0x8000},
+					{1.0f,					0x3C00},
+					{-2.0f,					0xC000},
+					{bitsFloat(0x7FC00000u),		0x7E00},	// Quiet NaN.
+					{bitsFloat(0xFFC00000u),		0xFE00},
+					{bitsFloat(0x7F800001u),		0x7E00},	// Signaling NaN, made quiet (the payload is lost in the lower bits).
+					{bitsFloat(0x7FA00000u),		0x7F00}		// Signaling NaN, made quiet with its payload.
+				};
+		const int numCases = sizeof(cases) / sizeof(Case);
+
+		for(int k=0; k<numCases; k++)
+		{
+			const unsigned short h = checkToHalf("toHalf (boundary)", cases[k].value);
+			if(h!=cases[k].expected)
+				report("toHalf (boundary)", floatBits(cases[k].value), h, cases[k].expected);
+		}
+	}
+
+	int main(void)
+	{
+		testAllHalves();
+		testRounding();
+		testBoundaries();
+
+		std::cout << "HalfFloat : ";
+		if(numErrors==0)
+			std::cout << "all the tests passed." << std::endl;
+		else
+			std::cout << numErrors << " error(s)." << std::endl;
+
+		return (numErrors==0) ? 0 : 1;
+	}
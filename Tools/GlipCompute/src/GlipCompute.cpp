@@ -72,12 +72,23 @@ Other options : \n\
 		are conserved as long as possible on device, depending on\n\
 		their usage frequency).\n\
 		Default is 128 MB.\n\
+ -p, --pool	Set the amount of memory (given in MB) kept on the device\n\
+		for the buffers of the pipelines, in order to reuse them\n\
+		when the pipeline is rebuilt for new input sizes. It is\n\
+		separate from the memory set with -m.\n\
+		Default is 64 MB.\n\
  -s, --preserve	Preserve the pipeline definition after its first creation.\n\
 		New inputs sizes will be ignored as required elements.\n\
  -d, --display	Name of the host, X server and display to target for the\n\
 		context.\n\
 		E.g. : -d host:xServer.screenId\n\
 		       -d localhost:0.0\n\
+ -c, --cache	Directory where the compiled programs are kept between\n\
+		runs. With -b, the numbers of programs loaded (hits) and\n\
+		compiled (misses) are reported at the end.\n\
+		E.g. : -c ~/.cache/glip-compute\n\
+ -b, --verbose	Report statistics at the end (program cache, texture\n\
+		pool).\n\
  -h, --help	Show this help and stops.\n\
  -t, --template	Show a list of templates script (Pipeline, Uniforms and \n\
 		Command) and stops.\n\
@@ -535,7 +546,7 @@ Link : <http://glip-lib.net/>\
 		return ((fp != NULL) && isatty(fileno(fp)));
 	}
 
-	int parseArguments(int argc, char** argv, std::string& pipelineFilename, size_t& memorySize, GCFlags& flags, std::string& inputFormatString, std::string& displayName, std::vector<ProcessCommand>& commands)
+	int parseArguments(int argc, char** argv, std::string& pipelineFilename, size_t& memorySize, size_t& poolSize, GCFlags& flags, std::string& inputFormatString, std::string& displayName, std::vector<ProcessCommand>& commands)
 	{
 		#define RETURN_ERROR( code, str ) { std::cerr << str << std::endl; return code ; }
 
@@ -557,6 +568,7 @@ Link : <http://glip-lib.net/>\
 
 		// Init and defaults :
 		memorySize = 134217728; // 128 MB
+		poolSize = 67108864; // 64 MB
 		ProcessCommand singleCommand; 
 		pipelineFilename.clear();
 		commands.clear();
@@ -670,6 +682,21 @@ Link : <http://glip-lib.net/>\
 				else
 					memorySize = memorySize * 1024 * 1024; // Transfer to MB
 			}
+			else if(arg=="-p" || arg=="--pool")
+			{
+				std::string poolStr;
+
+				it++;
+				if(it!=arguments.end())
+					poolStr = *it;
+				else
+					RETURN_ERROR(-1, "Missing size for argument " << arg << ".")
+
+				if(!Glip::fromString(poolStr, poolSize))
+					RETURN_ERROR(-1, "Cannot read pool size : \"" << poolStr << "\".")
+				else
+					poolSize = poolSize * 1024 * 1024; // Transfer to MB
+			}
 			else if(arg=="-f" || arg=="--format")
 			{
 				it++;
@@ -682,6 +709,10 @@ Link : <http://glip-lib.net/>\
 			{
 				flags = static_cast<GCFlags>(flags | ForcePreservePipeline);
 			}
+			else if(arg=="-b" || arg=="--verbose")
+			{
+				flags = static_cast<GCFlags>(flags | Verbose);
+			}
 			else if(arg=="-d" || arg=="--display")
 			{
 				it++;
@@ -690,6 +721,14 @@ Link : <http://glip-lib.net/>\
 				else
 					RETURN_ERROR(-1, "Missing display name for argument " << arg << ".")
 			}
+			else if(arg=="-c" || arg=="--cache")
+			{
+				it++;
+				if(it!=arguments.end())
+					Glip::CoreGL::HdlProgram::setBinaryCacheDirectory(*it);
+				else
+					RETURN_ERROR(-1, "Missing directory for argument " << arg << ".")
+			}
 			else
 				RETURN_ERROR(-1, "Unknonwn argument : " << arg << ".")
 		}
@@ -813,7 +852,7 @@ Link : <http://glip-lib.net/>\
 		}
 	}
 
-	int compute(const std::string& pipelineFilename, const size_t& memorySize, const GCFlags& flags, const std::string& inputFormatString, const std::string& displayName, std::vector<ProcessCommand>& commands)
+	int compute(const std::string& pipelineFilename, const size_t& memorySize, const size_t& poolSize, const GCFlags& flags, const std::string& inputFormatString, const std::string& displayName, std::vector<ProcessCommand>& commands)
 	{
 		int returnCode = 0;
 
@@ -829,6 +868,9 @@ Link : <http://glip-lib.net/>\
 			// Start GL : 
 			Glip::HandleOpenGL::init();
 
+			// Keep the buffers of the previous pipelines for the next ones (budget separate from the input images) :
+			Glip::CoreGL::HdlTexturePool::setBudget(poolSize);
+
 			// Create the loader, load the standard modules : 
 			Glip::Modules::LayoutLoader lloader;
 			Glip::Modules::LayoutLoaderModule::addBasicModules(lloader);
@@ -906,15 +948,27 @@ Link : <http://glip-lib.net/>\
 
 				if((pipeline==NULL || requirementsModified) && ((flags & ForcePreservePipeline)==0 || pipeline==NULL))
 				{
-					// Clean first :
-					delete pipeline;
-					pipeline = NULL;
-
 					// Load :
 					Glip::CorePipeline::AbstractPipelineLayout pLayout = lloader.getPipelineLayout(pipelineFilename);
 
+					// Only the formats changed, try to keep the programs : 
+					if(pipeline!=NULL)
+					{
+						try
+						{
+							pipeline->reformat(pLayout);
+						}
+						catch(Glip::Exception&)
+						{
+							// The structure of the pipeline changed, build it again :
+							delete pipeline;
+							pipeline = NULL;
+						}
+					}
+
 					// Prepare the pipeline : 
-					pipeline = new Glip::CorePipeline::Pipeline(pLayout, "GlipComputePipeline");
+					if(pipeline==NULL)
+						pipeline = new Glip::CorePipeline::Pipeline(pLayout, "GlipComputePipeline");
 				}
 
 				// Connect the inputs :  
@@ -939,6 +993,14 @@ Link : <http://glip-lib.net/>\
 				inputTextures.clear();
 				uloader.clear();
 			}
+
+			// Report the use of the program cache : 
+			if((flags & Verbose)!=0 && !Glip::CoreGL::HdlProgram::getBinaryCacheDirectory().empty())
+				std::cout << "Program cache : " << Glip::CoreGL::HdlProgram::getNumBinaryCacheHits() << " hit(s), " << Glip::CoreGL::HdlProgram::getNumBinaryCacheMisses() << " miss(es)." << std::endl;
+
+			// Report the use of the texture pool (only relevant over multiple commands) : 
+			if((flags & Verbose)!=0 && commands.size()>1)
+				std::cout << "Texture pool : " << Glip::CoreGL::HdlTexturePool::getNumHits() << " hit(s), " << Glip::CoreGL::HdlTexturePool::getNumMisses() << " miss(es) (hit rate : " << (Glip::CoreGL::HdlTexturePool::getHitRate()*100.0) << "%), " << Glip::CoreGL::HdlTexturePool::getResidentBytes() << " bytes resident." << std::endl;
 		}
 		catch(Glip::Exception& e)
 		{
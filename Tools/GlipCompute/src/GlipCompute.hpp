@@ -24,7 +24,8 @@
 	enum GCFlags
 	{
 		NoFlag			= 0,
-		ForcePreservePipeline	= 1
+		ForcePreservePipeline	= 1,
+		Verbose			= 2
 	};
 
 	struct ProcessCommand
@@ -44,8 +45,8 @@
 		void setSafeParameterSettings(void);
 	};
 
-extern int parseArguments(int argc, char** argv, std::string& pipelineFilename, size_t& memorySize, GCFlags& flags, std::string& inputFormatString, std::string& displayName, std::vector<ProcessCommand>& commands);
-	extern int compute(const std::string& pipelineFilename, const size_t& memorySize, const GCFlags& flags, const std::string& inputFormatString, const std::string& displayName, std::vector<ProcessCommand>& commands);
+extern int parseArguments(int argc, char** argv, std::string& pipelineFilename, size_t& memorySize, size_t& poolSize, GCFlags& flags, std::string& inputFormatString, std::string& displayName, std::vector<ProcessCommand>& commands);
+	extern int compute(const std::string& pipelineFilename, const size_t& memorySize, const size_t& poolSize, const GCFlags& flags, const std::string& inputFormatString, const std::string& displayName, std::vector<ProcessCommand>& commands);
 
 #endif
 
@@ -22,17 +22,18 @@
 	{
 		int returnCode = 0;
 
-		size_t				memorySize;	
+		size_t				memorySize,
+						poolSize;
 		GCFlags				flags;
 		std::string 			pipelineFilename,
 						inputFormatString,
 						displayName;
 		std::vector<ProcessCommand> 	commands;
 
-		returnCode = parseArguments(argc, argv, pipelineFilename, memorySize, flags, inputFormatString, displayName, commands);
+		returnCode = parseArguments(argc, argv, pipelineFilename, memorySize, poolSize, flags, inputFormatString, displayName, commands);
 	
 		if(returnCode==0)
-			returnCode = compute(pipelineFilename, memorySize, flags, inputFormatString, displayName, commands);
+			returnCode = compute(pipelineFilename, memorySize, poolSize, flags, inputFormatString, displayName, commands);
 
 		return returnCode;
 	}